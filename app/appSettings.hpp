@@ -27,6 +27,7 @@
 
 #include "Magic/Clustering/ClusteringAlgorithm.hpp"
 #include "Magic//FeatureExtractors/FeatureExtractor.hpp"
+#include "Magic/Pipeline.hpp"
 
 #include <string>
 #include <map>
@@ -44,9 +45,19 @@ namespace settings
     const std::map<std::string, magic::ClusteringAlgorithm::Type> CLUSTERING_ALGORITHMS = 
     {
         {"DBSCAN", magic::ClusteringAlgorithm::DBSCAN_ALGORITHM},
-        {"ROCK", magic::ClusteringAlgorithm::ROCK_ALGORITHM}
+        {"ROCK", magic::ClusteringAlgorithm::ROCK_ALGORITHM},
+        {"Agglomerative", magic::ClusteringAlgorithm::AGGLOMERATIVE_ALGORITHM},
+        {"K-Means", magic::ClusteringAlgorithm::KMEANS_ALGORITHM},
+        {"Mini-batch K-Means", magic::ClusteringAlgorithm::MINIBATCH_KMEANS_ALGORITHM},
+        {"OPTICS", magic::ClusteringAlgorithm::OPTICS_ALGORITHM},
+        {"K-Means (automatic k)", magic::ClusteringAlgorithm::AUTO_KMEANS_ALGORITHM},
+        {"Self-organizing map", magic::ClusteringAlgorithm::SOMSC_ALGORITHM},
+        {"CURE", magic::ClusteringAlgorithm::CURE_ALGORITHM}
     };
 
+    /** @brief Name of the feature cache file stored in the application cache directory. */
+    const std::string FEATURE_CACHE_FILENAME = "features.cache";
+
     /**
      * @brief Application settings
      */
@@ -59,6 +70,7 @@ namespace settings
         magic::FeatureExtractor::Type featureAlgorithm = magic::FeatureExtractor::GLOBAL_HIST;
         magic::ClusteringAlgorithm::Type clusterAlgorithm = magic::ClusteringAlgorithm::ROCK_ALGORITHM;
         unsigned short threadNumber = 1;
+        magic::Pipeline::Mode pipelineMode = magic::Pipeline::STREAMING;
     };
 }
 
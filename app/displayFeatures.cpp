@@ -32,11 +32,11 @@
  */
 void MainWindow::displayFeatures()
 {
-    QVector<double> x(features.size()), y(features.size());
-    for(size_t i=0; i<features.size(); i++)
+    QVector<double> x(features.rows()), y(features.rows());
+    for(size_t i=0; i<features.rows(); i++)
     {
-        x[i] = features[i].featureVector[0];
-        y[i] = features[i].featureVector[1];
+        x[i] = features(i, 0);
+        y[i] = features(i, 1);
     }
 
     
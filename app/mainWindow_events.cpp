@@ -27,6 +27,8 @@
 #include "progressdialog.h"
 #include <QFileDialog>
 #include <QMessageBox>
+#include <QStandardPaths>
+#include <QDir>
 
 /**
  * @brief Update string displayed in combo box.
@@ -115,6 +117,16 @@ void MainWindow::on_cluster_button_pressed()
     
     //add files to the pipeline and start processing
     pipeline->setInput(imageFilenames);
+    pipeline->setMode(getSettings().pipelineMode);
+    
+    //reuse worker threads from the previous run if thread count did not change
+    if(!executor || executor->getThreadCount() != getSettings().threadNumber)
+        executor.reset(new magic::Executor(getSettings().threadNumber));
+    pipeline->setExecutor(executor);
+    
+    //features of the images that did not change are taken from the cache
+    openFeatureCache();
+    pipeline->setFeatureCache(featureCache);
     pipeline->startProcessing(getSettings().threadNumber);
     
     ProgressDialog dialog(this, pipeline);
@@ -129,6 +141,30 @@ void MainWindow::on_cluster_button_pressed()
     displayFeatures();
 }
 
+/**
+ * @brief Open the feature cache stored in the application cache directory.
+ * If the cache cannot be opened, processing continues without it.
+ */
+void MainWindow::openFeatureCache()
+{
+    if(featureCache)
+        return;
+    
+    const QString cacheDir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+    if(cacheDir.isEmpty() || !QDir().mkpath(cacheDir))
+        return;
+    
+    try
+    {
+        const std::string cachePath = cacheDir.toStdString() + "/" + settings::FEATURE_CACHE_FILENAME;
+        featureCache.reset(new magic::FeatureCache(cachePath));
+    }
+    catch(std::runtime_error& e)
+    {
+        QMessageBox::warning(this, "Warning", std::string("Feature cache is disabled: " + std::string(e.what())).c_str());
+    }
+}
+
 /**
  * @brief Handler for sorting start button.
  */
@@ -55,11 +55,14 @@ private:
     void setSettings(settings::UserSettings settings);
     void sortImages();
     void displayFeatures();
+    void openFeatureCache();
     settings::UserSettings getSettings();
         
     Ui::MainWindow* ui;
     std::vector<magic::Cluster> clusters;
-    magic::FeatureDataset features;
+    magic::FeatureMatrix features;
+    std::shared_ptr<magic::Executor> executor;
+    std::shared_ptr<magic::FeatureCache> featureCache;
     
 };
 
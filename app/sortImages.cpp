@@ -61,16 +61,16 @@ void MainWindow::sortImages()
             std::string filename;
             for(auto it=clusters[i].begin(); it<clusters[i].end(); it++)
             {
-                found = (*it).path.find_last_of("/\\");
+                found = (*it).find_last_of("/\\");
                 if(found == std::string::npos)
-                    filename = (*it).path;
+                    filename = (*it);
                 else
-                    filename = (*it).path.substr(found+1);
+                    filename = (*it).substr(found+1);
                 
                 if(getSettings().leaveOryginalImages)
-                    utils::copyFile((*it).path, destination+"/");
+                    utils::copyFile((*it), destination+"/");
                 else
-                    utils::moveFile((*it).path, destination+"/");
+                    utils::moveFile((*it), destination+"/");
             }
         }
     }
@@ -11,6 +11,48 @@ namespace mathtoolbox
     /// \param dim Target dimension
     /// \return Coordinate matrix whose i-th column corresponds to the embedded coordinates of the i-th entry
     Eigen::MatrixXd ComputeClassicalMds(const Eigen::MatrixXd& D, unsigned dim);
+
+    /// \brief Same as ComputeClassicalMds, but the distance matrix is used as the working memory
+    /// \param D Distance (dissimilarity) matrix, it is overwritten by the double-centered matrix
+    /// \param dim Target dimension
+    /// \return Coordinate matrix whose i-th column corresponds to the embedded coordinates of the i-th entry
+    Eigen::MatrixXd ComputeClassicalMdsInPlace(Eigen::MatrixXd& D, unsigned dim);
+
+    /// \brief Converts the distance matrix into the matrix -1/2 H D^2 H in O(n^2) time without extra n x n storage
+    /// \param D Distance matrix, it is overwritten by the result
+    void DoubleCenterInPlace(Eigen::MatrixXd& D);
+
+    /// \brief Computes the n largest eigenvalues and corresponding eigenvectors of a symmetric matrix
+    /// \details Small matrices are decomposed by the self-adjoint solver, large ones by the randomized subspace
+    /// iteration whose cost is O(size^2 n) instead of O(size^3)
+    /// \param K Symmetric matrix
+    /// \param n Number of eigenpairs
+    /// \param S Eigenvalues in descending order
+    /// \param V Eigenvectors stored as columns
+    void ComputeLargestSymmetricEigens(const Eigen::MatrixXd& K, unsigned n, Eigen::VectorXd& S, Eigen::MatrixXd& V);
+
+    /// \brief Landmark MDS: classical MDS of a small set of landmarks and distance based triangulation of other points
+    /// \details V. de Silva, J. B. Tenenbaum, "Sparse multidimensional scaling using landmark points", 2004
+    class LandmarkMds
+    {
+    public:
+        /// \param D Distance matrix of the landmarks
+        /// \param dim Target dimension
+        LandmarkMds(const Eigen::MatrixXd& D, unsigned dim);
+
+        /// \brief Embeds a point
+        /// \param squared_distances Squared distances between the point and every landmark
+        /// \return Embedded coordinates of the point
+        Eigen::VectorXd Embed(const Eigen::VectorXd& squared_distances) const;
+
+        /// \brief Returns coordinate matrix of the landmarks whose i-th column corresponds to the i-th landmark
+        const Eigen::MatrixXd& GetLandmarkCoordinates() const { return m_landmark_coordinates; }
+
+    private:
+        Eigen::MatrixXd m_projection;           ///< Pseudo-inverse of the landmark embedding (dim x landmarks), zero rows for negligible eigenvalues
+        Eigen::VectorXd m_mean_squared_distances; ///< Mean squared distance of every landmark to the other landmarks
+        Eigen::MatrixXd m_landmark_coordinates;
+    };
 } // namespace mathtoolbox
 
 #endif // MATHTOOLBOX_CLASSICAL_MDS_HPP
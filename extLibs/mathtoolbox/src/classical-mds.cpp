@@ -1,12 +1,30 @@
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <eigen3/Eigen/QR>
 #include <mathtoolbox/classical-mds.hpp>
+#include <random>
 #include <utility>
 #include <vector>
 
+namespace
+{
+    // Matrices up to this size are decomposed by the dense self-adjoint solver
+    constexpr unsigned kDenseEigenSolverLimit = 1000;
+
+    // Parameters of the randomized subspace iteration
+    constexpr unsigned kOversampling       = 10;
+    constexpr unsigned kSubspaceIterations = 6;
+
+    // Landmark dimensions whose eigenvalue is below this fraction of the largest one are dropped by the triangulation,
+    // inverting them would amplify the rounding noise of the distances
+    constexpr double kRelativeEigenvalueEpsilon = 1e-6;
+} // namespace
+
 // Extract the N-largest eigen values and eigen vectors
 inline void ExtractNLargestEigens(unsigned n, Eigen::VectorXd& S, Eigen::MatrixXd& V)
 {
-    // Note: m is the original dimension
+    // Note: m is the number of eigenpairs
     const unsigned m = S.rows();
 
     // Copy the original matrix
@@ -26,7 +44,7 @@ inline void ExtractNLargestEigens(unsigned n, Eigen::VectorXd& S, Eigen::MatrixX
 
     // Resize matrices
     S.resize(n);
-    V.resize(m, n);
+    V.resize(original_V.rows(), n);
 
     // Set values
     for (unsigned i = 0; i < n; ++i)
@@ -36,25 +54,121 @@ inline void ExtractNLargestEigens(unsigned n, Eigen::VectorXd& S, Eigen::MatrixX
     }
 }
 
-Eigen::MatrixXd mathtoolbox::ComputeClassicalMds(const Eigen::MatrixXd& D, unsigned dim)
+// Orthonormal basis of the column space of Y
+inline Eigen::MatrixXd Orthonormalize(const Eigen::MatrixXd& Y)
+{
+    const Eigen::HouseholderQR<Eigen::MatrixXd> qr(Y);
+    return qr.householderQ() * Eigen::MatrixXd::Identity(Y.rows(), Y.cols());
+}
+
+void mathtoolbox::DoubleCenterInPlace(Eigen::MatrixXd& D)
 {
     assert(D.rows() == D.cols());
-    assert(D.rows() >= dim);
 
-    const unsigned        n    = D.rows();
-    const Eigen::VectorXd ones = Eigen::VectorXd::Ones(n);
-    const Eigen::MatrixXd I    = Eigen::MatrixXd::Identity(n, n);
+    D = D.cwiseAbs2();
+
+    const Eigen::VectorXd row_means  = D.rowwise().mean();
+    const Eigen::VectorXd col_means  = D.colwise().mean().transpose();
+    const double          grand_mean = row_means.mean();
+
+    for (Eigen::Index j = 0; j < D.cols(); ++j)
+    {
+        D.col(j).array() = -0.5 * (D.col(j).array() - row_means.array() - (col_means(j) - grand_mean));
+    }
+}
+
+void mathtoolbox::ComputeLargestSymmetricEigens(const Eigen::MatrixXd& K, unsigned n, Eigen::VectorXd& S, Eigen::MatrixXd& V)
+{
+    assert(K.rows() == K.cols());
+    assert(K.rows() >= n);
+
+    const unsigned size = K.rows();
+    if (size <= kDenseEigenSolverLimit || n + kOversampling >= size)
+    {
+        const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> solver(K);
+        S = solver.eigenvalues();
+        V = solver.eigenvectors();
+
+        ExtractNLargestEigens(n, S, V);
+        return;
+    }
+
+    // Randomized subspace iteration (Halko, Martinsson, Tropp 2011); the seed is fixed so embeddings are reproducible
+    std::mt19937                     generator(0);
+    std::normal_distribution<double> distribution;
+
+    const unsigned  l     = n + kOversampling;
+    Eigen::MatrixXd Omega = Eigen::MatrixXd::NullaryExpr(size, l, [&]() { return distribution(generator); });
+
+    Eigen::MatrixXd Q = Orthonormalize(K * Omega);
+    for (unsigned i = 0; i < kSubspaceIterations; ++i)
+    {
+        Q = Orthonormalize(K * Q);
+    }
+
+    // Rayleigh-Ritz projection to the subspace
+    const Eigen::MatrixXd KQ = K * Q;
+    const Eigen::MatrixXd B  = Q.transpose() * KQ;
 
-    const Eigen::MatrixXd H = I - (1.0 / static_cast<double>(n)) * ones * ones.transpose();
-    const Eigen::MatrixXd K = -0.5 * H * D.cwiseAbs2() * H;
+    const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> solver(0.5 * (B + B.transpose()));
+    S = solver.eigenvalues();
+    V = Q * solver.eigenvectors();
 
-    const Eigen::EigenSolver<Eigen::MatrixXd> solver(K);
-    Eigen::VectorXd                           S = solver.eigenvalues().real();
-    Eigen::MatrixXd                           V = solver.eigenvectors().real();
+    ExtractNLargestEigens(n, S, V);
+}
 
-    ExtractNLargestEigens(dim, S, V);
+Eigen::MatrixXd mathtoolbox::ComputeClassicalMds(const Eigen::MatrixXd& D, unsigned dim)
+{
+    Eigen::MatrixXd K = D;
+    return ComputeClassicalMdsInPlace(K, dim);
+}
+
+Eigen::MatrixXd mathtoolbox::ComputeClassicalMdsInPlace(Eigen::MatrixXd& D, unsigned dim)
+{
+    assert(D.rows() == D.cols());
+    assert(D.rows() >= dim);
+
+    DoubleCenterInPlace(D);
+
+    Eigen::VectorXd S;
+    Eigen::MatrixXd V;
+    ComputeLargestSymmetricEigens(D, dim, S, V);
 
     const Eigen::MatrixXd X = Eigen::DiagonalMatrix<double, Eigen::Dynamic>(S.cwiseSqrt()) * V.transpose();
 
     return X;
 }
+
+mathtoolbox::LandmarkMds::LandmarkMds(const Eigen::MatrixXd& D, unsigned dim)
+{
+    assert(D.rows() == D.cols());
+    assert(D.rows() >= dim);
+
+    m_mean_squared_distances = D.cwiseAbs2().rowwise().mean();
+
+    Eigen::MatrixXd K = D;
+    DoubleCenterInPlace(K);
+
+    Eigen::VectorXd S;
+    Eigen::MatrixXd V;
+    ComputeLargestSymmetricEigens(K, dim, S, V);
+
+    Eigen::VectorXd inverse_sqrt_S = Eigen::VectorXd::Zero(S.size());
+    for (Eigen::Index i = 0; i < S.size(); ++i)
+    {
+        if (S(i) >= kRelativeEigenvalueEpsilon * S(0))
+        {
+            inverse_sqrt_S(i) = 1.0 / std::sqrt(S(i));
+        }
+    }
+
+    m_landmark_coordinates = Eigen::DiagonalMatrix<double, Eigen::Dynamic>(S.cwiseSqrt()) * V.transpose();
+    m_projection           = Eigen::DiagonalMatrix<double, Eigen::Dynamic>(inverse_sqrt_S) * V.transpose();
+}
+
+Eigen::VectorXd mathtoolbox::LandmarkMds::Embed(const Eigen::VectorXd& squared_distances) const
+{
+    assert(squared_distances.size() == m_mean_squared_distances.size());
+
+    return -0.5 * m_projection * (squared_distances - m_mean_squared_distances);
+}
@@ -0,0 +1,273 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+/*
+ * Benchmark of the approximate nearest neighbor index (HNSW) against exact search of the static KD-tree.
+ * Points are read from the feature cache of the application (path is the first argument), only vectors of
+ * the most frequent length are used. Without the argument a mixture of gaussian clusters is generated.
+ * For every size of the candidate list recall of kNN and radius queries and their time are reported.
+ */
+
+
+#include <pyclustering/container/flat_kdtree.hpp>
+#include <pyclustering/container/hnsw_index.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+
+using namespace pyclustering;
+using namespace pyclustering::container;
+using namespace pyclustering::utils::metric;
+
+
+namespace {
+
+
+const std::size_t POINT_AMOUNT = 50000;
+const std::size_t DIMENSION = 320;
+const std::size_t CENTER_AMOUNT = 64;
+const std::size_t QUERY_AMOUNT = 1000;
+const std::size_t NEIGHBOR_AMOUNT = 10;
+const std::size_t EF_SEARCH[] = { 10, 16, 32, 64, 128, 256 };
+
+const char CACHE_FILE_MAGIC[8] = { 'M', 'G', 'F', 'C', 'A', 'C', 'H', '1' };
+
+
+/* header of the record in the feature cache, followed by path, configuration, padding to 8 bytes and features padded to 8 bytes */
+struct cache_record_header {
+    std::uint32_t   m_path_length;
+    std::uint32_t   m_configuration_length;
+    std::uint32_t   m_feature_length;
+    std::uint32_t   m_scalar_size;          /* size of a feature in bytes, 0 in records written before features were stored as floats */
+    std::uint64_t   m_file_size;
+    std::int64_t    m_modification_time;
+};
+
+
+template <typename TypeAction>
+double measure(const TypeAction & p_action) {
+    const auto begin = std::chrono::steady_clock::now();
+    p_action();
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+
+bool read_feature_cache(const std::string & p_path, std::vector<double> & p_points, std::size_t & p_dimension) {
+    std::ifstream stream(p_path, std::ios::binary);
+
+    char magic[sizeof(CACHE_FILE_MAGIC)] = { };
+    if (!stream.read(magic, sizeof(magic)) || (std::memcmp(magic, CACHE_FILE_MAGIC, sizeof(magic)) != 0)) {
+        return false;
+    }
+
+    std::map<std::size_t, std::vector<double>> features;
+
+    const auto align = [](const std::size_t p_offset) { return (p_offset + 7) & ~std::size_t(7); };
+
+    std::size_t offset = sizeof(CACHE_FILE_MAGIC);
+    cache_record_header header;
+    std::vector<float> single_values;
+    while (stream.seekg(offset) && stream.read(reinterpret_cast<char *>(&header), sizeof(header))) {
+        const std::size_t scalar_size = (header.m_scalar_size == 0) ? sizeof(double) : header.m_scalar_size;
+        if ((scalar_size != sizeof(double)) && (scalar_size != sizeof(float))) {
+            break;
+        }
+
+        const std::size_t data_offset = align(offset + sizeof(header) + header.m_path_length + header.m_configuration_length);
+
+        std::vector<double> & values = features[header.m_feature_length];
+        const std::size_t position = values.size();
+        values.resize(position + header.m_feature_length);
+
+        stream.seekg(data_offset);
+        if (scalar_size == sizeof(double)) {
+            stream.read(reinterpret_cast<char *>(values.data() + position), header.m_feature_length * sizeof(double));
+        }
+        else {
+            single_values.resize(header.m_feature_length);
+            if (stream.read(reinterpret_cast<char *>(single_values.data()), header.m_feature_length * sizeof(float))) {
+                std::copy(single_values.begin(), single_values.end(), values.begin() + position);
+            }
+        }
+
+        if (!stream) {
+            values.resize(position);
+            break;
+        }
+
+        offset = align(data_offset + header.m_feature_length * scalar_size);
+    }
+
+    /* vectors of different configurations cannot be compared, the largest group is used */
+    p_dimension = 0;
+    for (auto & group : features) {
+        if ((group.first > 0) && (group.second.size() / group.first > p_points.size() / std::max(p_dimension, std::size_t(1)))) {
+            p_dimension = group.first;
+            p_points = std::move(group.second);
+        }
+    }
+
+    return p_dimension > 0;
+}
+
+
+void generate(std::vector<double> & p_points, std::size_t & p_dimension) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> center_distribution(-1.0, 1.0);
+    std::normal_distribution<double> distribution(0.0, 0.5);
+
+    std::vector<double> centers(CENTER_AMOUNT * DIMENSION);
+    for (auto & value : centers) {
+        value = center_distribution(generator);
+    }
+
+    p_dimension = DIMENSION;
+    p_points.resize(POINT_AMOUNT * DIMENSION);
+    for (std::size_t i = 0; i < POINT_AMOUNT; i++) {
+        const double * center = centers.data() + (i % CENTER_AMOUNT) * DIMENSION;
+        for (std::size_t j = 0; j < DIMENSION; j++) {
+            p_points[i * DIMENSION + j] = center[j] + distribution(generator);
+        }
+    }
+}
+
+
+double knn_recall(const std::vector<flat_kdtree::neighbor_sequence> & p_expected, const std::vector<hnsw_index::neighbor_sequence> & p_actual) {
+    std::size_t found = 0;
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < p_expected.size(); i++) {
+        /* ties are counted by distance, so the same distance of another point is not a miss */
+        const double border = p_expected[i].back().m_distance * (1.0 + 1e-9);
+        for (const auto & neighbor : p_actual[i]) {
+            found += (neighbor.m_distance <= border) ? 1 : 0;
+        }
+
+        total += p_expected[i].size();
+    }
+
+    return static_cast<double>(found) / static_cast<double>(total);
+}
+
+
+std::size_t count_neighbors(const std::vector<point_neighbor_sequence> & p_result) {
+    std::size_t amount = 0;
+    for (const auto & neighbors : p_result) {
+        amount += neighbors.size();
+    }
+
+    return amount;
+}
+
+
+}
+
+
+int main(int argc, char * argv[]) {
+    std::vector<double> points;
+    std::size_t dimension = 0;
+
+    if (argc > 1) {
+        if (!read_feature_cache(argv[1], points, dimension)) {
+            std::fprintf(stderr, "Cannot read feature cache: %s\n", argv[1]);
+            return 1;
+        }
+    }
+    else {
+        generate(points, dimension);
+    }
+
+    const std::size_t amount = points.size() / dimension;
+    const points_view<double> view(points.data(), amount, dimension, dimension);
+
+    /* queries are spread over the whole data */
+    const std::size_t query_amount = std::min(QUERY_AMOUNT, amount);
+    const std::size_t query_step = amount / query_amount;
+    const points_view<double> queries(points.data(), query_amount, dimension, dimension * query_step);
+
+    std::printf("points: %zu, dimension: %zu, queries: %zu, neighbors: %zu\n", amount, dimension, query_amount, NEIGHBOR_AMOUNT);
+
+    flat_kdtree tree;
+    const double tree_build = measure([&view, &tree]() { tree = flat_kdtree(view); });
+
+    hnsw_index index;
+    const double index_build = measure([&view, &index]() { index = hnsw_index(view); });
+
+    std::printf("build: kdtree %.1f ms, hnsw %.1f ms\n", tree_build, index_build);
+
+    std::vector<flat_kdtree::neighbor_sequence> expected;
+    const double tree_knn = measure([&]() { tree.knn_search(queries, NEIGHBOR_AMOUNT, expected); });
+
+    /* radius that gives about ten times more neighbors than kNN queries, as used by density based algorithms */
+    std::vector<flat_kdtree::neighbor_sequence> wide;
+    tree.knn_search(queries, 10 * NEIGHBOR_AMOUNT, wide);
+
+    std::vector<double> distances;
+    for (const auto & neighbors : wide) {
+        distances.push_back(neighbors.back().m_distance);
+    }
+
+    std::nth_element(distances.begin(), distances.begin() + distances.size() / 2, distances.end());
+    const double radius = std::sqrt(distances[distances.size() / 2]);
+
+    std::vector<flat_kdtree::neighbor_sequence> expected_radius;
+    const double tree_radius = measure([&]() { tree.radius_search(queries, radius, expected_radius); });
+    const std::size_t expected_amount = count_neighbors(expected_radius);
+
+    std::printf("kdtree: knn %.1f ms, radius %.1f ms (%zu neighbors)\n", tree_knn, tree_radius, expected_amount);
+    std::printf("  ef     knn ms  recall   radius ms  recall\n");
+
+    for (const std::size_t ef : EF_SEARCH) {
+        index.set_ef_search(ef);
+
+        std::vector<hnsw_index::neighbor_sequence> actual;
+        const double index_knn = measure([&]() { index.knn_search(queries, NEIGHBOR_AMOUNT, actual); });
+
+        std::vector<hnsw_index::neighbor_sequence> actual_radius;
+        const double index_radius = measure([&]() { index.radius_search(queries, radius, actual_radius); });
+
+        std::printf("%4zu  %9.1f  %6.4f  %10.1f  %6.4f\n", ef, index_knn, knn_recall(expected, actual),
+            index_radius, static_cast<double>(count_neighbors(actual_radius)) / static_cast<double>(expected_amount));
+    }
+
+    const std::string path = "hnsw_benchmark.index";
+    hnsw_index loaded;
+    const double save_time = measure([&]() { index.save(path); });
+    const double load_time = measure([&]() { loaded.load(path); });
+    std::remove(path.c_str());
+
+    std::printf("save %.1f ms, load %.1f ms\n", save_time, load_time);
+
+    return 0;
+}
@@ -0,0 +1,184 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+/*
+ * Benchmark of the static KD-tree against the node based KD-tree. For every dimension both trees are built
+ * for the same points, radius is chosen so that queries find about NEIGHBOR_AMOUNT neighbors. Results of the
+ * radius queries are compared between the trees and results of kNN queries are compared with exhaustive search.
+ */
+
+
+#include <pyclustering/container/flat_kdtree.hpp>
+#include <pyclustering/container/kdtree.hpp>
+
+#include <pyclustering/utils/metric.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+
+using namespace pyclustering;
+using namespace pyclustering::container;
+using namespace pyclustering::utils::metric;
+
+
+namespace {
+
+
+const std::size_t POINT_AMOUNT = 100000;
+const std::size_t QUERY_AMOUNT = 1000;
+const std::size_t NEIGHBOR_AMOUNT = 16;
+const std::size_t CHECKED_QUERY_AMOUNT = 50;
+const std::size_t CENTER_AMOUNT = 32;
+const std::size_t DIMENSIONS[] = { 2, 4, 8, 16, 32, 64, 128, 256 };
+
+
+template <typename TypeAction>
+double measure(const TypeAction & p_action) {
+    const auto begin = std::chrono::steady_clock::now();
+    p_action();
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+
+/* mixture of gaussian clusters, similar to image features */
+dataset generate(const std::size_t p_dimension, std::mt19937 & p_generator) {
+    std::uniform_real_distribution<double> center_distribution(-10.0, 10.0);
+    std::normal_distribution<double> distribution(0.0, 1.0);
+
+    dataset centers(CENTER_AMOUNT, point(p_dimension));
+    for (auto & center : centers) {
+        for (auto & value : center) {
+            value = center_distribution(p_generator);
+        }
+    }
+
+    dataset points(POINT_AMOUNT, point(p_dimension));
+    for (std::size_t i = 0; i < POINT_AMOUNT; i++) {
+        const point & center = centers[i % CENTER_AMOUNT];
+        for (std::size_t j = 0; j < p_dimension; j++) {
+            points[i][j] = center[j] + distribution(p_generator);
+        }
+    }
+
+    return points;
+}
+
+
+bool check_knn(const dataset & p_points, const flat_kdtree & p_tree) {
+    for (std::size_t i = 0; i < CHECKED_QUERY_AMOUNT; i++) {
+        std::vector<double> distances(p_points.size());
+        for (std::size_t j = 0; j < p_points.size(); j++) {
+            distances[j] = euclidean_distance_square(p_points[i], p_points[j]);
+        }
+
+        std::nth_element(distances.begin(), distances.begin() + NEIGHBOR_AMOUNT - 1, distances.end());
+
+        flat_kdtree::neighbor_sequence neighbors;
+        p_tree.knn_search(p_points[i].data(), NEIGHBOR_AMOUNT, neighbors);
+
+        const double expected = distances[NEIGHBOR_AMOUNT - 1];
+        if (std::fabs(neighbors.back().m_distance - expected) > 1e-9 * std::max(expected, 1.0)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+void run(const std::size_t p_dimension, std::mt19937 & p_generator) {
+    const dataset points = generate(p_dimension, p_generator);
+
+    std::vector<double> buffer;
+    const points_view<double> view = pack_points(points, buffer);
+    const points_view<double> queries(view.row(0), QUERY_AMOUNT, view.cols(), view.stride());
+
+    kdtree tree;
+    const double tree_build = measure([&points, &tree]() {
+        for (std::size_t i = 0; i < points.size(); i++) {
+            tree.insert(points[i], (void *) i);
+        }
+    });
+
+    flat_kdtree flat_tree;
+    const double flat_build = measure([&view, &flat_tree]() { flat_tree = flat_kdtree(view); });
+
+    std::vector<flat_kdtree::neighbor_sequence> knn_result;
+    const double flat_knn = measure([&]() { flat_tree.knn_search(queries, NEIGHBOR_AMOUNT, knn_result); });
+
+    std::vector<double> knn_distances;
+    for (const auto & neighbors : knn_result) {
+        knn_distances.push_back(neighbors.back().m_distance);
+    }
+
+    std::nth_element(knn_distances.begin(), knn_distances.begin() + knn_distances.size() / 2, knn_distances.end());
+    /* small margin keeps points out of the boundary where kernels may round differently */
+    const double radius = std::sqrt(knn_distances[knn_distances.size() / 2]) * 1.001;
+
+    std::size_t tree_found = 0;
+    const double tree_radius = measure([&]() {
+        for (std::size_t i = 0; i < QUERY_AMOUNT; i++) {
+            kdtree_searcher searcher(points[i], tree.get_root(), radius);
+            searcher.find_nearest([&tree_found](const kdnode::ptr &, const double) { tree_found++; });
+        }
+    });
+
+    std::size_t flat_found = 0;
+    const double flat_radius = measure([&]() {
+        for (std::size_t i = 0; i < QUERY_AMOUNT; i++) {
+            flat_tree.radius_search(points[i].data(), radius, [&flat_found](const std::size_t, const double) { flat_found++; });
+        }
+    });
+
+    std::vector<flat_kdtree::neighbor_sequence> radius_result;
+    const double flat_batch = measure([&]() { flat_tree.radius_search(queries, radius, radius_result); });
+
+    const bool correct = (tree_found == flat_found) && check_knn(points, flat_tree);
+
+    std::printf("%4zu  build %9.1f %8.1f ms  radius %9.1f %8.1f %8.1f ms  knn %8.1f ms  found %zu  %s\n",
+        p_dimension, tree_build, flat_build, tree_radius, flat_radius, flat_batch, flat_knn,
+        flat_found, correct ? "ok" : "MISMATCH");
+}
+
+
+}
+
+
+int main() {
+    std::printf("points: %zu, queries: %zu, neighbors: %zu\n", POINT_AMOUNT, QUERY_AMOUNT, NEIGHBOR_AMOUNT);
+    std::printf("dim   build kdtree/flat        radius kdtree/flat/flat batch    knn flat batch\n");
+
+    std::mt19937 generator(42);
+    for (const std::size_t dimension : DIMENSIONS) {
+        run(dimension, generator);
+    }
+
+    return 0;
+}
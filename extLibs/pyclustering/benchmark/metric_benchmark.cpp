@@ -0,0 +1,123 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+/*
+ * Micro-benchmark of the distance kernels. Every kernel that is available on the processor is compared
+ * against the scalar kernel for the typical feature vector lengths (KAZE descriptors are 5 x 64 values).
+ */
+
+
+#include <pyclustering/utils/metric_simd.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+
+using namespace pyclustering::utils::metric::simd;
+
+
+namespace {
+
+
+const std::size_t POINT_AMOUNT = 512;
+const std::size_t CALL_AMOUNT = 2000000;
+const std::size_t DIMENSIONS[] = { 16, 64, 256, 320 };
+const instruction_set INSTRUCTION_SETS[] = { instruction_set::SCALAR, instruction_set::SSE2, instruction_set::AVX2, instruction_set::AVX512 };
+
+
+template <typename TypeValue>
+struct benchmark_metric {
+    const char * name;
+    distance_kernel<TypeValue> kernel_set<TypeValue>::* kernel;
+};
+
+
+template <typename TypeValue>
+double measure(const distance_kernel<TypeValue> p_kernel, const std::vector<TypeValue> & p_data, const std::size_t p_dimension, double & p_checksum) {
+    const std::size_t calls = CALL_AMOUNT * 16 / p_dimension;
+
+    const auto begin = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < calls; i++) {
+        const std::size_t index1 = i % POINT_AMOUNT;
+        const std::size_t index2 = (i * 7 + 1) % POINT_AMOUNT;
+        p_checksum += p_kernel(p_data.data() + index1 * p_dimension, p_data.data() + index2 * p_dimension, p_dimension);
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - begin).count() / (double) calls;
+}
+
+
+template <typename TypeValue>
+void run(const char * p_type_name) {
+    const benchmark_metric<TypeValue> metrics[] = {
+        { "euclidean_square", &kernel_set<TypeValue>::euclidean_distance_square },
+        { "manhattan",        &kernel_set<TypeValue>::manhattan_distance },
+        { "chebyshev",        &kernel_set<TypeValue>::chebyshev_distance },
+        { "canberra",         &kernel_set<TypeValue>::canberra_distance },
+        { "chi_square",       &kernel_set<TypeValue>::chi_square_distance }
+    };
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+    double checksum = 0.0;
+    for (const std::size_t dimension : DIMENSIONS) {
+        std::vector<TypeValue> data(POINT_AMOUNT * dimension);
+        for (auto & value : data) {
+            value = (TypeValue) distribution(generator);
+        }
+
+        for (const auto & metric : metrics) {
+            const double scalar_time = measure(get_kernels<TypeValue>(instruction_set::SCALAR).*metric.kernel, data, dimension, checksum);
+
+            for (const instruction_set isa : INSTRUCTION_SETS) {
+                const kernel_set<TypeValue> & kernels = get_kernels<TypeValue>(isa);
+                if (kernels.isa != isa) {
+                    continue;   /* not supported by the processor */
+                }
+
+                const double time = (isa == instruction_set::SCALAR) ? scalar_time : measure(kernels.*metric.kernel, data, dimension, checksum);
+                std::printf("%-7s %4zu  %-17s %-7s %9.2f ns  x%.2f\n", p_type_name, dimension, metric.name,
+                    instruction_set_name(isa), time, scalar_time / time);
+            }
+        }
+    }
+
+    std::printf("checksum: %g\n\n", checksum);
+}
+
+
+}
+
+
+int main() {
+    std::printf("detected instruction set: %s\n\n", instruction_set_name(detect_instruction_set()));
+
+    run<double>("double");
+    run<float>("float");
+
+    return 0;
+}
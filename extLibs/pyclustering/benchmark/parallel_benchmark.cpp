@@ -0,0 +1,128 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+/*
+ * Micro-benchmark of the parallel loops. Overhead of a single call of parallel_for with a trivial task is
+ * measured for the persistent loop pool and for the previous implementation that started std::async per chunk.
+ */
+
+
+#include <pyclustering/parallel/parallel.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <thread>
+#include <vector>
+
+
+using namespace pyclustering::parallel;
+
+
+namespace {
+
+
+const std::size_t CALL_AMOUNT = 2000;
+const std::size_t ITERATION_AMOUNTS[] = { 16, 1024, 65536 };
+
+
+/* previous implementation: every call starts a new asynchronous task per chunk */
+template <typename TypeIndex, typename TypeAction>
+void async_parallel_for(const TypeIndex p_start, const TypeIndex p_end, const TypeAction & p_task) {
+    const std::size_t amount_threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1) - 1;
+    const TypeIndex step = (p_end - p_start) / (TypeIndex) (amount_threads + 1);
+
+    std::vector<std::future<void>> futures;
+    TypeIndex current_start = p_start;
+    for (std::size_t i = 0; i < amount_threads; i++) {
+        const TypeIndex current_end = current_start + step;
+        futures.push_back(std::async(std::launch::async, [&p_task, current_start, current_end]() {
+            for (TypeIndex i = current_start; i < current_end; ++i) {
+                p_task(i);
+            }
+        }));
+
+        current_start = current_end;
+    }
+
+    for (TypeIndex i = current_start; i < p_end; ++i) {
+        p_task(i);
+    }
+
+    for (auto & future : futures) {
+        future.get();
+    }
+}
+
+
+template <typename TypeLoop>
+double measure(const TypeLoop & p_loop, const std::size_t p_iterations, std::vector<double> & p_values) {
+    const auto begin = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < CALL_AMOUNT; i++) {
+        p_loop(std::size_t(0), p_iterations, [&p_values](const std::size_t p_index) {
+            p_values[p_index] += 1.0;
+        });
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::micro>(end - begin).count() / (double) CALL_AMOUNT;
+}
+
+
+}
+
+
+int main() {
+    std::printf("threads: %zu\n", loop_pool::get_instance().get_amount_threads());
+    std::printf("%10s %16s %16s\n", "iterations", "async [us/call]", "pool [us/call]");
+
+    for (const std::size_t iterations : ITERATION_AMOUNTS) {
+        std::vector<double> values(iterations, 0.0);
+
+        const double async_time = measure([](const std::size_t p_start, const std::size_t p_end, const auto & p_task) {
+            async_parallel_for(p_start, p_end, p_task);
+        }, iterations, values);
+
+        const double pool_time = measure([](const std::size_t p_start, const std::size_t p_end, const auto & p_task) {
+            parallel_for(p_start, p_end, p_task);
+        }, iterations, values);
+
+        std::printf("%10zu %16.2f %16.2f\n", iterations, async_time, pool_time);
+    }
+
+    /* nested loops must finish even if all threads of the pool are busy with the outer loop */
+    std::atomic<std::size_t> nested_counter(0);
+    const auto begin = std::chrono::steady_clock::now();
+    parallel_for(std::size_t(0), std::size_t(64), [&nested_counter](const std::size_t) {
+        parallel_for(std::size_t(0), std::size_t(64), [&nested_counter](const std::size_t) {
+            nested_counter++;
+        });
+    });
+    const auto end = std::chrono::steady_clock::now();
+
+    std::printf("nested 64 x 64: %zu iterations in %.2f us\n", nested_counter.load(), std::chrono::duration<double, std::micro>(end - begin).count());
+
+    return 0;
+}
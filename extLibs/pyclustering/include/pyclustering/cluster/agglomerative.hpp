@@ -23,6 +23,7 @@
 #pragma once
 
 
+#include <limits>
 #include <vector>
 
 #include <pyclustering/cluster/cluster_algorithm.hpp>
@@ -54,15 +55,34 @@ enum class type_link {
 /**
 *
 * @brief    Agglomerative algorithm implementation that is used bottom up approach for clustering.
-* @details  The algorithm related to hierarchical class.
+* @details  The algorithm related to hierarchical class. Single link is processed using minimum spanning tree,
+*           complete and average links are processed using nearest-neighbor chain on the condensed distance matrix
+*           that is updated by Lance-Williams formulas, both need O(n^2) time. Centroid link is processed by
+*           exhaustive search of the closest centers.
 *
 */
 class agglomerative : public cluster_algorithm {
+private:
+    /**
+    *
+    * @brief    Merge of two clusters, clusters are identified by the index of any of their points.
+    *
+    */
+    struct merge_step {
+        std::size_t     m_index1    = 0;
+        std::size_t     m_index2    = 0;
+        double          m_distance  = 0.0;
+    };
+
+    using merge_sequence = std::vector<merge_step>;
+
 private:
     size_t                  m_number_clusters;
 
     type_link               m_similarity;
 
+    double                  m_distance_threshold;   /* square of the distance, clusters whose link distance is greater are not merged */
+
     dataset                 m_centers;
 
     cluster_sequence        * m_ptr_clusters;
@@ -88,6 +108,17 @@ public:
     */
     agglomerative(const size_t number_clusters, const type_link link);
 
+    /**
+    *
+    * @brief    Constructor of clustering algorithm where merging is also limited by the distance between clusters.
+    *
+    * @param[in] number_clusters: minimal amount of clusters that should be allocated.
+    * @param[in] link: type of linking clustering during processing.
+    * @param[in] distance_threshold: clusters whose link distance is greater than the threshold are not merged.
+    *
+    */
+    agglomerative(const size_t number_clusters, const type_link link, const double distance_threshold);
+
     /**
     *
     * @brief    Default destructor of the algorithm.
@@ -109,38 +140,40 @@ public:
 private:
     /**
     *
-    * @brief    Merges the most similar clusters in line with link type.
-    *
-    */
-    void merge_similar_clusters();
-
-    /**
+    * @brief    Merges the most similar clusters in line with centroid link type.
     *
-    * @brief    Merges the most similar clusters in line with average link type.
+    * @return   False if the closest clusters are farther than the distance threshold.
     *
     */
-    void merge_by_average_link();
+    bool merge_by_centroid_link();
 
     /**
     *
-    * @brief    Merges the most similar clusters in line with centroid link type.
+    * @brief    Calculates merges of single link using Prim's minimum spanning tree, distances are computed on the fly.
+    *
+    * @param[out] p_merges: merges of clusters in arbitrary order.
     *
     */
-    void merge_by_centroid_link();
+    void calculate_minimum_spanning_tree(merge_sequence & p_merges) const;
 
     /**
     *
-    * @brief    Merges the most similar clusters in line with complete link type.
+    * @brief    Calculates merges of complete or average link using nearest-neighbor chain.
+    * @details  Condensed distance matrix is updated by Lance-Williams formula after every merge.
+    *
+    * @param[out] p_merges: merges of clusters in arbitrary order.
     *
     */
-    void merge_by_complete_link();
+    void calculate_nearest_neighbor_chain(merge_sequence & p_merges) const;
 
     /**
     *
-    * @brief    Merges the most similar clusters in line with single link type.
+    * @brief    Applies the closest merges until required amount of clusters is reached or distance threshold is exceeded.
+    *
+    * @param[in] p_merges: merges of clusters, they are sorted by distance.
     *
     */
-    void merge_by_signle_link();
+    void apply_merges(merge_sequence & p_merges);
 
     /**
     *
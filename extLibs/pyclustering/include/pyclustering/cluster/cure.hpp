@@ -20,21 +20,24 @@
 *
 */
 
+
 #pragma once
 
 
-#include <algorithm>
-#include <list>
-#include <set>
+#include <cstddef>
+#include <limits>
 #include <vector>
 
-#include <pyclustering/container/kdtree.hpp>
+#include <pyclustering/container/indexed_heap.hpp>
 
 #include <pyclustering/cluster/cluster_algorithm.hpp>
 #include <pyclustering/cluster/cure_data.hpp>
 
+#include <pyclustering/utils/distance_matrix.hpp>
+
 
 using namespace pyclustering::container;
+using namespace pyclustering::utils::metric;
 
 
 namespace pyclustering {
@@ -44,278 +47,163 @@ namespace clst {
 
 /**
 *
-* @brief   Cure cluster description.
+* @brief   Agglomerative merging of CURE clusters that are stored in contiguous arrays and referenced by indexes.
+* @details Each cluster owns fixed slot for its mean, scattered points and representative points, so merging
+*          does not allocate: merged cluster takes slot of the first cluster and slot of the second one is
+*          released. Points of clusters are linked into lists that are concatenated in O(1). Scattered points of
+*          merged cluster are chosen from scattered points of both clusters as it is proposed by the authors of CURE,
+*          representative points are scattered points moved towards the mean by compression.
+*
+*          Clusters are ordered by indexed heap where key is distance to the closest cluster.
 *
 */
-struct cure_cluster {
+class cure_arena {
 public:
-    std::vector<double> * mean;
-    std::vector< std::vector<double> * > * points;
-    std::vector< std::vector<double> * > * rep;
+    static constexpr std::size_t NONE_INDEX = std::numeric_limits<std::size_t>::max();
 
-    cure_cluster *          closest;
-    double                  distance_closest;
+private:
+    points_view<double>         m_points;
 
-public:
-    /**
-    *
-    * @brief   Default constructor of cure cluster.
-    *
-    */
-    cure_cluster();
+    std::size_t                 m_dimension             = 0;
 
-    /**
-    *
-    * @brief   Default constructor of cure cluster that corresponds to specified point.
-    *
-    */
-    explicit cure_cluster(std::vector<double> * point);
+    std::size_t                 m_number_repr_points    = 0;
 
-    /**
-    *
-    * @brief   Default destructor.
-    *
-    */
-    ~cure_cluster();
+    double                      m_compression           = 0.0;
 
-    /**
-    *
-    * @brief   Default copy constructor.
-    *
-    */
-    cure_cluster(const cure_cluster & p_other) = delete;
+    std::vector<double>         m_means                 = { };      /* cluster x D */
 
-    /**
-    *
-    * @brief   Insert points to cluster.
-    *
-    */
-    void insert_points(std::vector<std::vector<double> *> * append_points);
+    std::vector<double>         m_scattered             = { };      /* slot of each cluster x D, slot holds up to R points */
 
-public:
-    cure_cluster & operator=(const cure_cluster & p_other) = delete;
+    std::vector<double>         m_representors          = { };      /* slot of each cluster x D, the same layout as scattered points */
 
-    friend std::ostream & operator<<(std::ostream & p_stream, cure_cluster & p_cluster);
-};
+    std::vector<std::size_t>    m_slot                  = { };      /* position of the first point of the cluster slot */
 
+    std::vector<std::size_t>    m_slot_capacity         = { };      /* amount of points that fit into the cluster slot */
 
+    std::size_t                 m_released              = 0;        /* amount of points in slots that are not used anymore */
 
-/**
-*
-* @brief   Cluster comparator for set where pointers are stored.
-*
-*/
-class cure_cluster_comparator {
-public:
-    /**
-    *
-    * @brief   Defines compare procedure using closest distance without checking for nullptr.
-    *
-    * @param[in] obj1: pointer to left operand (cluster 1).
-    * @param[in] obj2: pointer to right operand (cluster 2).
-    *
-    * @return  Returns 'true' if left operand is less than right.
-    *
-    */
-    bool operator()(const cure_cluster * const obj1, const cure_cluster * const obj2) const;
-};
+    std::vector<std::size_t>    m_amount_representors   = { };
 
+    std::vector<std::size_t>    m_weight                = { };      /* amount of points in the cluster */
 
+    std::vector<std::size_t>    m_closest               = { };
 
-/**
-*
-* @brief   Cure sorted queue of cure clusters. Sorting is defined by distances between clusters.
-*          First element is always occupied by cluster whose distance to the neighbor cluster
-*          is the smallest in the queue.
-*
-*/
-class cure_queue {
-private:
-    std::multiset<cure_cluster *, cure_cluster_comparator> * queue;
-    kdtree * tree;
+    std::vector<double>         m_closest_distance      = { };
 
-private:
-    /**
-    *
-    * @brief   Creates sorted queue of points for specified data.
-    *
-    * @param[in] data: pointer to points.
-    *
-    */
-    void create_queue(const dataset * data);
+    std::vector<std::size_t>    m_first_point           = { };
 
-    /**
-    *
-    * @brief   Remove representative points of specified cluster from KD Tree.
-    *
-    * @param[in] cluster: pointer to points.
-    *
-    */
-    void remove_representative_points(cure_cluster * cluster);
+    std::vector<std::size_t>    m_last_point            = { };
 
-    /**
-    *
-    * @brief   Insert representative points of specified cluster to KD tree.
-    *
-    * @param[in] cluster: pointer to points.
-    *
-    */
-    void insert_representative_points(cure_cluster * cluster);
+    std::vector<std::size_t>    m_next_point            = { };      /* next point of the same cluster */
 
-    /**
-    *
-    * @brief   Insert cluster to sorted queue (it's not insertion of new object).
-    * @details Used by sorting procedures.
-    *
-    * @param[in] inserted_cluster: pointer to points.
-    *
-    */
-    void insert_cluster(cure_cluster * inserted_cluster);
+    std::vector<std::size_t>    m_active                = { };      /* clusters that are not merged */
 
-    /**
-    *
-    * @brief   Remove cluster from sorted queue (it's not removing of new object). Used by sorting
-    *          procedures.
-    *
-    * @param[in] removed_cluster: pointer to points.
-    *
-    */
-    void remove_cluster(cure_cluster * removed_cluster);
+    std::vector<std::size_t>    m_active_position       = { };
 
-    /**
-    *
-    * @brief   Calculate distance between clusters.
-    *
-    * @param[in] cluster1: pointer to cure cluster 1.
-    * @param[in] cluster2: pointer to cure cluster 2.
-    *
-    * @return  Return distance between clusters.
-    *
-    */
-    static double get_distance(cure_cluster * cluster1, cure_cluster * cluster2);
+    indexed_heap                m_queue                 = indexed_heap(0);
+
+    std::vector<double>         m_candidates            = { };      /* scattered points of both merged clusters */
 
+    std::vector<double>         m_merged_distance       = { };      /* distance to the last merged cluster */
+
+    std::vector<char>           m_updated               = { };
+
+public:
     /**
     *
-    * @brief   Checks if all elements of a merged cluster are same.
+    * @brief   Creates empty arena for the points.
     *
-    * @param[in] merged_cluster: pointer to cure merged_cluster.
-    *
-    * @return  Returns true if all the elements in the cluster were found to be same.
+    * @param[in] p_points: points that are clustered, they are not copied and should be alive while arena is used.
+    * @param[in] p_number_repr_points: number of representative points in each cluster.
+    * @param[in] p_compression: level of compression for calculation of representative points.
     *
     */
-    static bool are_all_elements_same(cure_cluster * merged_cluster);
+    cure_arena(const points_view<double> & p_points, const std::size_t p_number_repr_points, const double p_compression);
 
 public:
-    using iterator        = std::multiset<cure_cluster *, cure_cluster_comparator>::iterator;
-    using const_iterator  = std::multiset<cure_cluster *, cure_cluster_comparator>::const_iterator;
-
     /**
     *
-    * @brief   Default constructor of cure queue (always keeps sorted state).
+    * @brief   Creates cluster for each point.
     *
     */
-    cure_queue();
+    void initialize();
 
     /**
     *
-    * @brief   Default constructor of sorted queue of cure clusters.
+    * @brief   Creates clusters from groups of points (for example from clusters of partitions).
     *
-    * @param[in] data: pointer to points.
+    * @param[in] p_groups: groups of indexes of points.
     *
     */
-    explicit cure_queue(const std::vector< std::vector<double> > * data);
+    void initialize(const cluster_sequence & p_groups);
 
     /**
     *
-    * @brief   Default copy constructor of sorted queue of cure clusters is forbidden.
+    * @brief   Merges the closest clusters until specified amount of clusters is reached.
     *
-    * @param[in] p_other: other cure queue to copy.
+    * @param[in] p_amount_clusters: amount of clusters that should remain.
     *
     */
-    cure_queue(const cure_queue & p_other) = delete;
+    void merge(const std::size_t p_amount_clusters);
 
     /**
     *
-    * @brief   Default destructor.
+    * @brief   Returns amount of clusters that are not merged.
     *
     */
-    ~cure_queue();
+    std::size_t size() const { return m_active.size(); }
 
     /**
     *
-    * @brief   Merge cure clusters in line with the rule of merging of cure algorithm.
+    * @brief   Returns clusters, index of each point is increased by offset.
     *
-    * @param[in|out] cluster1: pointer to cure cluster 1.
-    * @param[in|out] cluster2: pointer to cure cluster 2.
-    * @param[in] number_repr_points: number of representative points for merged cluster.
-    * @param[in] compression: level of compression for calculation representative points.
+    * @param[in]  p_offset: value that is added to indexes of points.
+    * @param[out] p_clusters: clusters whose points are sorted, clusters are ordered by their first point.
     *
     */
-    void merge(cure_cluster * cluster1, cure_cluster * cluster2, const size_t number_repr_points, const double compression);
+    void get_clusters(const std::size_t p_offset, cluster_sequence & p_clusters) const;
 
     /**
     *
-    * @brief   Returns iterator to the first CURE cluster.
+    * @brief   Returns representative points and means of clusters in the same order as 'get_clusters'.
     *
     */
-    inline iterator begin() { return queue->begin(); }
+    void get_representors(representor_sequence & p_representors, dataset & p_means) const;
 
-    /**
-    *
-    * @brief   Returns constant iterator to the first CURE cluster.
-    *
-    */
-    inline const_iterator begin() const { return queue->begin(); };
+private:
+    void allocate(const std::vector<std::size_t> & p_capacities);
 
-    /**
-    *
-    * @brief   Returns iterator to the end of CURE cluster collection (not a last element).
-    *
-    */
-    inline iterator end() { return queue->end(); }
+    void reserve_slot(const std::size_t p_cluster, const std::size_t p_capacity);
 
-    /**
-    *
-    * @brief   Returns constant iterator to the end of CURE cluster collection (not a last element).
-    *
-    */
-    inline const_iterator end() const { return queue->end(); }
+    void release_slot(const std::size_t p_cluster);
 
-    /**
-    *
-    * @brief   Returns amount of CURE clusters in the queue.
-    *
-    */
-    inline size_t size() const { return queue->size(); }
+    void compact_slots();
 
-public:
-    /**
-    *
-    * @brief   Copy assignment operator is forbidden.
-    *
-    * @param[in] p_other: other cure queue to copy.
-    *
-    */
-    cure_queue & operator=(const cure_queue & p_other) = delete;
-};
+    void create_cluster(const std::size_t p_cluster, const std::size_t * p_points, const std::size_t p_size);
 
+    void create_queue();
 
+    void merge_clusters(const std::size_t p_cluster1, const std::size_t p_cluster2);
 
-class relocation_info {
-private:
-    cure_queue::iterator m_cluster_iterator;
-    cure_cluster * m_closest_cluster;
-    double m_closest_distance;
+    void select_representors(const std::size_t p_cluster, const std::vector<const double *> & p_candidates);
 
-public:
-    relocation_info(const cure_queue::iterator & cluster_iterator, cure_cluster * closest_cluster, const double closest_distance);
+    double get_distance(const std::size_t p_cluster1, const std::size_t p_cluster2) const;
 
-public:
-    cure_queue::iterator get_cluster_iterator() const;
+    void find_closest(const std::size_t p_cluster, std::size_t & p_closest, double & p_distance) const;
+
+    std::vector<std::size_t> get_ordered_clusters() const;
+
+    const double * mean(const std::size_t p_cluster) const { return m_means.data() + p_cluster * m_dimension; }
+
+    double * mean(const std::size_t p_cluster) { return m_means.data() + p_cluster * m_dimension; }
+
+    const double * scattered(const std::size_t p_cluster) const { return m_scattered.data() + m_slot[p_cluster] * m_dimension; }
 
-    double get_closest_distance() const;
+    double * scattered(const std::size_t p_cluster) { return m_scattered.data() + m_slot[p_cluster] * m_dimension; }
 
-    cure_cluster * get_closest_cluster();
+    const double * representor(const std::size_t p_cluster) const { return m_representors.data() + m_slot[p_cluster] * m_dimension; }
+
+    double * representor(const std::size_t p_cluster) { return m_representors.data() + m_slot[p_cluster] * m_dimension; }
 };
 
 
@@ -323,19 +211,29 @@ public:
 /**
 *
 * @brief   CURE algorithm.
+* @details Large data is processed as it is proposed by the authors of CURE: random sample of points is split
+*          into partitions, each partition is clustered until amount of its clusters is reduced by the reduction
+*          factor, after that partial clusters of all partitions are merged into required amount of clusters.
+*          Points that are not in the sample are assigned to the cluster with the closest representative point.
+*          Memory consumption is defined by the size of the sample instead of the size of the data.
 *
 */
 class cure : public cluster_algorithm {
+public:
+    const static double         DEFAULT_REDUCTION;
+
 private:
-    cure_queue * queue;
+    std::size_t     number_points       = 0;
+
+    std::size_t     number_clusters     = 0;
 
-    size_t number_points;
+    double          compression         = 0.0;
 
-    size_t number_clusters;
+    std::size_t     sample_size         = 0;
 
-    double compression;
+    std::size_t     amount_partitions   = 1;
 
-    const dataset   * data;
+    double          reduction           = DEFAULT_REDUCTION;
 
 public:
     /**
@@ -356,12 +254,31 @@ public:
     */
     cure(const size_t clusters_number, const size_t points_number, const double level_compression);
 
+    /**
+    *
+    * @brief   Constructor of CURE solver that processes random sample of the data split into partitions.
+    *
+    * @param[in] clusters_number: number of clusters that should be allocated.
+    * @param[in] points_number: number of representative points in each cluster.
+    * @param[in] level_compression: level of compression for calculation new representative points for merged cluster.
+    * @param[in] p_sample_size: amount of points in the random sample, if 0 or not less than size of the data then all points are used.
+    * @param[in] p_amount_partitions: amount of partitions of the sample.
+    * @param[in] p_reduction: each partition is clustered until amount of its clusters is reduced by this factor.
+    *
+    */
+    cure(const size_t clusters_number,
+         const size_t points_number,
+         const double level_compression,
+         const std::size_t p_sample_size,
+         const std::size_t p_amount_partitions,
+         const double p_reduction = DEFAULT_REDUCTION);
+
     /**
     *
     * @brief   Default destructor.
     *
     */
-    virtual ~cure();
+    virtual ~cure() = default;
 
 public:
     /**
@@ -373,6 +290,40 @@ public:
     *
     */
     virtual void process(const dataset & p_data, cluster_data & p_result) override;
+
+    /**
+    *
+    * @brief    Performs cluster analysis of points that are stored in a contiguous buffer.
+    *
+    * @param[in]  p_points: input points for cluster analysis.
+    * @param[out] p_result: clustering result of the input points (cure_data).
+    *
+    */
+    void process(const points_view<double> & p_points, cluster_data & p_result);
+
+    /**
+    *
+    * @brief    Performs cluster analysis of single precision points that are stored in a contiguous buffer.
+    * @details  Only the sample is converted to double precision, points out of the sample are assigned in single precision.
+    *
+    * @param[in]  p_points: input points for cluster analysis.
+    * @param[out] p_result: clustering result of the input points (cure_data).
+    *
+    */
+    void process(const points_view<float> & p_points, cluster_data & p_result);
+
+private:
+    template <typename TypeValue>
+    void process_view(const points_view<TypeValue> & p_points, cluster_data & p_result);
+
+    void cluster_all(const points_view<double> & p_points, cure_data & p_result) const;
+
+    void cluster_all(const points_view<float> & p_points, cure_data & p_result) const;
+
+    void cluster_sample(const points_view<double> & p_sample, cure_data & p_result) const;
+
+    template <typename TypeValue>
+    void assign_points(const points_view<TypeValue> & p_points, const index_sequence & p_sample, cure_data & p_result) const;
 };
 
 
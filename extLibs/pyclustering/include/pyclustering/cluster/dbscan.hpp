@@ -26,7 +26,8 @@
 #include <cmath>
 #include <algorithm>
 
-#include <pyclustering/container/kdtree.hpp>
+#include <pyclustering/container/flat_kdtree.hpp>
+#include <pyclustering/container/hnsw_index.hpp>
 
 #include <pyclustering/cluster/cluster_algorithm.hpp>
 #include <pyclustering/cluster/dbscan_data.hpp>
@@ -53,19 +54,33 @@ class dbscan {
 private:
     const dataset       * m_data_ptr      = nullptr;       /* temporary pointer to input data that is used only during processing */
 
+    const utils::metric::points_view<double> * m_points_ptr = nullptr;  /* temporary pointer to input points stored in a contiguous buffer */
+
+    std::size_t         m_size            = 0;
+
     dbscan_data         * m_result_ptr    = nullptr;       /* temporary pointer to clustering result that is used only during processing */
 
     std::vector<bool>   m_visited         = { };
 
     std::vector<bool>   m_belong          = { };
 
+    std::vector<bool>   m_queued          = { };    /* objects in the check list of the expanded cluster, reset after each expansion */
+
     double              m_initial_radius  = 0.0;    /* original radius that was specified by user */
 
     size_t              m_neighbors       = 0;
 
     dbscan_data_t       m_type            = dbscan_data_t::POINTS;
 
-    container::kdtree   m_kdtree          = container::kdtree();
+    bool                m_parallel        = false;  /* neighbors are computed concurrently and clusters are merged using union-find */
+
+    bool                m_approximate     = false;  /* neighbors of points are found by the approximate index instead of the kd-tree */
+
+    container::hnsw_parameters m_index_parameters = container::hnsw_parameters();
+
+    container::flat_kdtree m_kdtree       = container::flat_kdtree();
+
+    container::hnsw_index m_index         = container::hnsw_index();
 
 public:
     /**
@@ -83,9 +98,26 @@ public:
     * @param[in] p_radius_connectivity: connectivity radius between objects.
     * @param[in] p_minimum_neighbors: minimum amount of shared neighbors that is require to connect
     *             two object (if distance between them is less than connectivity radius).
+    * @param[in] p_parallel: if true then neighbors of all objects are obtained concurrently and
+    *             clusters are formed by merging neighboring core objects, otherwise clusters are
+    *             expanded sequentially.
+    *
+    */
+    dbscan(const double p_radius_connectivity, const size_t p_minimum_neighbors, const bool p_parallel = false);
+
+    /**
+    *
+    * @brief    Constructor of clustering algorithm where neighbors of points are found by approximate
+    *           nearest neighbor index (HNSW), it is faster than kd-tree for high-dimensional data.
+    *
+    * @param[in] p_radius_connectivity: connectivity radius between objects.
+    * @param[in] p_minimum_neighbors: minimum amount of shared neighbors that is require to connect
+    *             two object (if distance between them is less than connectivity radius).
+    * @param[in] p_index_parameters: parameters of the index, 'm_ef_search' trades recall for speed.
+    * @param[in] p_parallel: if true then neighbors of all objects are obtained concurrently.
     *
     */
-    dbscan(const double p_radius_connectivity, const size_t p_minimum_neighbors);
+    dbscan(const double p_radius_connectivity, const size_t p_minimum_neighbors, const container::hnsw_parameters & p_index_parameters, const bool p_parallel = false);
 
     /**
     *
@@ -116,7 +148,22 @@ public:
     */
     virtual void process(const dataset & p_data, const dbscan_data_t p_type, cluster_data & p_result);
 
+    /**
+    *
+    * @brief    Performs cluster analysis of points stored row by row in a contiguous buffer, points are
+    *           not copied.
+    *
+    * @param[in]  p_points: input points for cluster analysis, buffer should be valid during processing.
+    * @param[out] p_result: clustering result of an input data.
+    *
+    */
+    void process(const utils::metric::points_view<double> & p_points, cluster_data & p_result);
+
 private:
+    void process_input(cluster_data & p_result);
+
+    const double * get_point(const std::size_t p_index) const;
+
     /**
     *
     * @brief    Obtains neighbors of the specified node (data object).
@@ -131,9 +178,27 @@ private:
 
     void get_neighbors_from_distance_matrix(const size_t p_index, std::vector<size_t> & p_neighbors);
 
-    void create_kdtree(const dataset & p_data);
+    void create_kdtree();
+
+    void create_index();
 
     void expand_cluster(const std::size_t p_index, cluster & allocated_cluster);
+
+    /**
+    *
+    * @brief    Performs cluster analysis in two phases: neighbors of all objects are obtained
+    *           concurrently, after that neighboring core objects are merged using union-find
+    *           and border objects are attached to the cluster of their first core neighbor.
+    *
+    */
+    void process_parallel();
+
+    /**
+    *
+    * @brief    Performs cluster analysis by sequential expansion of clusters from core objects.
+    *
+    */
+    void process_sequential();
 };
 
 
@@ -29,6 +29,7 @@
 #include <pyclustering/cluster/cluster_algorithm.hpp>
 #include <pyclustering/cluster/kmeans_data.hpp>
 
+#include <pyclustering/utils/distance_matrix.hpp>
 #include <pyclustering/utils/metric.hpp>
 
 
@@ -39,6 +40,23 @@ namespace pyclustering {
 
 namespace clst {
 
+/**
+*
+* @brief    Strategy that is used to assign points to the closest centers.
+* @details  Hamerly and Elkan strategies skip distance calculations using the triangle inequality, they keep
+*            one (Hamerly) or K (Elkan) lower bounds for each point and produce the same clusters as Lloyd.
+*            Bounds are defined for the Euclidean distance, so assignment is always performed in line with the
+*            Euclidean distance, metric is used for the stop condition and for the within-cluster error.
+*
+*/
+enum class kmeans_assignment {
+    LLOYD,
+    HAMERLY,
+    ELKAN,
+    AUTOMATIC       /* Hamerly for small amount of clusters or if Elkan bounds do not fit the memory limit, otherwise Elkan */
+};
+
+
 /**
 *
 * @brief    Represents K-Means clustering algorithm for cluster analysis.
@@ -51,6 +69,10 @@ public:
 
     const static std::size_t        DEFAULT_ITERMAX;
 
+    const static std::size_t        HAMERLY_MAX_CLUSTERS;       /* automatic assignment uses Hamerly up to this amount of clusters */
+
+    const static std::size_t        ELKAN_MAX_BOUNDS;           /* automatic assignment uses Elkan only if N * K lower bounds fit this limit */
+
 private:
     double                  m_tolerance             = DEFAULT_TOLERANCE;
 
@@ -66,6 +88,8 @@ private:
 
     distance_metric<point>  m_metric;
 
+    kmeans_assignment       m_assignment            = kmeans_assignment::LLOYD;
+
 public:
     /**
     *
@@ -84,12 +108,14 @@ public:
     *             cluster centers is less than tolerance than algorithm will stop processing.
     * @param[in] p_itermax: maximum number of iterations (by default kmeans::DEFAULT_ITERMAX).
     * @param[in] p_metric: distance metric calculator for two points.
+    * @param[in] p_assignment: strategy that is used to assign points to the closest centers.
     *
     */
     kmeans(const dataset & p_initial_centers, 
            const double p_tolerance = DEFAULT_TOLERANCE,
            const std::size_t p_itermax = DEFAULT_ITERMAX,
-           const distance_metric<point> & p_metric = distance_metric_factory<point>::euclidean_square());
+           const distance_metric<point> & p_metric = distance_metric_factory<point>::euclidean_square(),
+           const kmeans_assignment p_assignment = kmeans_assignment::LLOYD);
 
     /**
     *
@@ -124,7 +150,47 @@ public:
     */
     virtual void process(const dataset & p_data, const index_sequence & p_indexes, cluster_data & p_result);
 
+    /**
+    *
+    * @brief    Performs cluster analysis of points that are stored in a contiguous buffer without copying them.
+    * @details  Points are assigned by the bounded algorithm (Lloyd strategy means full search on each step),
+    *            evolution of clusters and centers is not collected.
+    *
+    * @param[in]     p_points: input points for cluster analysis.
+    * @param[in|out] p_result: clustering result of the input points.
+    *
+    */
+    virtual void process(const points_view<double> & p_points, cluster_data & p_result);
+
+    /**
+    *
+    * @brief    Performs cluster analysis of single precision points without converting them, centers are kept
+    *            in single precision for distance calculation and are accumulated in double precision.
+    *
+    * @param[in]     p_points: input points for cluster analysis.
+    * @param[in|out] p_result: clustering result of the input points.
+    *
+    */
+    virtual void process(const points_view<float> & p_points, cluster_data & p_result);
+
 private:
+    kmeans_assignment choose_assignment(const std::size_t p_amount_points) const;
+
+    template <typename TypeValue>
+    void process_view(const points_view<TypeValue> & p_points, cluster_data & p_result);
+
+    /**
+    *
+    * @brief    Performs K-Means where centers are updated incrementally and distances are pruned by bounds.
+    *
+    * @param[in]  p_points: input points.
+    * @param[out] p_result: clusters (indexes of rows of the input points), centers and within-cluster error,
+    *              empty clusters are removed together with their centers.
+    *
+    */
+    template <typename TypeValue>
+    void process_bounded(const points_view<TypeValue> & p_points, kmeans_data & p_result);
+
     void update_clusters(const dataset & p_centers, cluster_sequence & p_clusters);
 
     double update_centers(const cluster_sequence & clusters, dataset & centers);
@@ -0,0 +1,238 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#pragma once
+
+
+#include <vector>
+
+#include <pyclustering/cluster/cluster_algorithm.hpp>
+#include <pyclustering/cluster/kmeans_data.hpp>
+
+#include <pyclustering/utils/distance_matrix.hpp>
+
+
+using namespace pyclustering::utils::metric;
+
+
+namespace pyclustering {
+
+namespace clst {
+
+/**
+*
+* @brief    Represents mini-batch K-Means algorithm that updates centers by small batches of points.
+* @details  Points are not stored by the algorithm, so data can be streamed batch by batch from a source
+*            that does not fit the memory. Memory consumption is O(K * D + batch size): centers, amount of points
+*            that have been assigned to each center and points that are collected to initialize centers by K-Means++.
+*            Each point of a batch moves its closest center towards itself with learning rate 1 / (points assigned to the center).
+*
+*            Methods are not thread-safe, batches should be passed sequentially.
+*
+*/
+class minibatch_kmeans : public cluster_algorithm {
+public:
+    const static std::size_t        DEFAULT_BATCH_SIZE;
+
+    const static std::size_t        DEFAULT_ITERMAX;
+
+private:
+    std::size_t                 m_amount_clusters   = 0;
+
+    std::size_t                 m_batch_size        = DEFAULT_BATCH_SIZE;
+
+    std::size_t                 m_itermax           = DEFAULT_ITERMAX;
+
+    std::size_t                 m_dimension         = 0;
+
+    std::vector<double>         m_centers           = { };      /* K x D, empty until centers are initialized */
+
+    std::vector<std::size_t>    m_counts            = { };      /* amount of points that have been assigned to each center */
+
+    std::vector<double>         m_seed_points       = { };      /* points that are collected to initialize centers */
+
+public:
+    /**
+    *
+    * @brief    Default constructor of clustering algorithm.
+    *
+    */
+    minibatch_kmeans() = default;
+
+    /**
+    *
+    * @brief    Constructor of clustering algorithm where algorithm parameters for processing are specified.
+    *
+    * @param[in] p_amount_clusters: amount of clusters that should be allocated.
+    * @param[in] p_batch_size: amount of points in a batch that is used by the processing, centers are initialized
+    *             when max(p_amount_clusters, p_batch_size) points have been passed.
+    * @param[in] p_itermax: amount of batches that are used by the processing.
+    *
+    */
+    minibatch_kmeans(const std::size_t p_amount_clusters,
+                     const std::size_t p_batch_size = DEFAULT_BATCH_SIZE,
+                     const std::size_t p_itermax = DEFAULT_ITERMAX);
+
+    /**
+    *
+    * @brief    Default destructor of the algorithm.
+    *
+    */
+    virtual ~minibatch_kmeans() = default;
+
+public:
+    /**
+    *
+    * @brief    Performs cluster analysis of an input data from scratch using random batches.
+    *
+    * @param[in]  p_data: input data for cluster analysis.
+    * @param[out] p_result: clustering result of an input data (kmeans_data).
+    *
+    */
+    virtual void process(const dataset & p_data, cluster_data & p_result) override;
+
+    /**
+    *
+    * @brief    Performs cluster analysis of points that are stored in a contiguous buffer from scratch using random batches.
+    *
+    * @param[in]  p_points: input points for cluster analysis.
+    * @param[out] p_result: clustering result of the input points (kmeans_data).
+    *
+    */
+    void process(const points_view<double> & p_points, cluster_data & p_result);
+
+    /**
+    *
+    * @brief    Performs cluster analysis of single precision points, only batches are converted to double precision.
+    *
+    * @param[in]  p_points: input points for cluster analysis.
+    * @param[out] p_result: clustering result of the input points (kmeans_data).
+    *
+    */
+    void process(const points_view<float> & p_points, cluster_data & p_result);
+
+    /**
+    *
+    * @brief    Updates centers by the batch of points.
+    * @details  Points are only collected until centers are initialized.
+    *
+    * @param[in] p_batch: batch of points, the dimension must be the same for all batches.
+    *
+    */
+    void partial_fit(const points_view<double> & p_batch);
+
+    /**
+    *
+    * @brief    Updates centers by the batch of points.
+    *
+    * @param[in] p_batch: batch of points, the dimension must be the same for all batches.
+    *
+    */
+    void partial_fit(const dataset & p_batch);
+
+    /**
+    *
+    * @brief    Returns true if enough points have been passed to initialize centers.
+    *
+    */
+    bool is_initialized() const;
+
+    /**
+    *
+    * @brief    Assigns points to the closest centers.
+    *
+    * @param[in]  p_points: points that should be assigned.
+    * @param[out] p_labels: index of the closest center for each point.
+    *
+    */
+    void predict(const points_view<double> & p_points, index_sequence & p_labels) const;
+
+    /**
+    *
+    * @brief    Assigns single precision points to the closest centers.
+    *
+    * @param[in]  p_points: points that should be assigned.
+    * @param[out] p_labels: index of the closest center for each point.
+    *
+    */
+    void predict(const points_view<float> & p_points, index_sequence & p_labels) const;
+
+    /**
+    *
+    * @brief    Assigns points to the closest centers and stores them as clustering result.
+    * @details  Empty clusters are removed together with their centers, within-cluster error is the sum of
+    *            square Euclidean distances.
+    *
+    * @param[in]  p_points: points that should be assigned.
+    * @param[out] p_result: clustering result of the points (kmeans_data).
+    *
+    */
+    void assign(const points_view<double> & p_points, cluster_data & p_result) const;
+
+    /**
+    *
+    * @brief    Assigns single precision points to the closest centers and stores them as clustering result.
+    *
+    * @param[in]  p_points: points that should be assigned.
+    * @param[out] p_result: clustering result of the points (kmeans_data).
+    *
+    */
+    void assign(const points_view<float> & p_points, cluster_data & p_result) const;
+
+    /**
+    *
+    * @brief    Returns current centers, empty if centers are not initialized.
+    *
+    */
+    dataset get_centers() const;
+
+    /**
+    *
+    * @brief    Forgets centers and collected points, so the next batch starts new cluster analysis.
+    *
+    */
+    void reset();
+
+private:
+    template <typename TypeValue>
+    void process_view(const points_view<TypeValue> & p_points, cluster_data & p_result);
+
+    template <typename TypeValue>
+    void predict_view(const points_view<TypeValue> & p_points, index_sequence & p_labels) const;
+
+    template <typename TypeValue>
+    void assign_view(const points_view<TypeValue> & p_points, cluster_data & p_result) const;
+
+    /* centers are returned in place, for single precision they are converted to the buffer */
+    points_view<double> centers_view(std::vector<double> & p_buffer) const;
+
+    points_view<float> centers_view(std::vector<float> & p_buffer) const;
+
+    void initialize_centers();
+
+    void update_centers(const points_view<double> & p_batch);
+};
+
+
+}
+
+}
@@ -24,16 +24,18 @@
 #pragma once
 
 
-#include <list>
-#include <set>
-#include <tuple>
+#include <vector>
 
-#include <pyclustering/container/kdtree.hpp>
+#include <pyclustering/container/indexed_heap.hpp>
+#include <pyclustering/container/flat_kdtree.hpp>
+#include <pyclustering/container/hnsw_index.hpp>
 
 #include <pyclustering/cluster/cluster_algorithm.hpp>
 #include <pyclustering/cluster/optics_data.hpp>
 #include <pyclustering/cluster/optics_descriptor.hpp>
 
+#include <pyclustering/utils/distance_matrix.hpp>
+
 
 namespace pyclustering {
 
@@ -59,6 +61,9 @@ enum class optics_data_t {
  *          for allocation required amount of clusters using this diagram. In case of usage additional input parameter 'amount of clusters' connectivity radius should be
  *          bigger than real - because it will be calculated by the algorithms.
  *
+ *          Neighborhoods and core distances of all objects are found in parallel before the ordering, the ordering
+ *          itself is sequential and keeps order seeds in an indexed binary heap with decrease-key.
+ *
  */
 class optics : public cluster_algorithm  {
 public:
@@ -84,11 +89,17 @@ private:
         }
     };
 
-    using neighbors_collection = std::multiset<neighbor_descriptor, neighbor_descriptor_less>;
+    using neighbors_collection = std::vector<neighbor_descriptor>;
 
 private:
     const dataset       * m_data_ptr        = nullptr;
 
+    const utils::metric::points_view<double> * m_points_ptr = nullptr;
+
+    const utils::metric::points_view<float> * m_points_float_ptr = nullptr;
+
+    std::size_t         m_size              = 0;
+
     optics_data         * m_result_ptr      = nullptr;
 
     double              m_radius            = 0.0;
@@ -99,11 +110,19 @@ private:
 
     optics_data_t       m_type              = optics_data_t::POINTS;
 
-    container::kdtree   m_kdtree            = container::kdtree();
+    container::flat_kdtree m_kdtree         = container::flat_kdtree();
+
+    bool                m_approximate       = false;    /* neighbors of points are found by the approximate index */
+
+    container::hnsw_parameters m_index_parameters = container::hnsw_parameters();
+
+    container::hnsw_index m_index           = container::hnsw_index();
 
     optics_object_sequence *            m_optics_objects    = nullptr;
 
-    std::list<optics_descriptor *>      m_ordered_database  = { };
+    std::vector<neighbors_collection>   m_neighborhoods     = { };
+
+    std::vector<optics_descriptor *>    m_ordered_database  = { };
 
 public:
     /**
@@ -150,6 +169,19 @@ public:
      */
     optics(const double p_radius, const std::size_t p_neighbors, const std::size_t p_amount_clusters);
 
+    /**
+     *
+     * @brief Creates algorithm that finds neighbors of points by approximate nearest neighbor index (HNSW).
+     *
+     * @param[in] p_radius: connectivity radius between objects.
+     * @param[in] p_neighbors: minimum amount of shared neighbors that is require to connect
+     *             two object (if distance between them is less than connectivity radius).
+     * @param[in] p_amount_clusters: amount of clusters that should be allocated, 0 if radius should not be changed.
+     * @param[in] p_index_parameters: parameters of the index, 'm_ef_search' trades recall for speed.
+     *
+     */
+    optics(const double p_radius, const std::size_t p_neighbors, const std::size_t p_amount_clusters, const container::hnsw_parameters & p_index_parameters);
+
     /**
      *
      * @brief Default destructor to destroy algorithm instance.
@@ -182,12 +214,41 @@ public:
     */
     virtual void process(const dataset & p_data, const optics_data_t p_type, cluster_data & p_result);
 
+    /**
+    *
+    * @brief    Performs cluster analysis of points stored row by row in a contiguous buffer.
+    * @details  Neighbors are found by exhaustive search with vectorized distance kernels instead of KD-tree,
+    *            which is faster for high-dimensional points.
+    *
+    * @param[in]  p_points: input points for cluster analysis.
+    * @param[out] p_result: clustering result of an input data (consists of allocated clusters,
+    *              cluster-ordering, noise and proper connectivity radius).
+    *
+    */
+    void process(const utils::metric::points_view<double> & p_points, cluster_data & p_result);
+
+    /**
+    *
+    * @brief    Performs cluster analysis of single precision points stored row by row in a contiguous buffer.
+    * @details  Distances are computed by single precision kernels that process twice as many coordinates
+    *            per instruction. Approximate index is built in double precision, so in that case points are
+    *            converted once before processing.
+    *
+    * @param[in]  p_points: input points for cluster analysis.
+    * @param[out] p_result: clustering result of an input data (consists of allocated clusters,
+    *              cluster-ordering, noise and proper connectivity radius).
+    *
+    */
+    void process(const utils::metric::points_view<float> & p_points, cluster_data & p_result);
+
 private:
+    void process_input(cluster_data & p_result);
+
     void initialize();
 
     void allocate_clusters();
 
-    void expand_cluster_order(optics_descriptor & p_object);
+    void expand_cluster_order(optics_descriptor & p_object, container::indexed_heap & p_order_seed);
 
     void extract_clusters();
 
@@ -197,15 +258,26 @@ private:
 
     void get_neighbors_from_distance_matrix(const std::size_t p_index, neighbors_collection & p_neighbors);
 
+    template <typename TypeValue>
+    void get_neighbors_from_view(const utils::metric::points_view<TypeValue> & p_points, const std::size_t p_index, neighbors_collection & p_neighbors);
+
+    void get_neighbors_from_index(const std::size_t p_index, neighbors_collection & p_neighbors);
+
+    void calculate_neighborhoods();
+
+    void symmetrize_neighborhoods();
+
     double get_core_distance(const neighbors_collection & p_neighbors) const;
 
-    void update_order_seed(const optics_descriptor & p_object, const neighbors_collection & p_neighbors, std::multiset<optics_descriptor *, optics_pointer_descriptor_less> & order_seed);
+    void update_order_seed(const optics_descriptor & p_object, container::indexed_heap & p_order_seed);
 
     void calculate_ordering();
 
     void calculate_cluster_result();
 
     void create_kdtree();
+
+    void create_index();
 };
 
 
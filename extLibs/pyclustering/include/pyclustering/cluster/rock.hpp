@@ -23,10 +23,14 @@
 #pragma once
 
 
+#include <memory>
+#include <queue>
+#include <unordered_map>
 #include <vector>
-#include <list>
 
-#include <pyclustering/container/adjacency_matrix.hpp>
+#include <pyclustering/container/adjacency.hpp>
+
+#include <pyclustering/utils/distance_matrix.hpp>
 
 #include <pyclustering/cluster/cluster_algorithm.hpp>
 
@@ -46,20 +50,43 @@ using rock_data = cluster_data;
 
 class rock : public cluster_algorithm {
 private:
-    /* for optimization list representation is of clusters is used and than
-     * it is moved to output result */
-    using rock_cluster_sequence = std::list<cluster>;
+    /* number of links from the cluster to other clusters, indexed by the cluster */
+    using rock_link_map = std::unordered_map<std::size_t, std::size_t>;
+
+    /**
+    *
+    * @brief    Pair of clusters that is a candidate for merging.
+    * @details  Candidate is outdated if any of clusters has been changed since the candidate was created.
+    *
+    */
+    struct rock_merge_candidate {
+        double          m_goodness  = 0.0;
+        std::size_t     m_cluster1  = 0;
+        std::size_t     m_cluster2  = 0;
+        std::size_t     m_version1  = 0;
+        std::size_t     m_version2  = 0;
+
+        bool operator<(const rock_merge_candidate & p_other) const;
+    };
+
+    using rock_merge_queue = std::priority_queue<rock_merge_candidate>;
 
 private:
-    adjacency_matrix        m_adjacency_matrix;
+    std::shared_ptr<adjacency_collection>   m_adjacency;    /* backend is selected by estimated density */
+
+    double                      m_radius;
 
-    double                  m_radius;
+    double                      m_degree_normalization;
 
-    double                  m_degree_normalization;
+    size_t                      m_number_clusters;
 
-    size_t                  m_number_clusters;
+    std::vector<cluster>        m_clusters;     /* merged clusters are left empty */
 
-    rock_cluster_sequence   m_clusters;
+    std::vector<rock_link_map>  m_links;
+
+    std::vector<std::size_t>    m_versions;
+
+    rock_merge_queue            m_queue;
 
 public:
     /**
@@ -101,45 +128,65 @@ public:
 private:
     /**
     *
-    * @brief    Creates adjacency matrix where each element described existence of link between points (means that points are neighbors).
+    * @brief    Creates adjacency collection where each element described existence of link between points (means that points are neighbors).
+    * @details  Adjacency list is used for sparse neighborhoods and bit matrix is used for dense neighborhoods.
     *
     * @param[in]  p_data: input data for cluster analysis.
     *
     */
-    void create_adjacency_matrix(const dataset & p_data);
+    void create_adjacency_collection(const dataset & p_data);
+
+    /**
+    *
+    * @brief    Estimates amount of one-way connections between points using a sample of points.
+    *
+    * @param[in]  p_points: points for cluster analysis.
+    *
+    */
+    std::size_t estimate_connections(const utils::metric::points_view<double> & p_points) const;
 
     /**
     *
-    * @brief    Finds two clusters that are most suitable candidates for merging and than merges them.
+    * @brief    Calculates links between all pairs of points as a product of the adjacency matrix with itself.
+    * @details  Number of links between two points is the number of their common neighbors, every point is a neighbor of itself.
+    *           Product is sparse unless neighborhoods are so dense that counting common bits of bit matrix rows is cheaper.
     *
     */
-    bool merge_cluster();
+    void calculate_links();
 
     /**
     *
-    * @brief    Returns number of link between two clusters.
-    * @details  Link between objects (points) exists only if distance between them less than connectivity radius.
+    * @brief    Merges the pair of clusters with the highest goodness measure.
+    *
+    * @return   False if there are no linked clusters that can be merged.
+    *
+    */
+    bool merge_cluster();
+
+    /**
     *
-    * @param[in] cluster1: the first cluster.
-    * @param[in] cluster2: the second cluster.
+    * @brief    Adds candidate for merging of two clusters to the queue.
     *
-    * @return Number of links between two clusters.
+    * @param[in] cluster1: index of the first cluster.
+    * @param[in] cluster2: index of the second cluster.
+    * @param[in] number_links: number of links between clusters.
     *
     */
-    size_t calculate_links(const cluster & cluster1, const cluster & cluster2) const;
+    void push_candidate(const std::size_t cluster1, const std::size_t cluster2, const std::size_t number_links);
 
     /**
     *
     * @brief    Calculates coefficient 'goodness measurement' between two clusters.
     * @details  The coefficient defines level of suitability of clusters for merging.
     *
-    * @param[in] cluster1: the first cluster.
-    * @param[in] cluster2: the second cluster.
+    * @param[in] number_links: number of links between clusters.
+    * @param[in] size_cluster1: size of the first cluster.
+    * @param[in] size_cluster2: size of the second cluster.
     *
     * @return Goodness measure between two clusters.
     *
     */
-    double calculate_goodness(const cluster & cluster1, const cluster & cluster2) const;
+    double calculate_goodness(const std::size_t number_links, const std::size_t size_cluster1, const std::size_t size_cluster2) const;
 };
 
 
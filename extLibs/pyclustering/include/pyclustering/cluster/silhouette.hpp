@@ -28,8 +28,11 @@
 
 #include <pyclustering/definitions.hpp>
 
+#include <pyclustering/utils/distance_matrix.hpp>
 #include <pyclustering/utils/metric.hpp>
 
+#include <utility>
+
 
 using namespace pyclustering::utils::metric;
 
@@ -55,11 +58,23 @@ private:
 
     distance_metric<point>    m_metric    = distance_metric_factory<point>::euclidean_square();
 
+    std::size_t               m_sample_size = 0;
+
 public:
     silhouette() = default;
 
     explicit silhouette(const distance_metric<point> & p_metric);
 
+    /**
+     *
+     * @brief   Creates silhouette that scores only a random sample of points and estimates the mean score.
+     *
+     * @param[in] p_metric: metric that is used to calculate difference between points.
+     * @param[in] p_sample_size: amount of randomly chosen points that are scored, if 0 then every point is scored.
+     *
+     */
+    silhouette(const distance_metric<point> & p_metric, const std::size_t p_sample_size);
+
     silhouette(const silhouette & p_other) = default;
 
     silhouette(silhouette && p_other) = default;
@@ -71,18 +86,37 @@ public:
 
     void process(const dataset & p_data, const cluster_sequence & p_clusters, const silhouette_data_t & p_type, silhouette_data & p_result);
 
+    /**
+     *
+     * @brief   Calculates silhouette scores of points stored in a contiguous buffer using square Euclidean distance.
+     * @details Sum of square distances from the point to the points of a cluster is obtained from the cluster center
+     *           and scatter, so scoring costs O(n * k * d) instead of O(n^2 * d). Metric of the instance is not used.
+     *
+     * @param[in]  p_points: input points.
+     * @param[in]  p_clusters: clusters of the points.
+     * @param[out] p_result: scores of points in order of the clusters.
+     *
+     */
+    void process(const points_view<double> & p_points, const cluster_sequence & p_clusters, silhouette_data & p_result);
+
 private:
+    using object_sequence = std::vector<std::pair<std::size_t, std::size_t>>;
+
+    void select_objects(object_sequence & p_objects) const;
+
+    void calculate_confidence_interval(const std::size_t p_population) const;
+
     double calculate_score(const std::size_t p_index_point, const std::size_t p_index_cluster) const;
 
-    void calculate_dataset_difference(const std::size_t p_index_point, std::vector<double> & p_dataset_difference) const;
+    double calculate_score(const std::size_t p_index_cluster, const std::vector<double> & p_cluster_difference) const;
 
-    double calculate_cluster_difference(const std::size_t p_index_cluster, const std::vector<double> & p_dataset_difference) const;
+    void calculate_cluster_difference(const std::size_t p_index_point, std::vector<double> & p_cluster_difference) const;
 
-    double calculate_within_cluster_score(const std::size_t p_index_cluster, const std::vector<double> & p_dataset_difference) const;
+    double calculate_within_cluster_score(const std::size_t p_index_cluster, const std::vector<double> & p_cluster_difference) const;
 
-    double calculate_cluster_score(const std::size_t p_index_cluster, const std::vector<double> & p_dataset_difference) const;
+    double calculate_cluster_score(const std::size_t p_index_cluster, const std::vector<double> & p_cluster_difference) const;
 
-    double caclulate_optimal_neighbor_cluster_score(const std::size_t p_index_cluster, const std::vector<double> & p_dataset_difference) const;
+    double caclulate_optimal_neighbor_cluster_score(const std::size_t p_index_cluster, const std::vector<double> & p_cluster_difference) const;
 };
 
 
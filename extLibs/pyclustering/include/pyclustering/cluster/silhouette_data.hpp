@@ -16,10 +16,21 @@ class silhouette_data {
 private:
     silhouette_sequence m_scores;
 
+    double              m_confidence_interval = 0.0;
+
 public:
    const silhouette_sequence & get_score() const { return m_scores; }
 
     silhouette_sequence & get_score() { return m_scores; }
+
+    /**
+     *
+     * @brief   Returns half-width of 95% confidence interval of the mean score, it is 0 if every point was scored.
+     *
+     */
+    double get_confidence_interval() const { return m_confidence_interval; }
+
+    void set_confidence_interval(const double p_confidence_interval) { m_confidence_interval = p_confidence_interval; }
 };
 
 
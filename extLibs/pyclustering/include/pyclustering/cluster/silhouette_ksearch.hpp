@@ -32,6 +32,12 @@ namespace pyclustering {
 namespace clst {
 
 
+/**
+ *
+ * @brief   Algorithm that allocates required amount of clusters for silhouette K-search.
+ * @details Allocation is performed concurrently for different amounts of clusters.
+ *
+ */
 class silhouette_ksearch_allocator {
 public:
     using ptr = std::shared_ptr<silhouette_ksearch_allocator>;
@@ -41,35 +47,82 @@ public:
 
 public:
     virtual void allocate(const std::size_t p_amount, const dataset & p_data, cluster_sequence & p_clusters) = 0;
+
+    /**
+     *
+     * @brief   Allocates clusters when the data has already been packed by the search.
+     * @details By default the packed points are ignored and the data is used.
+     *
+     */
+    virtual void allocate(const std::size_t p_amount, const dataset & p_data, const points_view<double> & p_points, cluster_sequence & p_clusters);
+
+    /**
+     *
+     * @brief   Allocates clusters of the points that are not stored in the dataset.
+     * @details By default the points are copied to the dataset.
+     *
+     */
+    virtual void allocate(const std::size_t p_amount, const points_view<double> & p_points, cluster_sequence & p_clusters);
 };
 
 
+/**
+ *
+ * @brief   Allocates clusters by K-Means, initial centers are chosen by K-Means++ from evenly spread sample of points.
+ *
+ */
 class kmeans_allocator : public silhouette_ksearch_allocator {
 public:
     virtual void allocate(const std::size_t p_amount, const dataset & p_data, cluster_sequence & p_clusters) override;
+
+    virtual void allocate(const std::size_t p_amount, const dataset & p_data, const points_view<double> & p_points, cluster_sequence & p_clusters) override;
+
+    virtual void allocate(const std::size_t p_amount, const points_view<double> & p_points, cluster_sequence & p_clusters) override;
 };
 
 class kmedians_allocator : public silhouette_ksearch_allocator {
 public:
+    using silhouette_ksearch_allocator::allocate;
+
     virtual void allocate(const std::size_t p_amount, const dataset & p_data, cluster_sequence & p_clusters) override;
 };
 
 class kmedoids_allocator : public silhouette_ksearch_allocator {
 public:
+    using silhouette_ksearch_allocator::allocate;
+
     virtual void allocate(const std::size_t p_amount, const dataset & p_data, cluster_sequence & p_clusters) override;
 };
 
 
+/**
+ *
+ * @brief   Searches amount of clusters in range [kmin, kmax) with the best mean silhouette score.
+ * @details Amounts of clusters are evaluated in parallel, points are scored with square Euclidean distance using
+ *           cluster centers and scatters. Clusters of the best amount are stored in the result.
+ *
+ */
 class silhouette_ksearch {
 private:
     std::size_t m_kmin;
     std::size_t m_kmax;
     silhouette_ksearch_allocator::ptr m_allocator = std::make_shared<kmeans_allocator>();
+    double m_time_budget = 0.0;
 
 public:
     silhouette_ksearch() = default;
 
-    silhouette_ksearch(const std::size_t p_kmin, const std::size_t p_kmax, const silhouette_ksearch_allocator::ptr & p_allocator = std::make_shared<kmeans_allocator>());
+    /**
+     *
+     * @param[in] p_kmin: minimum amount of clusters, should be greater than 1.
+     * @param[in] p_kmax: amount of clusters after the last one that is evaluated.
+     * @param[in] p_allocator: algorithm that allocates clusters.
+     * @param[in] p_time_budget: time in seconds after which no further amount of clusters is evaluated, 0 means no limit.
+     *             Amounts are started from the smallest one that is always evaluated, scores of skipped amounts are NaN.
+     *             If the allocator returns fewer clusters than requested, the clusters it returned are scored.
+     *
+     */
+    silhouette_ksearch(const std::size_t p_kmin, const std::size_t p_kmax, const silhouette_ksearch_allocator::ptr & p_allocator = std::make_shared<kmeans_allocator>(), const double p_time_budget = 0.0);
 
     silhouette_ksearch(const silhouette_ksearch & p_other) = default;
 
@@ -79,6 +132,16 @@ public:
 
 public:
     void process(const dataset & p_data, silhouette_ksearch_data & p_result);
+
+    /**
+     *
+     * @brief   Performs the search for points that are stored row by row, points are not copied.
+     *
+     */
+    void process(const points_view<double> & p_points, silhouette_ksearch_data & p_result);
+
+private:
+    void process(const dataset * const p_data, const points_view<double> & p_points, silhouette_ksearch_data & p_result);
 };
 
 }
@@ -23,6 +23,8 @@
 #pragma once
 
 
+#include <pyclustering/cluster/cluster_data.hpp>
+
 #include <pyclustering/definitions.hpp>
 
 
@@ -39,19 +41,24 @@ private:
     std::size_t m_amount = 0;
     double      m_score  = 0;
     silhouette_score_sequence m_scores = { };
+    cluster_sequence m_clusters = { };
 
 public:
-    const std::size_t get_amount() const { return m_amount; }
+    std::size_t get_amount() const { return m_amount; }
 
     void set_amount(const std::size_t p_amount) { m_amount = p_amount; }
 
-    const double get_score() const { return m_score; }
+    double get_score() const { return m_score; }
 
     void set_score(const double p_score) { m_score = p_score; }
 
     const silhouette_score_sequence & scores() const { return m_scores; }
 
     silhouette_score_sequence & scores() { return m_scores; }
+
+    const cluster_sequence & clusters() const { return m_clusters; }
+
+    cluster_sequence & clusters() { return m_clusters; }
 };
 
 
@@ -40,6 +40,7 @@ private:
     std::size_t         m_amount_clusters   = 0;
 
     std::size_t         m_epoch             = 0;
+    nnet::som_train_type m_train_type       = nnet::som_train_type::SOM_ONLINE;
 
 public:
     /**
@@ -69,9 +70,10 @@ public:
      *
      * @param[in] p_amount_clusters: amount of clusters that should be allocated.
      * @param[in] p_epoch: maximum iterations for SOM learning process.
+     * @param[in] p_train_type: training mode of SOM, batch training finds winners in parallel.
      *
      */
-    somsc(const std::size_t p_amount_clusters, const std::size_t p_epoch = 100);
+    somsc(const std::size_t p_amount_clusters, const std::size_t p_epoch = 100, const nnet::som_train_type p_train_type = nnet::som_train_type::SOM_ONLINE);
 
     /**
      *
@@ -90,6 +92,30 @@ public:
     *
     */
     virtual void process(const dataset & p_data, cluster_data & p_result) override;
+
+    /**
+    *
+    * @brief    Performs cluster analysis of points stored row by row in a contiguous buffer, SOM is trained in batch mode.
+    *
+    * @param[in]  p_points: input points for cluster analysis, they are not copied.
+    * @param[out] p_result: clustering result of an input data (consists of allocated clusters).
+    *
+    */
+    void process(const utils::metric::points_view<double> & p_points, cluster_data & p_result);
+
+    /**
+    *
+    * @brief    Performs cluster analysis of single precision points stored row by row in a contiguous buffer.
+    *
+    * @param[in]  p_points: input points for cluster analysis, they are not copied.
+    * @param[out] p_result: clustering result of an input data (consists of allocated clusters).
+    *
+    */
+    void process(const utils::metric::points_view<float> & p_points, cluster_data & p_result);
+
+private:
+    template <typename TypeValue>
+    void process_view(const utils::metric::points_view<TypeValue> & p_points, cluster_data & p_result);
 };
 
 
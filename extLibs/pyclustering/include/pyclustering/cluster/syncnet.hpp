@@ -129,6 +129,18 @@ public:
 
     virtual void phase_kuramoto_equation(const double t, const differ_state<double> & inputs, const differ_extra<void *> & argv, differ_state<double> & outputs) const override;
 
+    /*
+    
+    @brief   Overrided method for creation of coupling that is used by the flat integrator, the coupling is
+              normalized by amount of neighbors and weighted by distance if it is enabled.
+    
+    @param[out] p_coupling: coupling between oscillators in the network.
+    
+    @return  Always true.
+    
+    */
+    virtual bool create_coupling(sync_coupling & p_coupling) const override;
+
 public:
     /*
     
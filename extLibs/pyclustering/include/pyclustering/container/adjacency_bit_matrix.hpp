@@ -36,7 +36,8 @@ namespace container {
 *
 * @details Bit matrix implementation helps to significantly reduce usage of memory than list matrix
 *          and classic matrix representations. But operations of getting and setting are slower than
-*          mentioned implementations.
+*          mentioned implementations. Rows are packed into machine words, so common neighbors of two
+*          nodes are counted by AND of rows and population count.
 *          
 * @see     adjacency_list
 * @see     adjacency_matrix
@@ -98,6 +99,8 @@ private:
     static const size_t DEFAULT_EXISTANCE_CONNECTION_VALUE;
     static const size_t DEFAULT_NON_EXISTANCE_CONNECTION_VALUE;
 
+    static const size_t BITS_PER_ELEMENT;
+
 
 public:
     /**
@@ -159,6 +162,18 @@ public:
     */
     virtual void get_neighbors(const size_t node_index, std::vector<size_t> & node_neighbors) const override;
 
+    /**
+    *
+    * @brief   Returns amount of nodes that are connected with both specified nodes.
+    *
+    * @details No bounds checking is performed.
+    *
+    * @param[in]  node_index1: index of node in the collection.
+    * @param[in]  node_index2: index of another node in the collection.
+    *
+    */
+    size_t count_common_neighbors(const size_t node_index1, const size_t node_index2) const;
+
     /**
     *
     * @brief   Clear content of adjacency matrix.
@@ -78,6 +78,18 @@ public:
     static std::shared_ptr<adjacency_collection> create_collection(const size_t amount_nodes, 
                                                                    const adjacency_unweight_t storing_type = adjacency_unweight_t::ADJACENCY_MATRIX, 
                                                                    const connection_t structure_type = connection_t::CONNECTION_NONE);
+
+    /**
+    *
+    * @brief   Returns type of collection that needs the least memory for the specified density of connections.
+    * @details Adjacency list is returned for sparse collections, bit matrix is returned otherwise.
+    *          Classical matrix is never returned because it always needs more memory than the bit matrix.
+    *
+    * @param[in] amount_nodes: size of adjacency collection that is defined by amount of nodes in it.
+    * @param[in] amount_connections: expected amount of one-way connections in the collection.
+    *
+    */
+    static adjacency_unweight_t select_storing_type(const size_t amount_nodes, const size_t amount_connections);
 };
 
 
@@ -0,0 +1,101 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#pragma once
+
+
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+
+namespace pyclustering {
+
+namespace container {
+
+
+/**
+*
+* @brief   Disjoint set forest with path halving.
+* @details Root of every set is its element with the smallest index, so sets can be enumerated in order of their first elements.
+*
+*/
+class disjoint_set {
+private:
+    std::vector<std::size_t> m_parent;
+
+public:
+    /**
+    *
+    * @brief   Creates forest where every element is a separate set.
+    *
+    * @param[in] p_size: amount of elements.
+    *
+    */
+    explicit disjoint_set(const std::size_t p_size) :
+        m_parent(p_size)
+    {
+        std::iota(m_parent.begin(), m_parent.end(), 0);
+    }
+
+public:
+    /**
+    *
+    * @brief   Returns root of the set that contains the element.
+    *
+    */
+    std::size_t find(std::size_t p_index) {
+        while (m_parent[p_index] != p_index) {
+            m_parent[p_index] = m_parent[m_parent[p_index]];
+            p_index = m_parent[p_index];
+        }
+
+        return p_index;
+    }
+
+    /**
+    *
+    * @brief   Merges sets that contain specified elements.
+    *
+    * @return  False if elements already belong to the same set.
+    *
+    */
+    bool merge(const std::size_t p_index1, const std::size_t p_index2) {
+        const std::size_t root1 = find(p_index1);
+        const std::size_t root2 = find(p_index2);
+
+        if (root1 < root2) {
+            m_parent[root2] = root1;
+        }
+        else if (root2 < root1) {
+            m_parent[root1] = root2;
+        }
+
+        return root1 != root2;
+    }
+};
+
+
+}
+
+}
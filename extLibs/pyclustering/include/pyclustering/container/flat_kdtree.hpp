@@ -0,0 +1,229 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#pragma once
+
+
+#include <pyclustering/definitions.hpp>
+
+#include <pyclustering/container/point_neighbor.hpp>
+
+#include <pyclustering/utils/distance_matrix.hpp>
+#include <pyclustering/utils/metric_simd.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+
+namespace pyclustering {
+
+namespace container {
+
+
+/**
+ *
+ * @brief   Static KD-tree that is built in bulk and stored in contiguous arrays.
+ * @details Points are split by the median of the coordinate with the widest spread until leaves contain at most
+ *           leaf size points. Nodes are stored in pre-order in a single array (left child follows its parent), coordinates
+ *           are copied into a packed buffer in order of the leaves, so points of every leaf are contiguous and are
+ *           compared with the query by vectorized block kernels. Cells that are farther than the search radius are
+ *           pruned using incremental distance to the cell. Distances are square Euclidean distances.
+ *           The tree cannot be modified after the build, concurrent queries are allowed.
+ *
+ */
+class flat_kdtree {
+public:
+    static constexpr std::size_t DEFAULT_LEAF_SIZE = 16;
+
+    using neighbor = point_neighbor;
+
+    using neighbor_sequence = point_neighbor_sequence;
+
+private:
+    struct node {
+        std::size_t     m_begin         = 0;    /* first point of the node in the packed buffer */
+        std::size_t     m_end           = 0;    /* point after the last one */
+        std::size_t     m_right         = 0;    /* index of the right child, 0 for leaves */
+        std::size_t     m_discriminator = 0;
+        double          m_value         = 0.0;  /* left points are not greater, right points are not less */
+    };
+
+private:
+    std::vector<node>           m_nodes         = { };
+    std::vector<double>         m_points        = { };
+    std::vector<std::size_t>    m_indexes       = { };
+    std::size_t                 m_dimension     = 0;
+    std::size_t                 m_leaf_size     = DEFAULT_LEAF_SIZE;
+
+public:
+    flat_kdtree() = default;
+
+    /**
+     *
+     * @brief   Builds tree for points stored row by row in a contiguous buffer, points are copied.
+     *
+     * @param[in] p_points: points of the tree.
+     * @param[in] p_leaf_size: maximum amount of points in a leaf.
+     *
+     */
+    explicit flat_kdtree(const utils::metric::points_view<double> & p_points, const std::size_t p_leaf_size = DEFAULT_LEAF_SIZE);
+
+    /**
+     *
+     * @brief   Builds tree for points stored in pyclustering container.
+     *
+     * @param[in] p_points: points of the tree.
+     * @param[in] p_leaf_size: maximum amount of points in a leaf.
+     *
+     */
+    explicit flat_kdtree(const dataset & p_points, const std::size_t p_leaf_size = DEFAULT_LEAF_SIZE);
+
+public:
+    std::size_t size() const { return m_indexes.size(); }
+
+    std::size_t dimension() const { return m_dimension; }
+
+    bool empty() const { return m_indexes.empty(); }
+
+    /**
+     *
+     * @brief   Calls visitor for every point that is not farther than the radius from the query point.
+     *
+     * @param[in] p_point: coordinates of the query point.
+     * @param[in] p_radius: search radius (not square).
+     * @param[in] p_visitor: callable object with signature void(std::size_t index, double square_distance).
+     *
+     */
+    template <typename TypeVisitor>
+    void radius_search(const double * p_point, const double p_radius, TypeVisitor && p_visitor) const {
+        if (m_nodes.empty()) {
+            return;
+        }
+
+        std::vector<double> offsets(m_dimension, 0.0);
+        radius_search_node(0, p_point, p_radius * p_radius, 0.0, offsets.data(), p_visitor);
+    }
+
+    /**
+     *
+     * @brief   Finds points that are not farther than the radius from every query point in parallel.
+     *
+     * @param[in]  p_queries: query points.
+     * @param[in]  p_radius: search radius (not square).
+     * @param[out] p_result: neighbors of every query point, they are not sorted.
+     *
+     */
+    void radius_search(const utils::metric::points_view<double> & p_queries, const double p_radius, std::vector<neighbor_sequence> & p_result) const;
+
+    /**
+     *
+     * @brief   Finds nearest points to the query point.
+     *
+     * @param[in]  p_point: coordinates of the query point.
+     * @param[in]  p_amount: amount of nearest points.
+     * @param[out] p_result: nearest points sorted by distance, fewer if the tree is smaller than the amount.
+     *
+     */
+    void knn_search(const double * p_point, const std::size_t p_amount, neighbor_sequence & p_result) const;
+
+    /**
+     *
+     * @brief   Finds nearest points to every query point in parallel.
+     *
+     * @param[in]  p_queries: query points.
+     * @param[in]  p_amount: amount of nearest points.
+     * @param[out] p_result: nearest points of every query point sorted by distance.
+     *
+     */
+    void knn_search(const utils::metric::points_view<double> & p_queries, const std::size_t p_amount, std::vector<neighbor_sequence> & p_result) const;
+
+private:
+    void build(const utils::metric::points_view<double> & p_points);
+
+    std::size_t build_node(const utils::metric::points_view<double> & p_points, const std::size_t p_begin, const std::size_t p_end, std::vector<std::pair<double, std::size_t>> & p_keys);
+
+    void knn_search_node(const std::size_t p_node, const double * p_point, const std::size_t p_amount, const double p_cell_distance, double * p_offsets, neighbor_sequence & p_heap) const;
+
+    template <typename TypeVisitor>
+    void radius_search_node(const std::size_t p_node, const double * p_point, const double p_radius_square, const double p_cell_distance, double * p_offsets, TypeVisitor & p_visitor) const {
+        const node & current = m_nodes[p_node];
+
+        if (current.m_right == 0) {
+            visit_leaf(current, p_point, [this, p_radius_square, &p_visitor](const std::size_t p_position, const double p_distance) {
+                if (p_distance <= p_radius_square) {
+                    p_visitor(m_indexes[p_position], p_distance);
+                }
+            });
+
+            return;
+        }
+
+        const double difference = p_point[current.m_discriminator] - current.m_value;
+        const std::size_t near_child = (difference <= 0.0) ? p_node + 1 : current.m_right;
+        const std::size_t far_child = (difference <= 0.0) ? current.m_right : p_node + 1;
+
+        radius_search_node(near_child, p_point, p_radius_square, p_cell_distance, p_offsets, p_visitor);
+
+        /* distance to the far cell differs from the current one only along the discriminator */
+        const double previous_offset = p_offsets[current.m_discriminator];
+        const double far_distance = p_cell_distance - previous_offset * previous_offset + difference * difference;
+        if (far_distance <= p_radius_square) {
+            p_offsets[current.m_discriminator] = difference;
+            radius_search_node(far_child, p_point, p_radius_square, far_distance, p_offsets, p_visitor);
+            p_offsets[current.m_discriminator] = previous_offset;
+        }
+    }
+
+    template <typename TypeAction>
+    void visit_leaf(const node & p_leaf, const double * p_point, const TypeAction & p_action) const {
+        using namespace utils::metric::simd;
+
+        const kernel_set<double> & kernels = get_kernels<double>();
+
+        std::size_t position = p_leaf.m_begin;
+        for (; position + DOT_PRODUCT_BLOCK_SIZE <= p_leaf.m_end; position += DOT_PRODUCT_BLOCK_SIZE) {
+            const double * others[DOT_PRODUCT_BLOCK_SIZE] = { row(position), row(position + 1), row(position + 2), row(position + 3) };
+
+            double distances[DOT_PRODUCT_BLOCK_SIZE];
+            kernels.euclidean_distance_square_block(p_point, others, m_dimension, distances);
+
+            for (std::size_t k = 0; k < DOT_PRODUCT_BLOCK_SIZE; k++) {
+                p_action(position + k, distances[k]);
+            }
+        }
+
+        for (; position < p_leaf.m_end; position++) {
+            p_action(position, kernels.euclidean_distance_square(p_point, row(position), m_dimension));
+        }
+    }
+
+    const double * row(const std::size_t p_position) const { return m_points.data() + p_position * m_dimension; }
+};
+
+
+}
+
+}
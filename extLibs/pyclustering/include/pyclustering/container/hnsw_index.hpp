@@ -0,0 +1,245 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#pragma once
+
+
+#include <pyclustering/definitions.hpp>
+
+#include <pyclustering/container/point_neighbor.hpp>
+
+#include <pyclustering/parallel/spinlock.hpp>
+
+#include <pyclustering/utils/distance_matrix.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace pyclustering {
+
+namespace container {
+
+
+/**
+ *
+ * @brief   Parameters of the hierarchical navigable small world graph.
+ *
+ */
+struct hnsw_parameters {
+    std::size_t     m_connections       = 16;       /* links of a node on upper layers, twice more on the bottom layer */
+    std::size_t     m_ef_construction   = 200;      /* size of the candidate list that is used to link inserted points */
+    std::size_t     m_ef_search         = 64;       /* size of the candidate list that is used by queries, controls recall */
+    std::uint32_t   m_seed              = 100;      /* seed of the generator of node levels */
+};
+
+
+/**
+ *
+ * @brief   Approximate nearest neighbor index based on hierarchical navigable small world graph (HNSW).
+ * @details Every point is a node of a layered proximity graph. Upper layers contain exponentially fewer nodes and are
+ *           used to find an entry point on the bottom layer, where best-first search over the candidate list of size
+ *           'ef' is performed. Larger 'ef' gives higher recall for longer queries, it can be changed after the build.
+ *           Coordinates are copied into a packed buffer, distances are square Euclidean distances that are calculated
+ *           by vectorized kernels. Points are inserted concurrently, link lists are guarded by per-node spinlocks.
+ *           The index cannot be modified after the build, concurrent queries are allowed.
+ *
+ * @see     Y. A. Malkov, D. A. Yashunin. Efficient and robust approximate nearest neighbor search using Hierarchical
+ *           Navigable Small World graphs. 2016.
+ *
+ */
+class hnsw_index {
+public:
+    using neighbor = point_neighbor;
+
+    using neighbor_sequence = point_neighbor_sequence;
+
+private:
+    using link_type = std::uint32_t;
+
+private:
+    hnsw_parameters                 m_parameters    = { };
+    std::size_t                     m_dimension     = 0;
+    std::size_t                     m_size          = 0;
+    std::vector<double>             m_points        = { };
+    std::vector<std::uint8_t>       m_levels        = { };
+    std::vector<link_type>          m_bottom_links  = { };      /* per node: amount of links followed by 2 * M slots */
+    std::vector<std::vector<link_type>> m_upper_links = { };    /* per node: level * (amount of links followed by M slots) */
+    std::size_t                     m_entry         = 0;
+    std::size_t                     m_top_level     = 0;
+
+    parallel::spinlock *            m_locks         = nullptr;  /* exist only while points are inserted, the last one guards the entry point */
+
+public:
+    hnsw_index() = default;
+
+    /**
+     *
+     * @brief   Builds index for points stored row by row in a contiguous buffer, points are copied.
+     *
+     * @param[in] p_points: points of the index.
+     * @param[in] p_parameters: parameters of the graph.
+     *
+     */
+    explicit hnsw_index(const utils::metric::points_view<double> & p_points, const hnsw_parameters & p_parameters = hnsw_parameters());
+
+    /**
+     *
+     * @brief   Builds index for points stored in pyclustering container.
+     *
+     * @param[in] p_points: points of the index.
+     * @param[in] p_parameters: parameters of the graph.
+     *
+     */
+    explicit hnsw_index(const dataset & p_points, const hnsw_parameters & p_parameters = hnsw_parameters());
+
+public:
+    std::size_t size() const { return m_size; }
+
+    std::size_t dimension() const { return m_dimension; }
+
+    bool empty() const { return m_size == 0; }
+
+    const hnsw_parameters & parameters() const { return m_parameters; }
+
+    /**
+     *
+     * @brief   Changes size of the candidate list that is used by queries.
+     * @details Recall grows and speed drops with the size, it is never smaller than the amount of requested neighbors.
+     *
+     */
+    void set_ef_search(const std::size_t p_ef_search);
+
+    /**
+     *
+     * @brief   Finds approximately nearest points to the query point.
+     *
+     * @param[in]  p_point: coordinates of the query point.
+     * @param[in]  p_amount: amount of nearest points.
+     * @param[out] p_result: nearest points sorted by distance, fewer if the index is smaller than the amount.
+     *
+     */
+    void knn_search(const double * p_point, const std::size_t p_amount, neighbor_sequence & p_result) const;
+
+    /**
+     *
+     * @brief   Finds approximately nearest points to every query point in parallel.
+     *
+     * @param[in]  p_queries: query points.
+     * @param[in]  p_amount: amount of nearest points.
+     * @param[out] p_result: nearest points of every query point sorted by distance.
+     *
+     */
+    void knn_search(const utils::metric::points_view<double> & p_queries, const std::size_t p_amount, std::vector<neighbor_sequence> & p_result) const;
+
+    /**
+     *
+     * @brief   Finds points that are not farther than the radius from the query point.
+     * @details Points that are found by the search are extended by the bottom layer links of the points that are
+     *           inside the radius, so neighborhoods larger than the candidate list are not cut.
+     *
+     * @param[in]  p_point: coordinates of the query point.
+     * @param[in]  p_radius: search radius (not square).
+     * @param[out] p_result: found points sorted by distance.
+     *
+     */
+    void radius_search(const double * p_point, const double p_radius, neighbor_sequence & p_result) const;
+
+    /**
+     *
+     * @brief   Finds points that are not farther than the radius from every query point in parallel.
+     *
+     * @param[in]  p_queries: query points.
+     * @param[in]  p_radius: search radius (not square).
+     * @param[out] p_result: found points of every query point sorted by distance.
+     *
+     */
+    void radius_search(const utils::metric::points_view<double> & p_queries, const double p_radius, std::vector<neighbor_sequence> & p_result) const;
+
+    /**
+     *
+     * @brief   Builds k-nearest neighbor graph of the indexed points in parallel.
+     *
+     * @param[in]  p_amount: amount of neighbors of every point, the point itself is excluded.
+     * @param[out] p_result: nearest points of every indexed point sorted by distance.
+     *
+     */
+    void knn_graph(const std::size_t p_amount, std::vector<neighbor_sequence> & p_result) const;
+
+    /**
+     *
+     * @brief   Writes the index to the binary file.
+     *
+     * @param[in] p_path: path to the file.
+     *
+     * @throw   std::runtime_error if the file cannot be written.
+     *
+     */
+    void save(const std::string & p_path) const;
+
+    /**
+     *
+     * @brief   Reads the index from the binary file that was written by 'save'.
+     *
+     * @param[in] p_path: path to the file.
+     *
+     * @throw   std::runtime_error if the file cannot be read, is not an index file or contains levels or links out of range.
+     *
+     */
+    void load(const std::string & p_path);
+
+private:
+    void build(const utils::metric::points_view<double> & p_points);
+
+    void insert(const std::size_t p_index);
+
+    std::size_t random_level(std::mt19937 & p_generator) const;
+
+    void search_layer(const double * p_point, const std::size_t p_level, const std::size_t p_ef, neighbor_sequence & p_candidates, const bool p_locked) const;
+
+    std::size_t greedy_search(const double * p_point, std::size_t p_entry, const std::size_t p_from_level, const std::size_t p_to_level, const bool p_locked) const;
+
+    void search(const double * p_point, const std::size_t p_ef, neighbor_sequence & p_result) const;
+
+    void select_neighbors(neighbor_sequence & p_candidates, const std::size_t p_amount) const;
+
+    void connect(const std::size_t p_index, const std::size_t p_level, const neighbor_sequence & p_neighbors);
+
+    void read_links(const std::size_t p_index, const std::size_t p_level, std::vector<link_type> & p_links, const bool p_locked) const;
+
+    link_type * links(const std::size_t p_index, const std::size_t p_level);
+
+    const link_type * links(const std::size_t p_index, const std::size_t p_level) const;
+
+    std::size_t capacity(const std::size_t p_level) const { return (p_level == 0) ? 2 * m_parameters.m_connections : m_parameters.m_connections; }
+
+    const double * row(const std::size_t p_index) const { return m_points.data() + p_index * m_dimension; }
+};
+
+
+}
+
+}
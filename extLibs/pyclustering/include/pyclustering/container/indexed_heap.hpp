@@ -0,0 +1,233 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#pragma once
+
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+
+namespace pyclustering {
+
+namespace container {
+
+
+/**
+*
+* @brief   Binary min-heap of element indexes from range [0, size) that supports decrease-key.
+* @details Position of every element in the heap is tracked, so its key can be decreased in O(log n)
+*           without searching. Elements with equal keys are extracted in order of their last insertion
+*           or decrease, the same way as equal elements of std::multiset.
+*
+*/
+class indexed_heap {
+public:
+    static constexpr std::size_t NONE_POSITION = std::numeric_limits<std::size_t>::max();
+
+private:
+    struct entry {
+        double          m_key       = 0.0;
+        std::size_t     m_stamp     = 0;
+        std::size_t     m_index     = 0;
+    };
+
+private:
+    std::vector<entry>          m_heap;
+    std::vector<std::size_t>    m_position;
+    std::size_t                 m_stamp     = 0;
+
+public:
+    /**
+    *
+    * @brief   Creates empty heap for elements with indexes less than specified size.
+    *
+    * @param[in] p_size: amount of elements that can be stored in the heap.
+    *
+    */
+    explicit indexed_heap(const std::size_t p_size) :
+        m_position(p_size, NONE_POSITION)
+    {
+        m_heap.reserve(p_size);
+    }
+
+public:
+    bool empty() const { return m_heap.empty(); }
+
+    std::size_t size() const { return m_heap.size(); }
+
+    /**
+    *
+    * @brief   Returns true if the element is stored in the heap.
+    *
+    */
+    bool contains(const std::size_t p_index) const { return m_position[p_index] != NONE_POSITION; }
+
+    /**
+    *
+    * @brief   Returns key of the element that is stored in the heap.
+    *
+    */
+    double key(const std::size_t p_index) const { return m_heap[m_position[p_index]].m_key; }
+
+    /**
+    *
+    * @brief   Returns index of the element with the smallest key.
+    *
+    */
+    std::size_t top() const { return m_heap.front().m_index; }
+
+    /**
+    *
+    * @brief   Inserts element that is not stored in the heap.
+    *
+    */
+    void push(const std::size_t p_index, const double p_key) {
+        m_heap.push_back({ p_key, m_stamp++, p_index });
+        m_position[p_index] = m_heap.size() - 1;
+        sift_up(m_heap.size() - 1);
+    }
+
+    /**
+    *
+    * @brief   Decreases key of the element that is stored in the heap.
+    *
+    */
+    void decrease(const std::size_t p_index, const double p_key) {
+        const std::size_t position = m_position[p_index];
+        m_heap[position].m_key = p_key;
+        m_heap[position].m_stamp = m_stamp++;
+        sift_up(position);
+    }
+
+    /**
+    *
+    * @brief   Changes key of the element that is stored in the heap, key may be increased or decreased.
+    *
+    */
+    void update(const std::size_t p_index, const double p_key) {
+        const std::size_t position = m_position[p_index];
+        m_heap[position].m_key = p_key;
+        m_heap[position].m_stamp = m_stamp++;
+        sift_up(position);
+        sift_down(m_position[p_index]);
+    }
+
+    /**
+    *
+    * @brief   Removes element that is stored in the heap.
+    *
+    */
+    void erase(const std::size_t p_index) {
+        const std::size_t position = m_position[p_index];
+        m_position[p_index] = NONE_POSITION;
+
+        const entry last = m_heap.back();
+        m_heap.pop_back();
+
+        if (position < m_heap.size()) {
+            m_heap[position] = last;
+            m_position[last.m_index] = position;
+            sift_up(position);
+            sift_down(m_position[last.m_index]);
+        }
+    }
+
+    /**
+    *
+    * @brief   Removes element with the smallest key from the heap.
+    *
+    * @return  Index of the removed element.
+    *
+    */
+    std::size_t pop() {
+        const std::size_t index = m_heap.front().m_index;
+        m_position[index] = NONE_POSITION;
+
+        if (m_heap.size() > 1) {
+            m_heap.front() = m_heap.back();
+            m_position[m_heap.front().m_index] = 0;
+            m_heap.pop_back();
+            sift_down(0);
+        }
+        else {
+            m_heap.pop_back();
+        }
+
+        return index;
+    }
+
+private:
+    static bool less(const entry & p_entry1, const entry & p_entry2) {
+        return (p_entry1.m_key < p_entry2.m_key) || ((p_entry1.m_key == p_entry2.m_key) && (p_entry1.m_stamp < p_entry2.m_stamp));
+    }
+
+    void sift_up(std::size_t p_position) {
+        const entry value = m_heap[p_position];
+        while (p_position > 0) {
+            const std::size_t parent = (p_position - 1) / 2;
+            if (!less(value, m_heap[parent])) {
+                break;
+            }
+
+            m_heap[p_position] = m_heap[parent];
+            m_position[m_heap[p_position].m_index] = p_position;
+            p_position = parent;
+        }
+
+        m_heap[p_position] = value;
+        m_position[value.m_index] = p_position;
+    }
+
+    void sift_down(std::size_t p_position) {
+        const entry value = m_heap[p_position];
+        const std::size_t size = m_heap.size();
+        while (true) {
+            std::size_t child = 2 * p_position + 1;
+            if (child >= size) {
+                break;
+            }
+
+            if ((child + 1 < size) && less(m_heap[child + 1], m_heap[child])) {
+                child++;
+            }
+
+            if (!less(m_heap[child], value)) {
+                break;
+            }
+
+            m_heap[p_position] = m_heap[child];
+            m_position[m_heap[p_position].m_index] = p_position;
+            p_position = child;
+        }
+
+        m_heap[p_position] = value;
+        m_position[value.m_index] = p_position;
+    }
+};
+
+
+}
+
+}
@@ -0,0 +1,52 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#pragma once
+
+
+#include <cstddef>
+#include <vector>
+
+
+namespace pyclustering {
+
+namespace container {
+
+
+/**
+ *
+ * @brief   Point that is found by a neighbor search.
+ *
+ */
+struct point_neighbor {
+    std::size_t     m_index     = 0;        /* index of the point in the input data */
+    double          m_distance  = 0.0;      /* square Euclidean distance to the query */
+};
+
+
+using point_neighbor_sequence = std::vector<point_neighbor>;
+
+
+}
+
+}
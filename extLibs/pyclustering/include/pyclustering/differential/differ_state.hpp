@@ -25,6 +25,7 @@
 
 #include <vector>
 #include <memory>
+#include <stdexcept>
 
 #include "solve_type.hpp"
 
@@ -23,6 +23,7 @@
 #pragma once
 
 
+#include <pyclustering/interface/pyclustering_matrix.hpp>
 #include <pyclustering/interface/pyclustering_package.hpp>
 
 #include <pyclustering/definitions.hpp>
@@ -46,6 +47,33 @@
  */
 extern "C" DECLARATION void * cure_algorithm(const pyclustering_package * const sample, const size_t number_clusters, const size_t number_repr_points, const double compression);
 
+/**
+ *
+ * @brief   Clustering algorithm CURE that reads input points in place and writes results to buffers of the caller.
+ *
+ * @param[in]  p_sample: input points for clustering.
+ * @param[in]  p_number_clusters: number of clusters that should be allocated.
+ * @param[in]  p_number_repr_points: number of representation points for each cluster.
+ * @param[in]  p_compression: coefficient defines level of shrinking of representation points.
+ * @param[in]  p_sample_size: amount of points in the random sample, if 0 then all points are clustered.
+ * @param[in]  p_amount_partitions: amount of partitions of the random sample.
+ * @param[out] p_labels: buffer of 'p_sample->rows' indexes of clusters of the points.
+ * @param[out] p_means: buffer for mean points of clusters stored row by row ('p_number_clusters * p_sample->cols'
+ *              values), may be 'nullptr' if means are not required.
+ *
+ * @return  Returns amount of allocated clusters, or 'PYCLUSTERING_VIEW_FAILURE' if arguments are
+ *           invalid or processing fails.
+ *
+ */
+extern "C" DECLARATION std::size_t cure_algorithm_view(const pyclustering_matrix * const p_sample,
+                                                       const std::size_t p_number_clusters,
+                                                       const std::size_t p_number_repr_points,
+                                                       const double p_compression,
+                                                       const std::size_t p_sample_size,
+                                                       const std::size_t p_amount_partitions,
+                                                       std::size_t * const p_labels,
+                                                       double * const p_means);
+
 /**
  *
  * @brief   Destroys CURE clustering data (clustering results).
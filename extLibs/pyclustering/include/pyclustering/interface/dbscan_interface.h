@@ -23,6 +23,7 @@
 #pragma once
 
 
+#include <pyclustering/interface/pyclustering_matrix.hpp>
 #include <pyclustering/interface/pyclustering_package.hpp>
 
 #include <pyclustering/definitions.hpp>
@@ -50,3 +51,24 @@ extern "C" DECLARATION pyclustering_package * dbscan_algorithm(const pyclusterin
                                                                const size_t p_minumum_neighbors,
                                                                const size_t p_data_type);
 
+
+/**
+ *
+ * @brief   Clustering algorithm DBSCAN that reads input points in place and writes cluster index of
+ *           each point to the buffer of the caller.
+ *
+ * @param[in]  p_sample: input points for clustering.
+ * @param[in]  p_radius: connectivity radius between points.
+ * @param[in]  p_minumum_neighbors: minimum number of shared neighbors that is required for
+ *              establish links between points.
+ * @param[out] p_labels: buffer of 'p_sample->rows' indexes of clusters, noise is marked by 'PYCLUSTERING_NOISE_LABEL'.
+ *
+ * @return  Returns amount of allocated clusters, or 'PYCLUSTERING_VIEW_FAILURE' if arguments are
+ *           invalid or processing fails.
+ *
+ */
+extern "C" DECLARATION std::size_t dbscan_algorithm_view(const pyclustering_matrix * const p_sample,
+                                                         const double p_radius,
+                                                         const std::size_t p_minumum_neighbors,
+                                                         std::size_t * const p_labels);
+
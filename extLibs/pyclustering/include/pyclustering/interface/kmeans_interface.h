@@ -23,6 +23,7 @@
 #pragma once
 
 
+#include <pyclustering/interface/pyclustering_matrix.hpp>
 #include <pyclustering/interface/pyclustering_package.hpp>
 
 #include <pyclustering/definitions.hpp>
@@ -66,3 +67,28 @@ extern "C" DECLARATION pyclustering_package * kmeans_algorithm(const pyclusterin
                                                                const std::size_t p_itermax,
                                                                const bool p_observe,
                                                                const void * const p_metric);
+
+
+/**
+ *
+ * @brief   Clustering algorithm K-Means that reads input data in place and writes results to buffers of the caller.
+ * @details Euclidean metric is used, evolution of clusters and centers is not collected.
+ *
+ * @param[in]  p_sample: input data for clustering.
+ * @param[in]  p_initial_centers: initial cluster centers.
+ * @param[in]  p_tolerance: stop condition - when changes of medians are less then tolerance value.
+ * @param[in]  p_itermax: maximum number of iterations for cluster analysis.
+ * @param[out] p_labels: buffer of 'p_sample->rows' indexes of clusters of the points.
+ * @param[out] p_centers: buffer for final centers stored row by row ('p_initial_centers->rows * p_sample->cols'
+ *              values), may be 'nullptr' if centers are not required.
+ *
+ * @return  Returns amount of clusters, or 'PYCLUSTERING_VIEW_FAILURE' if arguments are
+ *           invalid or processing fails.
+ *
+ */
+extern "C" DECLARATION std::size_t kmeans_algorithm_view(const pyclustering_matrix * const p_sample,
+                                                         const pyclustering_matrix * const p_initial_centers,
+                                                         const double p_tolerance,
+                                                         const std::size_t p_itermax,
+                                                         std::size_t * const p_labels,
+                                                         double * const p_centers);
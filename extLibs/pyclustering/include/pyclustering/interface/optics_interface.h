@@ -24,6 +24,7 @@
 #pragma once
 
 
+#include <pyclustering/interface/pyclustering_matrix.hpp>
 #include <pyclustering/interface/pyclustering_package.hpp>
 
 #include <pyclustering/definitions.hpp>
@@ -70,3 +71,28 @@ extern "C" DECLARATION pyclustering_package * optics_algorithm(const pyclusterin
                                                                const size_t p_minumum_neighbors, 
                                                                const size_t p_amount_clusters,
                                                                const size_t p_data_type);
+
+
+/**
+ *
+ * @brief   Clustering algorithm OPTICS that reads input points in place and writes results to buffers of the caller.
+ *
+ * @param[in]  p_sample: input points for clustering.
+ * @param[in]  p_radius: connectivity radius between points.
+ * @param[in]  p_minumum_neighbors: minimum number of shared neighbors that is required for
+ *              establish links between points.
+ * @param[in]  p_amount_clusters: amount of clusters that should be allocated (0 if radius should not be adjusted).
+ * @param[out] p_labels: buffer of 'p_sample->rows' indexes of clusters, noise is marked by 'PYCLUSTERING_NOISE_LABEL'.
+ * @param[out] p_reachability: buffer of 'p_sample->rows' reachability distances of the points ('optics::NONE_DISTANCE'
+ *              if distance is not defined), may be 'nullptr' if distances are not required.
+ *
+ * @return  Returns amount of allocated clusters, or 'PYCLUSTERING_VIEW_FAILURE' if arguments are
+ *           invalid or processing fails.
+ *
+ */
+extern "C" DECLARATION std::size_t optics_algorithm_view(const pyclustering_matrix * const p_sample,
+                                                         const double p_radius,
+                                                         const std::size_t p_minumum_neighbors,
+                                                         const std::size_t p_amount_clusters,
+                                                         std::size_t * const p_labels,
+                                                         double * const p_reachability);
@@ -0,0 +1,163 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#pragma once
+
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <pyclustering/cluster/cluster_data.hpp>
+
+#include <pyclustering/interface/pyclustering_package.hpp>
+
+#include <pyclustering/utils/distance_matrix.hpp>
+
+#include <pyclustering/definitions.hpp>
+
+
+/**
+ *
+ * @brief   Label that is written for objects that are not assigned to any cluster (noise).
+ *
+ */
+constexpr std::size_t PYCLUSTERING_NOISE_LABEL = std::numeric_limits<std::size_t>::max();
+
+
+/**
+ *
+ * @brief   Value that is returned by algorithms that read matrices in place instead of amount of clusters
+ *           if arguments are invalid or processing fails, output buffers are not valid in this case.
+ *
+ */
+constexpr std::size_t PYCLUSTERING_VIEW_FAILURE = std::numeric_limits<std::size_t>::max();
+
+
+/**
+ *
+ * @brief   Describes matrix that is owned by the caller, rows are located at constant distance in a single buffer.
+ * @details Algorithms read the matrix in place without copying it to 'dataset'. Supported types of
+ *           elements are 'PYCLUSTERING_TYPE_DOUBLE' and 'PYCLUSTERING_TYPE_FLOAT', matrix of floats is
+ *           converted to doubles only by algorithms that do not process floats.
+ *
+ */
+struct pyclustering_matrix {
+    const void *    data      = nullptr;
+    std::size_t     rows      = 0;
+    std::size_t     cols      = 0;
+    std::size_t     stride    = 0;      /* distance between beginnings of consecutive rows in elements */
+    unsigned int    type      = (unsigned int) PYCLUSTERING_TYPE_DOUBLE;
+};
+
+
+/**
+ *
+ * @brief   Checks that the matrix has data for its rows and that its rows do not overlap.
+ *
+ * @param[in]  p_matrix: matrix that is provided by the caller.
+ *
+ * @throw   std::invalid_argument if the matrix is not valid or type of its elements is not supported.
+ *
+ */
+void check_matrix(const pyclustering_matrix & p_matrix);
+
+
+/**
+ *
+ * @brief   Returns view of the matrix rows for algorithms that process only doubles.
+ * @details Matrix of doubles is not copied, matrix of floats is converted to the buffer.
+ *
+ * @param[in]  p_matrix: matrix that is provided by the caller.
+ * @param[out] p_buffer: storage for the converted matrix, it should be valid while the view is used.
+ *
+ * @return  View of the matrix rows.
+ *
+ */
+pyclustering::utils::metric::points_view<double> get_matrix_view(const pyclustering_matrix & p_matrix, std::vector<double> & p_buffer);
+
+
+/**
+ *
+ * @brief   Calls the action with view of the matrix rows in type of its elements, the matrix is not copied.
+ *
+ * @param[in]  p_matrix: matrix that is provided by the caller.
+ * @param[in]  p_action: action that accepts 'points_view<float>' and 'points_view<double>'.
+ *
+ * @return  Value that is returned by the action.
+ *
+ */
+template <typename TypeAction>
+auto visit_matrix(const pyclustering_matrix & p_matrix, TypeAction && p_action) {
+    using namespace pyclustering::utils::metric;
+
+    check_matrix(p_matrix);
+    if (p_matrix.type == PYCLUSTERING_TYPE_FLOAT) {
+        return p_action(points_view<float>((const float *) p_matrix.data, p_matrix.rows, p_matrix.cols, p_matrix.stride));
+    }
+
+    return p_action(points_view<double>((const double *) p_matrix.data, p_matrix.rows, p_matrix.cols, p_matrix.stride));
+}
+
+
+/**
+ *
+ * @brief   Runs the algorithm at the boundary of the C interface, so exceptions are not propagated to the caller.
+ *
+ * @param[in]  p_algorithm: algorithm that returns amount of allocated clusters.
+ *
+ * @return  Amount of allocated clusters or 'PYCLUSTERING_VIEW_FAILURE' if the algorithm throws.
+ *
+ */
+template <typename TypeAlgorithm>
+std::size_t run_view_algorithm(TypeAlgorithm && p_algorithm) noexcept {
+    try {
+        return p_algorithm();
+    }
+    catch (...) {
+        return PYCLUSTERING_VIEW_FAILURE;
+    }
+}
+
+
+/**
+ *
+ * @brief   Writes index of the cluster of each object to the buffer, objects that are not assigned
+ *           to any cluster are marked by 'PYCLUSTERING_NOISE_LABEL'.
+ *
+ * @param[in]  p_clusters: allocated clusters.
+ * @param[in]  p_size: amount of objects.
+ * @param[out] p_labels: buffer of 'p_size' labels.
+ *
+ */
+void write_labels(const pyclustering::clst::cluster_sequence & p_clusters, const std::size_t p_size, std::size_t * const p_labels);
+
+
+/**
+ *
+ * @brief   Writes points row by row to the contiguous buffer.
+ *
+ * @param[in]  p_points: points that should be written.
+ * @param[out] p_buffer: buffer of size that is enough to store all coordinates of the points.
+ *
+ */
+void write_rows(const pyclustering::dataset & p_points, double * const p_buffer);
@@ -92,19 +92,18 @@ public:
             throw std::invalid_argument("pyclustering_package::extract() [" + std::to_string(__LINE__) + "]: argument is not 'PYCLUSTERING_TYPE_LIST').");
         }
 
+        container.reserve(container.size() + size);
         for (std::size_t i = 0; i < size; i++) {
-            std::vector<TypeValue> subcontainer = { };
-            extract(subcontainer, at<pyclustering_package *>(i));
-            container.push_back(subcontainer);
+            container.emplace_back();
+            extract(container.back(), at<pyclustering_package *>(i));
         }
     }
 
 private:
     template <class TypeValue>
     void extract(std::vector<TypeValue> & container, const pyclustering_package * const package) const {
-        for (std::size_t i = 0; i < package->size; i++) {
-            container.push_back(package->at<TypeValue>(i));
-        }
+        const TypeValue * const begin = (const TypeValue *) package->data;
+        container.insert(container.end(), begin, begin + package->size);
     }
 };
 
@@ -28,6 +28,8 @@
 
 #include <pyclustering/definitions.hpp>
 
+#include <pyclustering/utils/distance_matrix.hpp>
+
 
 namespace pyclustering {
 
@@ -74,6 +76,20 @@ enum class som_init_type {
 };
 
 
+/**
+*
+* @brief   Training modes of self-organized feature map.
+*
+*/
+enum class som_train_type {
+    /*!< Weights are adapted after every input pattern. */
+    SOM_ONLINE = 0,
+
+    /*!< Winners of all input patterns are found in parallel, weights are adapted once per epoch. */
+    SOM_BATCH = 1
+};
+
+
 /**
 *
 * @brief   Parameters of self-organized feature map.
@@ -184,6 +200,49 @@ public:
      */
     std::size_t train(const dataset & input_data, const size_t num_epochs, bool autostop);
 
+    /**
+     *
+     * @brief   Trains self-organized feature map (SOM) in batch mode.
+     * @details Neuron-winners of all input patterns are found in parallel, after that every neuron weight is replaced
+     *           by the mean of the patterns that are won by the neuron and its neighbors weighted by their influence.
+     *           Training does not depend on the order of the patterns and does not use the learning rate.
+     *
+     * @param[in] input_data: input dataset for training.
+     * @param[in] num_epochs: number of epochs for training.
+     * @param[in] autostop: stop learining when convergance is too low.
+     *
+     * @return  Returns number of learining iterations.
+     *
+     */
+    std::size_t train_batch(const dataset & input_data, const size_t num_epochs, bool autostop);
+
+    /**
+     *
+     * @brief   Trains self-organized feature map (SOM) in batch mode using points stored row by row in a contiguous buffer.
+     *
+     * @param[in] p_data: input points for training, they are not copied.
+     * @param[in] num_epochs: number of epochs for training.
+     * @param[in] autostop: stop learining when convergance is too low.
+     *
+     * @return  Returns number of learining iterations.
+     *
+     */
+    std::size_t train_batch(const utils::metric::points_view<double> & p_data, const size_t num_epochs, bool autostop);
+
+    /**
+     *
+     * @brief   Trains self-organized feature map (SOM) in batch mode using single precision points, weights are
+     *           updated in double precision.
+     *
+     * @param[in] p_data: input points for training, they are not copied.
+     * @param[in] num_epochs: number of epochs for training.
+     * @param[in] autostop: stop learining when convergance is too low.
+     *
+     * @return  Returns number of learining iterations.
+     *
+     */
+    std::size_t train_batch(const utils::metric::points_view<float> & p_data, const size_t num_epochs, bool autostop);
+
     /**
      *
      * @brief   Initialize SOM network by loading weights.
@@ -288,9 +347,11 @@ private:
      * @param[in] type: type of initialization of initial neuron weights (random,
      *             random in center of the input data, random distributed in
      *             data, ditributed in line with uniform grid).
+     * @param[in] p_minimum: minimum value of every dimension of the input data.
+     * @param[in] p_maximum: maximum value of every dimension of the input data.
      *
      */
-    void create_initial_weights(const som_init_type type);
+    void create_initial_weights(const som_init_type type, const std::vector<double> & p_minimum, const std::vector<double> & p_maximum);
 
     /**
      *
@@ -314,6 +375,45 @@ private:
      */
     std::size_t adaptation(const size_t index_winner, const pattern & input_pattern);
 
+    /**
+     *
+     * @brief   Trains the map in batch mode using points of the specified type.
+     *
+     */
+    template <typename TypeValue>
+    std::size_t train_view(const utils::metric::points_view<TypeValue> & p_data, const size_t num_epochs, bool autostop);
+
+    /**
+     *
+     * @brief   Finds neuron-winner of every input pattern in parallel.
+     *
+     * @param[in]  p_data: input patterns.
+     * @param[out] p_winners: index of neuron-winner of every input pattern.
+     *
+     */
+    template <typename TypeValue>
+    void calculate_winners(const utils::metric::points_view<TypeValue> & p_data, std::vector<std::size_t> & p_winners) const;
+
+    /**
+     *
+     * @brief   Replaces weights of neurons by the neighborhood weighted means of the input patterns.
+     *
+     * @param[in] p_data: input patterns.
+     * @param[in] p_winners: index of neuron-winner of every input pattern.
+     *
+     */
+    template <typename TypeValue>
+    void batch_adaptation(const utils::metric::points_view<TypeValue> & p_data, const std::vector<std::size_t> & p_winners);
+
+    /**
+     *
+     * @brief   Stores amount of captured objects and captured objects by each neuron.
+     *
+     * @param[in] p_winners: index of neuron-winner of every input pattern.
+     *
+     */
+    void update_statistics(const std::vector<std::size_t> & p_winners);
+
     /**
      *
      * @brief   Returns maximum changes of weight in line with comparison between previous weights
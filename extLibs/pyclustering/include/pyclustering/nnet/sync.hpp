@@ -99,6 +99,38 @@ public:
 };
 
 
+/**
+ *
+ * @brief   Coupling between Kuramoto oscillators in compressed sparse row form that is used by the flat integrator.
+ * @details Coupling term of oscillator 'i' is 'm_scale[i] * sum(w_ij * sin(phase_j - phase_i))' where neighbors 'j'
+ *           are stored in range [m_offsets[i], m_offsets[i + 1]) of 'm_neighbors'. If 'm_all_to_all' is set then
+ *           neighbor lists are not stored and each oscillator is connected to all others, offsets are filled in
+ *           both cases.
+ *
+ */
+struct sync_coupling {
+public:
+    std::vector<std::size_t>    m_offsets       = { };
+    std::vector<std::size_t>    m_neighbors     = { };
+    std::vector<double>         m_weights       = { };      /* empty if all connections have the same strength */
+    std::vector<double>         m_scale         = { };      /* coupling strength divided by normalization of the oscillator */
+    std::vector<double>         m_frequency     = { };
+    bool                        m_all_to_all    = false;
+
+public:
+    /**
+     *
+     * @brief   Returns amount of neighbors of the oscillator.
+     *
+     * @param[in] p_index: index of the oscillator.
+     *
+     */
+    inline std::size_t degree(const std::size_t p_index) const {
+        return m_offsets[p_index + 1] - m_offsets[p_index];
+    }
+};
+
+
 /**
  *
  * @brief   Provides methods related to calculation of ordering parameters.
@@ -313,6 +345,15 @@ protected:
 private:
     equation<double>  m_equation;
 
+    sync_coupling           m_flat_coupling;
+    bool                    m_coupling_enabled      = false;
+
+    std::vector<double>     m_sin_phase;
+    std::vector<double>     m_cos_phase;
+    std::vector<double>     m_sin_coupling;
+    std::vector<double>     m_cos_coupling;
+    std::vector<double>     m_partial_sums;
+
 public:
     /**
      *
@@ -555,6 +596,58 @@ protected:
     */
     virtual void set_equation(equation<double> & solver);
 
+    /**
+    *
+    * @brief   Creates coupling that is used by the flat integrator instead of the generic solver of 'phase_kuramoto_equation'.
+    * @details Should be overridden together with 'phase_kuramoto' - classes whose oscillator equation can not be
+    *           expressed by 'sync_coupling' should return false, in this case the generic solver is used.
+    *
+    * @param[out] p_coupling: coupling between oscillators in the network.
+    *
+    * @return  True if the flat integrator can be used.
+    *
+    */
+    virtual bool create_coupling(sync_coupling & p_coupling) const;
+
+    /**
+    *
+    * @brief   Fills neighbors of the oscillators in line with current connections of the network.
+    * @details Neighbor lists are not stored if 'p_allow_all_to_all' is true and each oscillator is connected to all others.
+    *
+    * @param[in]  p_allow_all_to_all: if true - all-to-all coupling is represented without neighbor lists.
+    * @param[out] p_coupling: coupling whose neighbors are filled.
+    *
+    */
+    void create_coupling_structure(const bool p_allow_all_to_all, sync_coupling & p_coupling) const;
+
+private:
+    /**
+    *
+    * @brief   Prepares flat integrator for the simulation, coupling is created in line with current connections.
+    *
+    */
+    void prepare_integrator();
+
+    /**
+    *
+    * @brief   Calculates new phases of the oscillators using the flat integrator.
+    * @details Phases of neighbors are fixed during the step as in case of the generic solver, therefore coupling
+    *           sums are calculated once per step and each oscillator is integrated as independent scalar equation.
+    *
+    */
+    void calculate_phases_flat(
+        const solve_type solver,
+        const double t,
+        const double step,
+        const double int_step);
+
+    /**
+    *
+    * @brief   Calculates level of local synchronization using the flat coupling.
+    *
+    */
+    double calculate_local_order_flat();
+
 private:
     /**
     *
@@ -94,6 +94,8 @@ protected:
 
     void phase_kuramoto_equation(const double t, const differ_state<double> & inputs, const differ_extra<void *> & argv, differ_state<double> & outputs) const override;
 
+    bool create_coupling(sync_coupling & p_coupling) const override;
+
 private:
     void validate_pattern(const syncpr_pattern & sample) const;
 
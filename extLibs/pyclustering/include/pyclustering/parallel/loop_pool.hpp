@@ -0,0 +1,163 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#pragma once
+
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace pyclustering {
+
+namespace parallel {
+
+
+/**
+*
+* @brief   Persistent pool of worker threads that executes chunks of parallel loops.
+* @details Thread that runs the loop takes part in the execution, so nested loops and loops started
+*          concurrently by several threads always make progress. Chunks are claimed dynamically by
+*          the atomic counter, so uneven chunks are balanced between threads.
+*
+*/
+class loop_pool {
+public:
+    using chunk_proc = std::function<void(const std::size_t)>;
+
+private:
+    /**
+    *
+    * @brief   Loop that is being executed, chunks are claimed in order.
+    *
+    */
+    struct loop_job {
+        const chunk_proc *          m_chunk     = nullptr;
+        std::size_t                 m_amount    = 0;
+        std::atomic<std::size_t>    m_next      = { 0 };
+        std::atomic<std::size_t>    m_done      = { 0 };
+        std::exception_ptr          m_error     = nullptr;
+        std::mutex                  m_error_mutex;
+    };
+
+    using loop_job_ptr = std::shared_ptr<loop_job>;
+
+public:
+    static const std::size_t        CHUNKS_PER_THREAD;
+
+private:
+    std::vector<std::thread>        m_workers   = { };
+
+    std::deque<loop_job_ptr>        m_jobs      = { };
+
+    std::mutex                      m_mutex;
+
+    std::condition_variable         m_job_available;
+
+    std::condition_variable         m_job_done;
+
+    bool                            m_stop      = false;
+
+public:
+    /**
+    *
+    * @brief   Creates pool where the loop is executed by the specified amount of threads.
+    *
+    * @param[in] p_amount_threads: amount of threads including the thread that runs the loop.
+    *
+    */
+    explicit loop_pool(const std::size_t p_amount_threads);
+
+    loop_pool(const loop_pool & p_pool) = delete;
+
+    loop_pool(loop_pool && p_pool) = delete;
+
+    ~loop_pool();
+
+public:
+    /**
+    *
+    * @brief   Returns pool that is used by parallel loops, by default it uses all hardware threads.
+    *
+    */
+    static loop_pool & get_instance();
+
+    /**
+    *
+    * @brief   Executes chunks of the loop and returns when all of them are finished.
+    *
+    * @param[in] p_amount_chunks: amount of chunks.
+    * @param[in] p_chunk: procedure that executes chunk with the specified index.
+    *
+    * @throw   Rethrows the first exception thrown by any of chunks.
+    *
+    */
+    void execute(const std::size_t p_amount_chunks, const chunk_proc & p_chunk);
+
+    /**
+    *
+    * @brief   Changes amount of threads that execute loops, must not be called while loops are running.
+    *
+    * @param[in] p_amount_threads: amount of threads including the thread that runs the loop.
+    *
+    */
+    void set_amount_threads(const std::size_t p_amount_threads);
+
+    /**
+    *
+    * @brief   Returns amount of threads that execute loops including the thread that runs the loop.
+    *
+    */
+    std::size_t get_amount_threads() const;
+
+    /**
+    *
+    * @brief   Returns grain size that splits the loop into several chunks per thread.
+    *
+    * @param[in] p_amount_iterations: amount of iterations of the loop.
+    *
+    */
+    std::size_t get_default_grain(const std::size_t p_amount_iterations) const;
+
+private:
+    void start(const std::size_t p_amount_threads);
+
+    void stop();
+
+    void work();
+
+    void run_chunks(loop_job & p_job);
+};
+
+
+}
+
+}
@@ -24,30 +24,30 @@
 #pragma once
 
 
+#include <algorithm>
 #include <cstddef>
 #include <functional>
-#include <future>
-#include <vector>
-
-#include <pyclustering/parallel/spinlock.hpp>
+#include <iterator>
 
 
 /* Available options: 
-    1. PARALLEL_IMPLEMENTATION_ASYNC_POOL - own parallel implementation based on std::async pool
-    2. PARALLEL_IMPLEMENTATION_NONE       - parallel implementation is not used
-    3. PARALLEL_IMPLEMENTATION_PPL        - parallel PPL implementation (windows system only)
-    4. PARALLEL_IMPLEMENTATION_OPENMP     - parallel OpenMP implementation */
+    1. PARALLEL_IMPLEMENTATION_THREAD_POOL - own parallel implementation based on the persistent loop pool
+    2. PARALLEL_IMPLEMENTATION_NONE        - parallel implementation is not used
+    3. PARALLEL_IMPLEMENTATION_PPL         - parallel PPL implementation (windows system only)
+    4. PARALLEL_IMPLEMENTATION_OPENMP      - parallel OpenMP implementation */
 
 
 #if defined(WIN32) || (_WIN32) || (_WIN64)
 #define PARALLEL_IMPLEMENTATION_PPL
 #else
-#define PARALLEL_IMPLEMENTATION_ASYNC_POOL
+#define PARALLEL_IMPLEMENTATION_THREAD_POOL
 #endif
 
 
 #if defined(PARALLEL_IMPLEMENTATION_PPL)
 #include <ppl.h>
+#elif defined(PARALLEL_IMPLEMENTATION_THREAD_POOL)
+#include <pyclustering/parallel/loop_pool.hpp>
 #endif
 
 
@@ -56,120 +56,87 @@ namespace pyclustering {
 namespace parallel {
 
 
-/* Pool of threads is used to prevent overhead in case of nested loop */
-static const std::size_t AMOUNT_HARDWARE_THREADS = std::thread::hardware_concurrency();
-static const std::size_t AMOUNT_THREADS = (AMOUNT_HARDWARE_THREADS > 1) ? (AMOUNT_HARDWARE_THREADS - 1) : 0;
-static std::vector<std::future<void>> FUTURE_STORAGE(AMOUNT_THREADS);
-static std::vector<spinlock> FUTURE_LOCKS(AMOUNT_THREADS);
+/**
+*
+* @brief   Executes task for every index in range [p_start, p_end) in parallel.
+* @details Calls may be nested and may be performed concurrently by several threads.
+*
+* @param[in] p_start: first index.
+* @param[in] p_end: index after the last one.
+* @param[in] p_task: task that is called for every index.
+* @param[in] p_grain: amount of indexes that are processed by one chunk, if 0 then range is split into several chunks per thread.
+*
+*/
+template <typename TypeIndex, typename TypeAction>
+void parallel_for(const TypeIndex p_start, const TypeIndex p_end, const TypeAction & p_task, const std::size_t p_grain = 0) {
+#if defined(PARALLEL_IMPLEMENTATION_THREAD_POOL)
+    if (!(p_start < p_end)) {
+        return;
+    }
 
+    loop_pool & pool = loop_pool::get_instance();
 
-template <typename TypeIndex, typename TypeAction>
-void parallel_for(const TypeIndex p_start, const TypeIndex p_end, const TypeAction & p_task) {
-#if defined(PARALLEL_IMPLEMENTATION_ASYNC_POOL)
-    const TypeIndex step = (p_end - p_start) / (AMOUNT_THREADS + 1);
-    TypeIndex current_start = p_start;
-    TypeIndex current_end = p_start + step;
-
-    std::vector<std::size_t> captured_feature;
-
-    for (std::size_t i = 0; i < AMOUNT_THREADS; ++i) {
-        const auto async_task = [&p_task, current_start, current_end](){
-            for (TypeIndex i = current_start; i < current_end; ++i) {
-                p_task(i);
-            }
-        };
-
-        std::size_t free_index = (std::size_t) -1;
-        for (std::size_t i = 0; i < AMOUNT_THREADS; i++) {
-            if (FUTURE_LOCKS[i].try_lock()) {
-                free_index = i;
-                break;
-            }
-        }
+    const std::size_t amount = (std::size_t) (p_end - p_start);
+    const std::size_t grain = (p_grain > 0) ? p_grain : pool.get_default_grain(amount);
 
-        if (free_index != (std::size_t) -1) {
-            FUTURE_STORAGE[free_index] = std::async(std::launch::async, async_task);
-            captured_feature.push_back(free_index);
-        }
-        else {
-            async_task();
+    /* single chunk is executed in place without type erasure of the task */
+    if ((pool.get_amount_threads() == 1) || (amount <= grain)) {
+        for (TypeIndex i = p_start; i < p_end; ++i) {
+            p_task(i);
         }
 
-        current_start = current_end;
-        current_end += step;
+        return;
     }
 
-    for (TypeIndex i = current_start; i < p_end; ++i) {
-        p_task(i);
-    }
+    pool.execute((amount + grain - 1) / grain, [&p_task, p_start, amount, grain](const std::size_t p_chunk) {
+        const TypeIndex chunk_start = p_start + (TypeIndex) (p_chunk * grain);
+        const TypeIndex chunk_end = p_start + (TypeIndex) std::min(p_chunk * grain + grain, amount);
 
-    for (auto index_feature : captured_feature) {
-        FUTURE_STORAGE[index_feature].get();
-        FUTURE_LOCKS[index_feature].unlock();
-    }
+        for (TypeIndex i = chunk_start; i < chunk_end; ++i) {
+            p_task(i);
+        }
+    });
 #elif defined(PARALLEL_IMPLEMENTATION_PPL)
+    (void) p_grain;
     concurrency::parallel_for(p_start, p_end, p_task);
 #elif defined(PARALLEL_IMPLEMENTATION_OPENMP)
+    (void) p_grain;
     #pragma omp parallel for
-    for (TypeIndex i = p_start; i < p_end, i++) {
+    for (TypeIndex i = p_start; i < p_end; i++) {
         p_task(i);
     }
 #else
-    for (std::size_t i = p_start; i < p_end; i++) {
+    (void) p_grain;
+    for (TypeIndex i = p_start; i < p_end; i++) {
         p_task(i);
     }
 #endif
 }
 
 
+/**
+*
+* @brief   Executes task for every element in range [p_begin, p_end) in parallel.
+* @details Iterators should be random access iterators.
+*
+* @param[in] p_begin: iterator to the first element.
+* @param[in] p_end: iterator after the last element.
+* @param[in] p_task: task that is called for every element.
+* @param[in] p_grain: amount of elements that are processed by one chunk, if 0 then range is split into several chunks per thread.
+*
+*/
 template <typename TypeIter, typename TypeAction>
-void parallel_for_each(const TypeIter p_begin, const TypeIter p_end, const TypeAction & p_task) {
-#if defined(PARALLEL_IMPLEMENTATION_ASYNC_POOL)
-    const std::size_t step = std::distance(p_begin, p_end) / (AMOUNT_THREADS + 1);
-
-    auto current_start = p_begin;
-    auto current_end = p_begin + step;
-
-    std::vector<std::size_t> captured_feature;
-
-    for (std::size_t i = 0; i < AMOUNT_THREADS; ++i) {
-        auto async_task = [&p_task, current_start, current_end](){
-            for (auto iter = current_start; iter != current_end; ++iter) {
-                p_task(*iter);
-            }
-        };
-
-        std::size_t free_index = (std::size_t) -1;
-        for (std::size_t i = 0; i < AMOUNT_THREADS; i++) {
-            if (FUTURE_LOCKS[i].try_lock()) {
-                free_index = i;
-                break;
-            }
-        }
-
-        if (free_index != (std::size_t) -1) {
-            FUTURE_STORAGE[free_index] = std::async(std::launch::async, async_task);
-            captured_feature.push_back(free_index);
-        }
-        else {
-            async_task();
-        }
-
-        current_start = current_end;
-        current_end += step;
-    }
-
-    for (auto iter = current_start; iter != p_end; ++iter) {
-        p_task(*iter);
-    }
-
-    for (auto index_feature : captured_feature) {
-        FUTURE_STORAGE[index_feature].get();
-        FUTURE_LOCKS[index_feature].unlock();
-    }
+void parallel_for_each(const TypeIter p_begin, const TypeIter p_end, const TypeAction & p_task, const std::size_t p_grain = 0) {
+#if defined(PARALLEL_IMPLEMENTATION_THREAD_POOL)
+    const std::size_t amount = (std::size_t) std::distance(p_begin, p_end);
+    parallel_for(std::size_t(0), amount, [&p_task, p_begin](const std::size_t p_index) {
+        p_task(*std::next(p_begin, p_index));
+    }, p_grain);
 #elif defined(PARALLEL_IMPLEMENTATION_PPL)
+    (void) p_grain;
     concurrency::parallel_for_each(p_begin, p_end, p_task);
 #else
+    (void) p_grain;
     for (auto iter = p_begin; iter != p_end; ++iter) {
         p_task(*iter);
     }
@@ -178,8 +145,8 @@ void parallel_for_each(const TypeIter p_begin, const TypeIter p_end, const TypeA
 
 
 template <typename TypeContainer, typename TypeAction>
-void parallel_for_each(const TypeContainer & p_container, const TypeAction & p_task) {
-    parallel_for_each(std::begin(p_container), std::end(p_container), p_task);
+void parallel_for_each(const TypeContainer & p_container, const TypeAction & p_task, const std::size_t p_grain = 0) {
+    parallel_for_each(std::begin(p_container), std::end(p_container), p_task, p_grain);
 }
 
 
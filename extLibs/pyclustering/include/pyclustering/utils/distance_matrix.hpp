@@ -0,0 +1,302 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#pragma once
+
+
+#include <pyclustering/definitions.hpp>
+#include <pyclustering/utils/metric_simd.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+
+namespace pyclustering {
+
+namespace utils {
+
+namespace metric {
+
+
+/**
+ *
+ * @brief   Metrics supported by the distance matrix engine.
+ *
+ */
+enum class distance_type {
+    EUCLIDEAN,
+    EUCLIDEAN_SQUARE,
+    MANHATTAN,
+    CHEBYSHEV,
+    CANBERRA,
+    CHI_SQUARE
+};
+
+
+/**
+ *
+ * @brief   Non-owning view of points stored row by row in a contiguous buffer.
+ *
+ */
+template <typename TypeValue>
+class points_view {
+private:
+    const TypeValue *   m_data      = nullptr;
+    std::size_t         m_rows      = 0;
+    std::size_t         m_cols      = 0;
+    std::size_t         m_stride    = 0;
+
+public:
+    points_view() = default;
+
+    /**
+     *
+     * @param[in] p_data: pointer to the first coordinate of the first point.
+     * @param[in] p_rows: amount of points.
+     * @param[in] p_cols: amount of coordinates of each point.
+     * @param[in] p_stride: distance between beginnings of consecutive points in elements.
+     *
+     */
+    points_view(const TypeValue * p_data, const std::size_t p_rows, const std::size_t p_cols, const std::size_t p_stride) :
+        m_data(p_data), m_rows(p_rows), m_cols(p_cols), m_stride(p_stride)
+    { }
+
+public:
+    const TypeValue * row(const std::size_t p_index) const { return m_data + p_index * m_stride; }
+
+    std::size_t rows() const { return m_rows; }
+
+    std::size_t cols() const { return m_cols; }
+
+    std::size_t stride() const { return m_stride; }
+};
+
+
+/**
+ *
+ * @brief   Symmetric distance matrix with zero diagonal that stores only the upper triangle.
+ * @details Requires n * (n - 1) / 2 values instead of n * n, distances of the point to the following points are contiguous.
+ *
+ */
+template <typename TypeValue = double>
+class packed_distance_matrix {
+private:
+    std::vector<TypeValue>  m_values;
+    std::size_t             m_size = 0;
+
+public:
+    packed_distance_matrix() = default;
+
+    explicit packed_distance_matrix(const std::size_t p_size) { resize(p_size); }
+
+public:
+    void resize(const std::size_t p_size) {
+        m_size = p_size;
+        m_values.assign(p_size * (p_size - (p_size > 0)) / 2, TypeValue(0));
+    }
+
+    std::size_t size() const { return m_size; }
+
+    /**
+     *
+     * @brief   Returns position of the distance between points i < j in the packed storage.
+     *
+     */
+    std::size_t index(const std::size_t p_index1, const std::size_t p_index2) const {
+        return p_index1 * (2 * m_size - p_index1 - 1) / 2 + (p_index2 - p_index1 - 1);
+    }
+
+    TypeValue operator()(const std::size_t p_index1, const std::size_t p_index2) const {
+        if (p_index1 == p_index2) {
+            return TypeValue(0);
+        }
+
+        return (p_index1 < p_index2) ? m_values[index(p_index1, p_index2)] : m_values[index(p_index2, p_index1)];
+    }
+
+    /**
+     *
+     * @brief   Returns distances between the point and all points with greater index.
+     *
+     */
+    TypeValue * upper_row(const std::size_t p_index) { return m_values.data() + index(p_index, p_index + 1); }
+
+    const TypeValue * upper_row(const std::size_t p_index) const { return m_values.data() + index(p_index, p_index + 1); }
+
+    std::vector<TypeValue> & data() { return m_values; }
+
+    const std::vector<TypeValue> & data() const { return m_values; }
+};
+
+
+/**
+ *
+ * @brief   Block of the distance matrix computed by the engine.
+ * @details Only distances above the diagonal are valid (column > row).
+ *
+ */
+struct distance_tile {
+    std::size_t     m_row_begin = 0;
+    std::size_t     m_row_end   = 0;
+    std::size_t     m_col_begin = 0;
+    std::size_t     m_col_end   = 0;
+    const double *  m_values    = nullptr;
+    std::size_t     m_stride    = 0;
+
+    /**
+     *
+     * @brief   Returns first valid column of the row.
+     *
+     */
+    std::size_t first_column(const std::size_t p_row) const { return std::max(m_col_begin, p_row + 1); }
+
+    double operator()(const std::size_t p_row, const std::size_t p_col) const {
+        return m_values[(p_row - m_row_begin) * m_stride + (p_col - m_col_begin)];
+    }
+};
+
+
+using distance_tile_handler = std::function<void(const distance_tile &)>;
+
+
+/**
+ *
+ * @brief   Computes the upper triangle of the distance matrix tile by tile on all threads.
+ * @details Tiles are small enough to keep the involved points in cache. Euclidean distances are computed
+ *           as ||a||^2 + ||b||^2 - 2ab using blocked dot products, other metrics use the vectorized kernels.
+ *           Handler is called concurrently for disjoint tiles, every pair of points appears in exactly one tile.
+ *
+ * @param[in] p_points: input points.
+ * @param[in] p_type: metric.
+ * @param[in] p_handler: consumer of the computed tiles.
+ *
+ */
+template <typename TypeValue>
+void for_each_distance_tile(const points_view<TypeValue> & p_points, const distance_type p_type, const distance_tile_handler & p_handler);
+
+
+/**
+ *
+ * @brief   Computes full symmetric distance matrix.
+ *
+ * @param[in]  p_points: input points.
+ * @param[in]  p_type: metric.
+ * @param[out] p_matrix: output n x n matrix.
+ * @param[in]  p_leading_dimension: distance between beginnings of consecutive rows of the output matrix.
+ *
+ */
+template <typename TypeValue>
+void compute_distance_matrix(const points_view<TypeValue> & p_points, const distance_type p_type, double * p_matrix, const std::size_t p_leading_dimension) {
+    for (std::size_t i = 0; i < p_points.rows(); i++) {
+        p_matrix[i * p_leading_dimension + i] = 0.0;
+    }
+
+    for_each_distance_tile(p_points, p_type, [p_matrix, p_leading_dimension](const distance_tile & p_tile) {
+        for (std::size_t i = p_tile.m_row_begin; i < p_tile.m_row_end; i++) {
+            for (std::size_t j = p_tile.first_column(i); j < p_tile.m_col_end; j++) {
+                const double distance = p_tile(i, j);
+                p_matrix[i * p_leading_dimension + j] = distance;
+                p_matrix[j * p_leading_dimension + i] = distance;
+            }
+        }
+    });
+}
+
+
+/**
+ *
+ * @brief   Computes distance matrix in the packed upper triangular storage.
+ *
+ * @param[in]  p_points: input points.
+ * @param[in]  p_type: metric.
+ * @param[out] p_matrix: output packed matrix.
+ *
+ */
+template <typename TypeValue, typename TypeStorage>
+void compute_distance_matrix(const points_view<TypeValue> & p_points, const distance_type p_type, packed_distance_matrix<TypeStorage> & p_matrix) {
+    p_matrix.resize(p_points.rows());
+
+    for_each_distance_tile(p_points, p_type, [&p_matrix](const distance_tile & p_tile) {
+        for (std::size_t i = p_tile.m_row_begin; i < p_tile.m_row_end; i++) {
+            const std::size_t first = p_tile.first_column(i);
+            if (first >= p_tile.m_col_end) {
+                continue;
+            }
+
+            TypeStorage * row = p_matrix.data().data() + p_matrix.index(i, first);
+            for (std::size_t j = first; j < p_tile.m_col_end; j++) {
+                row[j - first] = (TypeStorage) p_tile(i, j);
+            }
+        }
+    });
+}
+
+
+/**
+ *
+ * @brief   Finds the point of the set that is the closest to the specified point in line with Euclidean distance.
+ * @details Four points of the set are processed by each pass over the coordinates of the specified point.
+ *
+ * @param[in]  p_point: coordinates of the point, the same amount as columns of the set.
+ * @param[in]  p_points: non-empty set of points where the closest one is searched.
+ * @param[out] p_distance: square Euclidean distance to the closest point, can be nullptr.
+ *
+ * @return  Index of the closest point in the set, the lowest index wins in case of equal distances.
+ *
+ */
+template <typename TypeValue>
+std::size_t find_closest_point(const TypeValue * p_point, const points_view<TypeValue> & p_points, double * p_distance = nullptr);
+
+
+/**
+ *
+ * @brief   Computes full symmetric distance matrix of the points stored in pyclustering containers.
+ *
+ * @param[in]  p_points: input points.
+ * @param[in]  p_type: metric.
+ * @param[out] p_matrix: output n x n matrix.
+ *
+ */
+void compute_distance_matrix(const dataset & p_points, const distance_type p_type, dataset & p_matrix);
+
+
+/**
+ *
+ * @brief   Copies points stored in pyclustering container into a contiguous buffer.
+ *
+ * @param[in]  p_points: input points.
+ * @param[out] p_buffer: output buffer, points are stored row by row.
+ *
+ * @return  View of the buffer.
+ *
+ */
+points_view<double> pack_points(const dataset & p_points, std::vector<double> & p_buffer);
+
+
+}
+
+}
+
+}
@@ -25,12 +25,15 @@
 
 
 #include <pyclustering/definitions.hpp>
+#include <pyclustering/utils/metric_simd.hpp>
+#include <pyclustering/utils/distance_matrix.hpp>
 
 #include <algorithm>
 #include <cmath>
 #include <exception>
 #include <functional>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 
@@ -77,6 +80,23 @@ double euclidean_distance_square(const TypeContainer & point1, const TypeContain
 }
 
 
+/**
+ *
+ * @brief   Vectorized square of Euclidean distance for contiguous containers, see 'pyclustering::utils::metric::simd'.
+ *
+ */
+template <>
+inline double euclidean_distance_square<std::vector<double>>(const std::vector<double> & point1, const std::vector<double> & point2) {
+    return simd::euclidean_distance_square(point1.data(), point2.data(), point2.size());
+}
+
+
+template <>
+inline double euclidean_distance_square<std::vector<float>>(const std::vector<float> & point1, const std::vector<float> & point2) {
+    return simd::euclidean_distance_square(point1.data(), point2.data(), point2.size());
+}
+
+
 /**
  *
  * @brief   Calculates Euclidean distance between points.
@@ -117,6 +137,23 @@ double manhattan_distance(const TypeContainer & point1, const TypeContainer & po
 }
 
 
+/**
+ *
+ * @brief   Vectorized Manhattan distance for contiguous containers, see 'pyclustering::utils::metric::simd'.
+ *
+ */
+template <>
+inline double manhattan_distance<std::vector<double>>(const std::vector<double> & point1, const std::vector<double> & point2) {
+    return simd::manhattan_distance(point1.data(), point2.data(), point2.size());
+}
+
+
+template <>
+inline double manhattan_distance<std::vector<float>>(const std::vector<float> & point1, const std::vector<float> & point2) {
+    return simd::manhattan_distance(point1.data(), point2.data(), point2.size());
+}
+
+
 /**
  *
  * @brief   Calculates Chebyshev distance between points.
@@ -141,6 +178,23 @@ double chebyshev_distance(const TypeContainer & point1, const TypeContainer & po
 }
 
 
+/**
+ *
+ * @brief   Vectorized Chebyshev distance for contiguous containers, see 'pyclustering::utils::metric::simd'.
+ *
+ */
+template <>
+inline double chebyshev_distance<std::vector<double>>(const std::vector<double> & point1, const std::vector<double> & point2) {
+    return simd::chebyshev_distance(point1.data(), point2.data(), point2.size());
+}
+
+
+template <>
+inline double chebyshev_distance<std::vector<float>>(const std::vector<float> & point1, const std::vector<float> & point2) {
+    return simd::chebyshev_distance(point1.data(), point2.data(), point2.size());
+}
+
+
 /**
  *
  * @brief   Calculates Minkowski distance between points.
@@ -186,19 +240,37 @@ double canberra_distance(const TypeContainer & point1, const TypeContainer & poi
     for (const auto & dim_point2 : point2) {
         const auto dim_point1 = *iter_point1;
 
+        ++iter_point1;
+
         const double divider = std::abs(dim_point1) + std::abs(dim_point2);
         if (divider == 0) {
             continue;
         }
 
         distance += std::abs(dim_point1 - dim_point2) / divider;
-        ++iter_point1;
     }
 
     return distance;
 }
 
 
+/**
+ *
+ * @brief   Vectorized Canberra distance for contiguous containers, see 'pyclustering::utils::metric::simd'.
+ *
+ */
+template <>
+inline double canberra_distance<std::vector<double>>(const std::vector<double> & point1, const std::vector<double> & point2) {
+    return simd::canberra_distance(point1.data(), point2.data(), point2.size());
+}
+
+
+template <>
+inline double canberra_distance<std::vector<float>>(const std::vector<float> & point1, const std::vector<float> & point2) {
+    return simd::canberra_distance(point1.data(), point2.data(), point2.size());
+}
+
+
 /**
  *
  * @brief   Calculates Chi square distance between points.
@@ -217,19 +289,37 @@ double chi_square_distance(const TypeContainer & point1, const TypeContainer & p
     for (const auto & dim_point2 : point2) {
         const auto dim_point1 = *iter_point1;
 
+        ++iter_point1;
+
         const double divider = std::abs(dim_point1) + std::abs(dim_point2);
         if (divider == 0) {
             continue;
         }
 
         distance += std::pow(dim_point1 - dim_point2, 2) / divider;
-        ++iter_point1;
     }
 
     return distance;
 }
 
 
+/**
+ *
+ * @brief   Vectorized Chi square distance for contiguous containers, see 'pyclustering::utils::metric::simd'.
+ *
+ */
+template <>
+inline double chi_square_distance<std::vector<double>>(const std::vector<double> & point1, const std::vector<double> & point2) {
+    return simd::chi_square_distance(point1.data(), point2.data(), point2.size());
+}
+
+
+template <>
+inline double chi_square_distance<std::vector<float>>(const std::vector<float> & point1, const std::vector<float> & point2) {
+    return simd::chi_square_distance(point1.data(), point2.data(), point2.size());
+}
+
+
 /**
  *
  * @brief   Calculates Gower distance between points.
@@ -621,6 +711,7 @@ void distance_matrix(const TypeContainer & p_points, const distance_metric<point
 /**
  *
  * @brief   Calculates distance matrix using points container using Euclidean distance.
+ * @details Dataset is processed by the tiled parallel engine, see 'compute_distance_matrix'.
  *
  * @param[in]  p_points: input data that is represented by points.
  * @param[out] p_distance_matrix: output distance matrix of points.
@@ -628,7 +719,12 @@ void distance_matrix(const TypeContainer & p_points, const distance_metric<point
  */
 template <typename TypeContainer>
 void distance_matrix(const TypeContainer & p_points, TypeContainer & p_distance_matrix) {
-    distance_matrix(p_points, distance_metric_factory<point>::euclidean(), p_distance_matrix);
+    if constexpr (std::is_same<TypeContainer, dataset>::value) {
+        compute_distance_matrix(p_points, distance_type::EUCLIDEAN, p_distance_matrix);
+    }
+    else {
+        distance_matrix(p_points, distance_metric_factory<point>::euclidean(), p_distance_matrix);
+    }
 }
 
 
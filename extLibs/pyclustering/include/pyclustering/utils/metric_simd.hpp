@@ -0,0 +1,224 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#pragma once
+
+
+#include <cstddef>
+
+
+namespace pyclustering {
+
+namespace utils {
+
+namespace metric {
+
+namespace simd {
+
+
+/**
+ *
+ * @brief   Instruction sets that distance kernels are implemented for.
+ *
+ */
+enum class instruction_set {
+    SCALAR = 0,
+    SSE2,
+    AVX2,
+    AVX512
+};
+
+
+/**
+ *
+ * @brief   Distance kernel that operates on two contiguous arrays of coordinates.
+ *
+ */
+template <typename TypeValue>
+using distance_kernel = double (*)(const TypeValue * p_point1, const TypeValue * p_point2, const std::size_t p_size);
+
+
+/**
+ *
+ * @brief   Kernel that calculates dot products of the point with four other points of the same size.
+ *
+ */
+template <typename TypeValue>
+using dot_product_block_kernel = void (*)(const TypeValue * p_point, const TypeValue * const * p_others, const std::size_t p_size, double * p_result);
+
+
+/**
+ *
+ * @brief   Kernel that calculates square Euclidean distances from the point to four other points of the same size.
+ *
+ */
+template <typename TypeValue>
+using distance_block_kernel = void (*)(const TypeValue * p_point, const TypeValue * const * p_others, const std::size_t p_size, double * p_result);
+
+
+/**
+ *
+ * @brief   Amount of points processed by the block kernels.
+ *
+ */
+constexpr std::size_t DOT_PRODUCT_BLOCK_SIZE = 4;
+
+
+/**
+ *
+ * @brief   Set of distance kernels implemented for one instruction set.
+ *
+ */
+template <typename TypeValue>
+struct kernel_set {
+    instruction_set             isa                         = instruction_set::SCALAR;
+    distance_kernel<TypeValue>  euclidean_distance_square   = nullptr;
+    distance_kernel<TypeValue>  manhattan_distance          = nullptr;
+    distance_kernel<TypeValue>  chebyshev_distance          = nullptr;
+    distance_kernel<TypeValue>  canberra_distance           = nullptr;
+    distance_kernel<TypeValue>  chi_square_distance         = nullptr;
+    distance_kernel<TypeValue>  dot_product                 = nullptr;  /* not a distance, shares the signature */
+    dot_product_block_kernel<TypeValue> dot_product_block   = nullptr;
+    distance_block_kernel<TypeValue> euclidean_distance_square_block = nullptr;
+};
+
+
+/**
+ *
+ * @brief   Returns the widest instruction set that is supported by the processor and by the build.
+ *
+ */
+instruction_set detect_instruction_set();
+
+
+/**
+ *
+ * @brief   Returns name of the instruction set.
+ *
+ */
+const char * instruction_set_name(const instruction_set p_isa);
+
+
+/**
+ *
+ * @brief   Returns kernels for the specified instruction set.
+ * @details If the instruction set is not supported by the processor or by the build then scalar kernels are returned.
+ *
+ * @param[in] p_isa: requested instruction set.
+ *
+ */
+template <typename TypeValue>
+const kernel_set<TypeValue> & get_kernels(const instruction_set p_isa);
+
+template <>
+const kernel_set<double> & get_kernels<double>(const instruction_set p_isa);
+
+template <>
+const kernel_set<float> & get_kernels<float>(const instruction_set p_isa);
+
+
+/**
+ *
+ * @brief   Returns kernels for the widest supported instruction set, detection is performed only once.
+ *
+ */
+template <typename TypeValue>
+const kernel_set<TypeValue> & get_kernels() {
+    static const kernel_set<TypeValue> & kernels = get_kernels<TypeValue>(detect_instruction_set());
+    return kernels;
+}
+
+
+/**
+ *
+ * @brief   Calculates square of Euclidean distance between contiguous arrays of coordinates.
+ *
+ */
+template <typename TypeValue>
+double euclidean_distance_square(const TypeValue * p_point1, const TypeValue * p_point2, const std::size_t p_size) {
+    return get_kernels<TypeValue>().euclidean_distance_square(p_point1, p_point2, p_size);
+}
+
+
+/**
+ *
+ * @brief   Calculates Manhattan distance between contiguous arrays of coordinates.
+ *
+ */
+template <typename TypeValue>
+double manhattan_distance(const TypeValue * p_point1, const TypeValue * p_point2, const std::size_t p_size) {
+    return get_kernels<TypeValue>().manhattan_distance(p_point1, p_point2, p_size);
+}
+
+
+/**
+ *
+ * @brief   Calculates Chebyshev distance between contiguous arrays of coordinates.
+ *
+ */
+template <typename TypeValue>
+double chebyshev_distance(const TypeValue * p_point1, const TypeValue * p_point2, const std::size_t p_size) {
+    return get_kernels<TypeValue>().chebyshev_distance(p_point1, p_point2, p_size);
+}
+
+
+/**
+ *
+ * @brief   Calculates Canberra distance between contiguous arrays of coordinates.
+ *
+ */
+template <typename TypeValue>
+double canberra_distance(const TypeValue * p_point1, const TypeValue * p_point2, const std::size_t p_size) {
+    return get_kernels<TypeValue>().canberra_distance(p_point1, p_point2, p_size);
+}
+
+
+/**
+ *
+ * @brief   Calculates Chi square distance between contiguous arrays of coordinates.
+ *
+ */
+template <typename TypeValue>
+double chi_square_distance(const TypeValue * p_point1, const TypeValue * p_point2, const std::size_t p_size) {
+    return get_kernels<TypeValue>().chi_square_distance(p_point1, p_point2, p_size);
+}
+
+
+/**
+ *
+ * @brief   Calculates dot product of contiguous arrays of coordinates.
+ *
+ */
+template <typename TypeValue>
+double dot_product(const TypeValue * p_point1, const TypeValue * p_point2, const std::size_t p_size) {
+    return get_kernels<TypeValue>().dot_product(p_point1, p_point2, p_size);
+}
+
+
+}
+
+}
+
+}
+
+}
@@ -21,11 +21,19 @@
 */
 
 #include <pyclustering/cluster/agglomerative.hpp>
+
+#include <pyclustering/container/disjoint_set.hpp>
+
+#include <pyclustering/parallel/parallel.hpp>
+
+#include <pyclustering/utils/distance_matrix.hpp>
 #include <pyclustering/utils/metric.hpp>
 
 #include <algorithm>
 
 
+using namespace pyclustering::container;
+using namespace pyclustering::parallel;
 using namespace pyclustering::utils::metric;
 
 
@@ -37,6 +45,7 @@ namespace clst {
 agglomerative::agglomerative() :
     m_number_clusters(1),
     m_similarity(type_link::SINGLE_LINK),
+    m_distance_threshold(std::numeric_limits<double>::max()),
     m_centers(0),
     m_ptr_clusters(nullptr),
     m_ptr_data(nullptr)
@@ -46,6 +55,17 @@ agglomerative::agglomerative() :
 agglomerative::agglomerative(const size_t number_clusters, const type_link link) :
     m_number_clusters(number_clusters),
     m_similarity(link),
+    m_distance_threshold(std::numeric_limits<double>::max()),
+    m_centers(0),
+    m_ptr_clusters(nullptr),
+    m_ptr_data(nullptr)
+{ }
+
+
+agglomerative::agglomerative(const size_t number_clusters, const type_link link, const double distance_threshold) :
+    m_number_clusters(number_clusters),
+    m_similarity(link),
+    m_distance_threshold(distance_threshold * distance_threshold),
     m_centers(0),
     m_ptr_clusters(nullptr),
     m_ptr_data(nullptr)
@@ -59,81 +79,42 @@ void agglomerative::process(const dataset & data, cluster_data & result) {
     m_centers.clear();
     m_ptr_clusters->clear();
 
-    size_t current_number_clusters = data.size();
-
-    m_centers.resize(current_number_clusters);
-    m_ptr_clusters->resize(current_number_clusters);
+    merge_sequence merges;
 
-    std::copy(data.begin(), data.end(), m_centers.begin());
-
-    for (size_t i = 0; i < data.size(); i++) {
-        (*m_ptr_clusters)[i].push_back(i);
-    }
-
-    while(current_number_clusters > m_number_clusters) {
-        merge_similar_clusters();
-        current_number_clusters = m_ptr_clusters->size();
-    }
-
-    m_ptr_data = nullptr;
-}
-
-
-void agglomerative::merge_similar_clusters() {
     switch(m_similarity) {
         case type_link::SINGLE_LINK:
-            merge_by_signle_link();
+            calculate_minimum_spanning_tree(merges);
+            apply_merges(merges);
             break;
+
         case type_link::COMPLETE_LINK:
-            merge_by_complete_link();
-            break;
         case type_link::AVERAGE_LINK:
-            merge_by_average_link();
+            calculate_nearest_neighbor_chain(merges);
+            apply_merges(merges);
             break;
-        case type_link::CENTROID_LINK:
-            merge_by_centroid_link();
-            break;
-        default:
-            throw std::runtime_error("Unknown type of similarity is used.");
-    }
-}
-
 
-void agglomerative::merge_by_average_link() {
-    double minimum_average_distance = std::numeric_limits<double>::max();
-
-    const std::vector<point> & data = *m_ptr_data;
+        case type_link::CENTROID_LINK: {
+            const std::size_t number_clusters = std::max(m_number_clusters, std::size_t(1));
 
-    size_t index1 = 0;
-    size_t index2 = 1;
-
-    for (size_t index_cluster1 = 0; index_cluster1 < m_ptr_clusters->size(); index_cluster1++) {
-        for (size_t index_cluster2 = index_cluster1 + 1; index_cluster2 < m_ptr_clusters->size(); index_cluster2++) {
-            double candidate_average_distance = 0.0;
-
-            for (auto index_object1 : (*m_ptr_clusters)[index_cluster1]) {
-                for (auto index_object2 : (*m_ptr_clusters)[index_cluster2]) {
-                    candidate_average_distance += euclidean_distance_square(data[index_object1], data[index_object2]);
-                }
+            m_centers = data;
+            m_ptr_clusters->resize(data.size());
+            for (size_t i = 0; i < data.size(); i++) {
+                (*m_ptr_clusters)[i].push_back(i);
             }
 
-            candidate_average_distance /= ((*m_ptr_clusters)[index_cluster1].size() + (*m_ptr_clusters)[index_cluster2].size());
-
-            if (candidate_average_distance < minimum_average_distance) {
-                minimum_average_distance = candidate_average_distance;
-
-                index1 = index_cluster1;
-                index2 = index_cluster2;
-            }
+            while ((m_ptr_clusters->size() > number_clusters) && merge_by_centroid_link()) { }
+            break;
         }
+
+        default:
+            throw std::runtime_error("Unknown type of similarity is used.");
     }
 
-    (*m_ptr_clusters)[index1].insert((*m_ptr_clusters)[index1].end(), (*m_ptr_clusters)[index2].begin(), (*m_ptr_clusters)[index2].end());
-    m_ptr_clusters->erase(m_ptr_clusters->begin() + index2);
+    m_ptr_data = nullptr;
 }
 
 
-void agglomerative::merge_by_centroid_link() {
+bool agglomerative::merge_by_centroid_link() {
     double minimum_average_distance = std::numeric_limits<double>::max();
 
     size_t index_cluster1 = 0;
@@ -151,81 +132,190 @@ void agglomerative::merge_by_centroid_link() {
         }
     }
 
+    if (minimum_average_distance > m_distance_threshold) {
+        return false;
+    }
+
     (*m_ptr_clusters)[index_cluster1].insert((*m_ptr_clusters)[index_cluster1].end(), (*m_ptr_clusters)[index_cluster2].begin(), (*m_ptr_clusters)[index_cluster2].end());
-    calculate_center((*m_ptr_clusters)[index_cluster1], m_centers[index_cluster2]);
+    calculate_center((*m_ptr_clusters)[index_cluster1], m_centers[index_cluster1]);
 
     m_ptr_clusters->erase(m_ptr_clusters->begin() + index_cluster2);
     m_centers.erase(m_centers.begin() + index_cluster2);
+
+    return true;
 }
 
 
-void agglomerative::merge_by_complete_link() {
-    double minimum_complete_distance = std::numeric_limits<double>::max();
+void agglomerative::calculate_minimum_spanning_tree(merge_sequence & p_merges) const {
+    std::vector<double> points_buffer;
+    const points_view<double> points = pack_points(*m_ptr_data, points_buffer);
+
+    const std::size_t size = points.rows();
+    if (size == 0) {
+        return;
+    }
 
-    size_t index1 = 0;
-    size_t index2 = 1;
+    std::vector<bool> in_tree(size, false);
+    std::vector<double> tree_distance(size, std::numeric_limits<double>::max());
+    std::vector<std::size_t> tree_neighbor(size, 0);
 
-    const std::vector<point> & data = *m_ptr_data;
+    p_merges.reserve(size - 1);
+
+    /* Prim's algorithm on the complete graph, every point is compared once with every point added to the tree */
+    std::size_t current = 0;
+    in_tree[current] = true;
 
-    for (size_t index_cluster1 = 0; index_cluster1 < m_ptr_clusters->size(); index_cluster1++) {
-        for (size_t index_cluster2 = index_cluster1 + 1; index_cluster2 < m_ptr_clusters->size(); index_cluster2++) {
-            double candidate_maximum_distance = 0.0;
-
-            for (auto index_object1 : (*m_ptr_clusters)[index_cluster1]) {
-                for (auto index_object2 : (*m_ptr_clusters)[index_cluster2]) {
-                    double distance = euclidean_distance_square(data[index_object1], data[index_object2]);
-                    if (distance > candidate_maximum_distance) {
-                        candidate_maximum_distance = distance;
-                    }
-                }
+    for (std::size_t step = 1; step < size; step++) {
+        parallel_for(std::size_t(0), size, [current, &points, &in_tree, &tree_distance, &tree_neighbor](const std::size_t p_index) {
+            if (in_tree[p_index]) {
+                return;
             }
 
-            if (candidate_maximum_distance < minimum_complete_distance) {
-                minimum_complete_distance = candidate_maximum_distance;
+            const double distance = simd::euclidean_distance_square(points.row(current), points.row(p_index), points.cols());
+            if (distance < tree_distance[p_index]) {
+                tree_distance[p_index] = distance;
+                tree_neighbor[p_index] = current;
+            }
+        });
 
-                index1 = index_cluster1;
-                index2 = index_cluster2;
+        std::size_t closest = size;
+        for (std::size_t index = 0; index < size; index++) {
+            if (!in_tree[index] && ((closest == size) || (tree_distance[index] < tree_distance[closest]))) {
+                closest = index;
             }
         }
-    }
 
-    (*m_ptr_clusters)[index1].insert((*m_ptr_clusters)[index1].end(), (*m_ptr_clusters)[index2].begin(), (*m_ptr_clusters)[index2].end());
-    m_ptr_clusters->erase(m_ptr_clusters->begin() + index2);
+        p_merges.push_back({ tree_neighbor[closest], closest, tree_distance[closest] });
+
+        in_tree[closest] = true;
+        current = closest;
+    }
 }
 
 
-void agglomerative::merge_by_signle_link() {
-    double minimum_single_distance = std::numeric_limits<double>::max();
+void agglomerative::calculate_nearest_neighbor_chain(merge_sequence & p_merges) const {
+    std::vector<double> points_buffer;
+    const points_view<double> points = pack_points(*m_ptr_data, points_buffer);
 
-    size_t index1 = 0;
-    size_t index2 = 1;
+    const std::size_t size = points.rows();
+    if (size == 0) {
+        return;
+    }
 
-    const std::vector<point> & data = *m_ptr_data;
+    /* maximum of squares is the square of maximum, but group average has to be taken over plain distances */
+    const bool average_link = (m_similarity == type_link::AVERAGE_LINK);
+
+    packed_distance_matrix<double> distances;
+    compute_distance_matrix(points, average_link ? distance_type::EUCLIDEAN : distance_type::EUCLIDEAN_SQUARE, distances);
+
+    const auto distance = [&distances](const std::size_t p_index1, const std::size_t p_index2) -> double & {
+        return (p_index1 < p_index2) ? distances.data()[distances.index(p_index1, p_index2)] : distances.data()[distances.index(p_index2, p_index1)];
+    };
+
+    std::vector<std::size_t> sizes(size, 1);
+    std::vector<bool> active(size, true);
+
+    std::vector<std::size_t> chain;
+    std::size_t first_active = 0;
+
+    p_merges.reserve(size - 1);
+
+    while (p_merges.size() < size - 1) {
+        if (chain.empty()) {
+            while (!active[first_active]) {
+                first_active++;
+            }
+
+            chain.push_back(first_active);
+        }
+
+        const std::size_t current = chain.back();
+        const std::size_t previous = (chain.size() > 1) ? chain[chain.size() - 2] : size;
+
+        /* previous element of the chain wins ties, otherwise the chain could cycle */
+        std::size_t nearest = previous;
+        double nearest_distance = (previous != size) ? distance(current, previous) : std::numeric_limits<double>::max();
+
+        for (std::size_t index = 0; index < size; index++) {
+            if (active[index] && (index != current) && (distance(current, index) < nearest_distance)) {
+                nearest = index;
+                nearest_distance = distance(current, index);
+            }
+        }
 
-    for (size_t index_cluster1 = 0; index_cluster1 < m_ptr_clusters->size(); index_cluster1++) {
-        for (size_t index_cluster2 = index_cluster1 + 1; index_cluster2 < m_ptr_clusters->size(); index_cluster2++) {
-            double candidate_minimum_distance = std::numeric_limits<double>::max();
-
-            for (auto index_object1 : (*m_ptr_clusters)[index_cluster1]) {
-                for (auto index_object2 : (*m_ptr_clusters)[index_cluster2]) {
-                    double distance = euclidean_distance_square(data[index_object1], data[index_object2]);
-                    if (distance < candidate_minimum_distance) {
-                        candidate_minimum_distance = distance;
-                    }
-                }
+        if (nearest != previous) {
+            chain.push_back(nearest);
+            continue;
+        }
+
+        /* reciprocal nearest neighbors are merged, the cluster is stored under the smaller index */
+        chain.pop_back();
+        chain.pop_back();
+
+        /* merges are replayed against the square of the threshold */
+        p_merges.push_back({ current, previous, average_link ? nearest_distance * nearest_distance : nearest_distance });
+
+        const std::size_t merged = std::min(current, previous);
+        const std::size_t removed = std::max(current, previous);
+
+        const double size1 = (double) sizes[current];
+        const double size2 = (double) sizes[previous];
+
+        for (std::size_t index = 0; index < size; index++) {
+            if (!active[index] || (index == current) || (index == previous)) {
+                continue;
             }
 
-            if (candidate_minimum_distance < minimum_single_distance) {
-                minimum_single_distance = candidate_minimum_distance;
+            const double distance1 = distance(current, index);
+            const double distance2 = distance(previous, index);
 
-                index1 = index_cluster1;
-                index2 = index_cluster2;
+            double & updated_distance = distance(merged, index);
+            if (m_similarity == type_link::COMPLETE_LINK) {
+                updated_distance = std::max(distance1, distance2);
+            }
+            else {
+                updated_distance = (size1 * distance1 + size2 * distance2) / (size1 + size2);
             }
         }
+
+        sizes[merged] += sizes[removed];
+        active[removed] = false;
     }
+}
+
+
+void agglomerative::apply_merges(merge_sequence & p_merges) {
+    const std::size_t size = m_ptr_data->size();
+    const std::size_t number_clusters = std::max(m_number_clusters, std::size_t(1));
+
+    /* both algorithms produce merges of reducible links, so applying them by distance gives the same hierarchy */
+    std::stable_sort(p_merges.begin(), p_merges.end(), [](const merge_step & p_merge1, const merge_step & p_merge2) {
+        return p_merge1.m_distance < p_merge2.m_distance;
+    });
 
-    (*m_ptr_clusters)[index1].insert((*m_ptr_clusters)[index1].end(), (*m_ptr_clusters)[index2].begin(), (*m_ptr_clusters)[index2].end());
-    m_ptr_clusters->erase(m_ptr_clusters->begin() + index2);
+    disjoint_set clusters(size);
+
+    std::size_t current_number_clusters = size;
+    for (const auto & merge : p_merges) {
+        if ((current_number_clusters <= number_clusters) || (merge.m_distance > m_distance_threshold)) {
+            break;
+        }
+
+        if (clusters.merge(merge.m_index1, merge.m_index2)) {
+            current_number_clusters--;
+        }
+    }
+
+    std::vector<std::size_t> cluster_index(size, size);
+    for (std::size_t index = 0; index < size; index++) {
+        const std::size_t root = clusters.find(index);
+        if (cluster_index[root] == size) {
+            cluster_index[root] = m_ptr_clusters->size();
+            m_ptr_clusters->emplace_back();
+        }
+
+        (*m_ptr_clusters)[cluster_index[root]].push_back(index);
+    }
 }
 
 
@@ -234,7 +324,7 @@ void agglomerative::calculate_center(const cluster & cluster, point & center) co
 
     const size_t dimension = data[0].size();
 
-    center.resize(dimension, 0.0);
+    center.assign(dimension, 0.0);
 
     for (auto index_point : cluster) {
         for (size_t index_dimension = 0; index_dimension < dimension; index_dimension++) {
@@ -250,4 +340,4 @@ void agglomerative::calculate_center(const cluster & cluster, point & center) co
 
 }
 
-}
+}
\ No newline at end of file
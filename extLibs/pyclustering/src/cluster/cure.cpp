@@ -21,16 +21,22 @@
 */
 
 
-#include <limits>
-#include <set>
-#include <iostream>
-
 #include <pyclustering/cluster/cure.hpp>
 
-#include <pyclustering/utils/metric.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+#include <pyclustering/parallel/parallel.hpp>
+
+#include <pyclustering/utils/metric_simd.hpp>
 
 
 using namespace pyclustering::container;
+using namespace pyclustering::parallel;
 using namespace pyclustering::utils::metric;
 
 
@@ -39,141 +45,234 @@ namespace pyclustering {
 namespace clst {
 
 
-cure_cluster::cure_cluster() : mean(nullptr), closest(nullptr), distance_closest(0) {
-    points = new std::vector< std::vector<double> * >();
-    rep = new std::vector< std::vector<double> * >();
-}
+const double cure::DEFAULT_REDUCTION = 3.0;
 
 
-cure_cluster::cure_cluster(std::vector<double> * point) : closest(nullptr), distance_closest(0) {
-    mean = new std::vector<double>(*point);
 
-    points = new std::vector< std::vector<double> * >(1, point);    /* use user data points */
-    rep = new std::vector< std::vector<double> * >(1, new std::vector<double>(*point));       /* it's our - despite at the beginning it the same */
-}
+cure_arena::cure_arena(const points_view<double> & p_points, const std::size_t p_number_repr_points, const double p_compression) :
+    m_points(p_points),
+    m_dimension(p_points.cols()),
+    m_number_repr_points(p_number_repr_points),
+    m_compression(p_compression),
+    m_next_point(p_points.rows(), NONE_INDEX)
+{ }
 
 
-cure_cluster::~cure_cluster() {
-    if (mean != nullptr) {
-        delete mean;
-        mean = nullptr;
-    }
+void cure_arena::allocate(const std::vector<std::size_t> & p_capacities) {
+    const std::size_t amount_clusters = p_capacities.size();
+
+    m_means.assign(amount_clusters * m_dimension, 0.0);
+    m_amount_representors.assign(amount_clusters, 0);
+    m_weight.assign(amount_clusters, 0);
+    m_closest.assign(amount_clusters, NONE_INDEX);
+    m_closest_distance.assign(amount_clusters, std::numeric_limits<double>::max());
+    m_first_point.assign(amount_clusters, NONE_INDEX);
+    m_last_point.assign(amount_clusters, NONE_INDEX);
+    m_merged_distance.assign(amount_clusters, 0.0);
+    m_updated.assign(amount_clusters, 0);
+
+    m_active.resize(amount_clusters);
+    std::iota(m_active.begin(), m_active.end(), std::size_t(0));
+    m_active_position = m_active;
+
+    m_queue = indexed_heap(amount_clusters);
+    m_candidates.resize(2 * m_number_repr_points * m_dimension);
 
-    delete points;  /* only storage, we are not owners of points */
-    points = nullptr;
+    /* slots are as large as the amount of representative points of the cluster, they grow when clusters are merged */
+    const std::size_t total = std::accumulate(p_capacities.begin(), p_capacities.end(), std::size_t(0));
 
-    for (auto point_ptr : *rep) {
-        delete point_ptr;
+    m_scattered.clear();
+    m_representors.clear();
+    m_scattered.reserve(total * m_dimension);
+    m_representors.reserve(total * m_dimension);
+    m_slot.assign(amount_clusters, 0);
+    m_slot_capacity.assign(amount_clusters, 0);
+    m_released = 0;
+
+    for (std::size_t cluster = 0; cluster < amount_clusters; cluster++) {
+        reserve_slot(cluster, p_capacities[cluster]);
     }
+}
+
 
-    delete rep;     /* only storage, we are not owners of points */
-    rep = nullptr;
+void cure_arena::reserve_slot(const std::size_t p_cluster, const std::size_t p_capacity) {
+    m_slot[p_cluster] = m_scattered.size() / std::max(m_dimension, std::size_t(1));
+    m_slot_capacity[p_cluster] = p_capacity;
+
+    m_scattered.resize(m_scattered.size() + p_capacity * m_dimension, 0.0);
+    m_representors.resize(m_representors.size() + p_capacity * m_dimension, 0.0);
 }
 
 
-void cure_cluster::insert_points(std::vector<std::vector<double> *> * append_points) {
-    points->insert(points->end(), append_points->begin(), append_points->end());
+void cure_arena::release_slot(const std::size_t p_cluster) {
+    m_released += m_slot_capacity[p_cluster];
+    m_slot_capacity[p_cluster] = 0;
 }
 
 
-std::ostream & operator<<(std::ostream & p_stream, cure_cluster & p_cluster) {
-    p_stream << p_cluster.distance_closest << "[";
-    for (auto & point : *(p_cluster.points)) {
-        p_stream << "[ ";
-        for (auto & coordinate : *point) {
-            p_stream << coordinate << " ";
-        }
-        p_stream << "]";
+void cure_arena::compact_slots() {
+    std::vector<double> scattered;
+    std::vector<double> representors;
+    scattered.reserve(m_scattered.size() - m_released * m_dimension);
+    representors.reserve(m_representors.size() - m_released * m_dimension);
+
+    std::size_t position = 0;
+    for (const std::size_t cluster : m_active) {
+        const std::size_t begin = m_slot[cluster] * m_dimension;
+        const std::size_t end = begin + m_slot_capacity[cluster] * m_dimension;
+
+        scattered.insert(scattered.end(), m_scattered.begin() + begin, m_scattered.begin() + end);
+        representors.insert(representors.end(), m_representors.begin() + begin, m_representors.begin() + end);
+
+        m_slot[cluster] = position;
+        position += m_slot_capacity[cluster];
     }
-    p_stream << "]";
-    return p_stream;
+
+    m_scattered = std::move(scattered);
+    m_representors = std::move(representors);
+    m_released = 0;
 }
 
 
+void cure_arena::initialize() {
+    allocate(std::vector<std::size_t>(m_points.rows(), std::min(m_number_repr_points, std::size_t(1))));
 
-bool cure_cluster_comparator::operator()(const cure_cluster * const obj1, const cure_cluster * const obj2) const {
-    return obj1->distance_closest < obj2->distance_closest;
+    parallel_for(std::size_t(0), m_points.rows(), [this](const std::size_t p_index) {
+        create_cluster(p_index, &p_index, 1);
+    });
+
+    create_queue();
 }
 
 
+void cure_arena::initialize(const cluster_sequence & p_groups) {
+    std::vector<std::size_t> capacities(p_groups.size());
+    for (std::size_t index = 0; index < p_groups.size(); index++) {
+        capacities[index] = std::min(m_number_repr_points, p_groups[index].size());
+    }
+
+    allocate(capacities);
 
-cure_queue::cure_queue() {
-    queue = new std::multiset<cure_cluster *, cure_cluster_comparator>();
-    tree = new kdtree();
+    parallel_for(std::size_t(0), p_groups.size(), [this, &p_groups](const std::size_t p_index) {
+        create_cluster(p_index, p_groups[p_index].data(), p_groups[p_index].size());
+    });
+
+    create_queue();
 }
 
 
-cure_queue::cure_queue(const std::vector< std::vector<double> > * data) {
-    queue = new std::multiset<cure_cluster *, cure_cluster_comparator>();
-    create_queue(data);
+void cure_arena::create_cluster(const std::size_t p_cluster, const std::size_t * p_points, const std::size_t p_size) {
+    thread_local std::vector<const double *> candidates;
+    candidates.clear();
 
-    tree = new kdtree();
+    m_weight[p_cluster] = p_size;
+    m_first_point[p_cluster] = p_points[0];
+    m_last_point[p_cluster] = p_points[p_size - 1];
 
-    for (auto cluster : *queue) {
-        for (auto point : *(cluster->rep)) {
-            tree->insert(*point, cluster);
-        }
-    }
-}
+    double * cluster_mean = mean(p_cluster);
+    bool all_same = true;
 
+    for (std::size_t i = 0; i < p_size; i++) {
+        const double * point = m_points.row(p_points[i]);
+        candidates.push_back(point);
 
-cure_queue::~cure_queue() {
-    if (queue != nullptr) {
-        for (auto cluster : *queue) {
-            delete cluster;
+        if (i + 1 < p_size) {
+            m_next_point[p_points[i]] = p_points[i + 1];
         }
 
-        delete queue;
-        queue = nullptr;
+        all_same = all_same && std::equal(point, point + m_dimension, candidates.front());
+        for (std::size_t dimension = 0; dimension < m_dimension; dimension++) {
+            cluster_mean[dimension] += point[dimension];
+        }
     }
 
-    if (tree != nullptr) {
-        delete tree;
-        tree = nullptr;
+    /* mean of equal points is taken as is to avoid precision error */
+    if (all_same) {
+        std::copy(candidates.front(), candidates.front() + m_dimension, cluster_mean);
     }
+    else {
+        for (std::size_t dimension = 0; dimension < m_dimension; dimension++) {
+            cluster_mean[dimension] /= static_cast<double>(p_size);
+        }
+    }
+
+    select_representors(p_cluster, candidates);
 }
 
 
-void cure_queue::create_queue(const dataset * data) {
-    std::list<cure_cluster *> temporary_storage;
+void cure_arena::create_queue() {
+    parallel_for(std::size_t(0), m_active.size(), [this](const std::size_t p_position) {
+        const std::size_t cluster = m_active[p_position];
+        find_closest(cluster, m_closest[cluster], m_closest_distance[cluster]);
+    });
 
-    for (auto & data_point : (*data)) {
-        cure_cluster * cluster = new cure_cluster((std::vector<double> *) &data_point);
-        temporary_storage.push_back(cluster);
+    for (const std::size_t cluster : m_active) {
+        m_queue.push(cluster, m_closest_distance[cluster]);
     }
+}
 
-    for (auto & first_cluster : temporary_storage) {
-        double minimal_distance = std::numeric_limits<double>::max();
-        cure_cluster * closest_cluster = nullptr;
-
-        for (auto & second_cluster : temporary_storage) {
-            if (first_cluster != second_cluster) {
-                double dist = get_distance(first_cluster, second_cluster);
-                if (dist < minimal_distance) {
-                    minimal_distance = dist;
-                    closest_cluster = second_cluster;
-                }
+
+void cure_arena::select_representors(const std::size_t p_cluster, const std::vector<const double *> & p_candidates) {
+    thread_local std::vector<double> minimal_distances;
+    thread_local std::vector<char> selected;
+
+    const std::size_t amount = std::min(m_number_repr_points, p_candidates.size());
+    const double * cluster_mean = mean(p_cluster);
+
+    minimal_distances.resize(p_candidates.size());
+    selected.assign(p_candidates.size(), 0);
+
+    /* the first scattered point is the farthest from the mean, each next one is the farthest from already chosen */
+    for (std::size_t i = 0; i < p_candidates.size(); i++) {
+        minimal_distances[i] = simd::euclidean_distance_square(p_candidates[i], cluster_mean, m_dimension);
+    }
+
+    double * cluster_scattered = scattered(p_cluster);
+    double * cluster_representors = representor(p_cluster);
+
+    for (std::size_t index = 0; index < amount; index++) {
+        std::size_t farthest = NONE_INDEX;
+        double maximal_distance = 0.0;
+
+        for (std::size_t i = 0; i < p_candidates.size(); i++) {
+            if (!selected[i] && (minimal_distances[i] >= maximal_distance)) {
+                maximal_distance = minimal_distances[i];
+                farthest = i;
             }
         }
 
-        first_cluster->closest = closest_cluster;
-        first_cluster->distance_closest = minimal_distance;
-    }
+        selected[farthest] = 1;
+
+        const double * point = p_candidates[farthest];
+        double * point_scattered = cluster_scattered + index * m_dimension;
+        double * point_representor = cluster_representors + index * m_dimension;
 
-    for (const auto & cluster : temporary_storage) {
-        queue->insert(cluster);
+        for (std::size_t dimension = 0; dimension < m_dimension; dimension++) {
+            point_scattered[dimension] = point[dimension];
+            point_representor[dimension] = point[dimension] + m_compression * (cluster_mean[dimension] - point[dimension]);
+        }
+
+        for (std::size_t i = 0; i < p_candidates.size(); i++) {
+            if (!selected[i]) {
+                const double distance = simd::euclidean_distance_square(p_candidates[i], point, m_dimension);
+                minimal_distances[i] = (index == 0) ? distance : std::min(minimal_distances[i], distance);
+            }
+        }
     }
+
+    m_amount_representors[p_cluster] = amount;
 }
 
 
-double cure_queue::get_distance(cure_cluster * cluster1, cure_cluster * cluster2) {
+double cure_arena::get_distance(const std::size_t p_cluster1, const std::size_t p_cluster2) const {
+    const double * representors1 = representor(p_cluster1);
+    const double * representors2 = representor(p_cluster2);
+
     double distance = std::numeric_limits<double>::max();
-    for (auto & point1 : *(cluster1->rep)) {
-        for (auto & point2 : *(cluster2->rep)) {
-            double candidate_distance = euclidean_distance_square(*point1, *point2);
-            if (candidate_distance < distance) {
-                distance = candidate_distance;
-            }
+    for (std::size_t i = 0; i < m_amount_representors[p_cluster1]; i++) {
+        for (std::size_t j = 0; j < m_amount_representors[p_cluster2]; j++) {
+            const double candidate_distance = simd::euclidean_distance_square(representors1 + i * m_dimension, representors2 + j * m_dimension, m_dimension);
+            distance = std::min(distance, candidate_distance);
         }
     }
 
@@ -181,287 +280,431 @@ double cure_queue::get_distance(cure_cluster * cluster1, cure_cluster * cluster2
 }
 
 
-bool cure_queue::are_all_elements_same(cure_cluster * merged_cluster) {
-    auto & data_points = *(merged_cluster->points);
-    auto & first_point = data_points.front();
+void cure_arena::find_closest(const std::size_t p_cluster, std::size_t & p_closest, double & p_distance) const {
+    p_closest = NONE_INDEX;
+    p_distance = std::numeric_limits<double>::max();
 
-    for (std::size_t i = 1; i < data_points.size(); i++) {
-        if (data_points[i] != first_point) {
-          return false;
+    for (const std::size_t cluster : m_active) {
+        if (cluster != p_cluster) {
+            const double distance = get_distance(p_cluster, cluster);
+            if (distance < p_distance) {
+                p_distance = distance;
+                p_closest = cluster;
+            }
         }
     }
+}
+
 
-    return true;
+void cure_arena::merge(const std::size_t p_amount_clusters) {
+    while (m_active.size() > std::max(p_amount_clusters, std::size_t(1))) {
+        const std::size_t cluster1 = m_queue.top();
+        const std::size_t cluster2 = m_closest[cluster1];
+
+        merge_clusters(cluster1, cluster2);
+    }
 }
 
 
-void cure_queue::merge(cure_cluster * cluster1, cure_cluster * cluster2, const size_t number_repr_points, const double compression) {
-    remove_representative_points(cluster1);
-    remove_representative_points(cluster2);
+void cure_arena::merge_clusters(const std::size_t p_cluster1, const std::size_t p_cluster2) {
+    m_queue.erase(p_cluster1);
+    m_queue.erase(p_cluster2);
 
-    remove_cluster(cluster1);
-    remove_cluster(cluster2);
+    /* release slot of the second cluster */
+    const std::size_t position = m_active_position[p_cluster2];
+    m_active[position] = m_active.back();
+    m_active_position[m_active[position]] = position;
+    m_active.pop_back();
 
-    cure_cluster * merged_cluster = new cure_cluster();
-    merged_cluster->insert_points(cluster1->points);
-    merged_cluster->insert_points(cluster2->points);
+    /* scattered points of the merged cluster are chosen from scattered points of both clusters */
+    thread_local std::vector<const double *> candidates;
+    candidates.clear();
 
-    merged_cluster->mean = new std::vector<double>((*cluster1->points)[0]->size(), 0);
+    const std::size_t amount1 = m_amount_representors[p_cluster1] * m_dimension;
+    const std::size_t amount2 = m_amount_representors[p_cluster2] * m_dimension;
 
-    //If all elements were same then avoid calculating the mean mathematically as it may lead to precision error.
-    if (are_all_elements_same(merged_cluster)) {
-        for (std::size_t i = 0; i < (*merged_cluster->points)[0]->size(); i++) {
-            (*merged_cluster->mean)[i] = (*(*merged_cluster->points)[0])[i];
+    std::copy(scattered(p_cluster1), scattered(p_cluster1) + amount1, m_candidates.begin());
+    std::copy(scattered(p_cluster2), scattered(p_cluster2) + amount2, m_candidates.begin() + amount1);
+
+    for (std::size_t offset = 0; offset < amount1 + amount2; offset += m_dimension) {
+        candidates.push_back(m_candidates.data() + offset);
+    }
+
+    /* candidates are copied, so slots can be moved: the merged cluster takes the slot of the second one
+       or a new slot if its own slot is too small, released slots are reclaimed when they prevail */
+    const std::size_t amount = std::min(m_number_repr_points, m_amount_representors[p_cluster1] + m_amount_representors[p_cluster2]);
+    if (amount > m_slot_capacity[p_cluster1]) {
+        if (m_slot_capacity[p_cluster2] >= amount) {
+            std::swap(m_slot[p_cluster1], m_slot[p_cluster2]);
+            std::swap(m_slot_capacity[p_cluster1], m_slot_capacity[p_cluster2]);
+        }
+        else {
+            release_slot(p_cluster1);
+            reserve_slot(p_cluster1, amount);
         }
+    }
 
+    release_slot(p_cluster2);
+    if (2 * m_released * m_dimension > m_scattered.size()) {
+        compact_slots();
     }
-    else {
-        for (std::size_t dimension = 0; dimension < merged_cluster->mean->size(); dimension++) {
-            (*merged_cluster->mean)[dimension] = (cluster1->points->size() * (*cluster1->mean)[dimension] + cluster2->points->size() * (*cluster2->mean)[dimension]) / (cluster1->points->size() + cluster2->points->size());
+
+    double * mean1 = mean(p_cluster1);
+    const double * mean2 = mean(p_cluster2);
+
+    /* mean of clusters with equal means is taken as is to avoid precision error */
+    if (!std::equal(mean1, mean1 + m_dimension, mean2)) {
+        const double weight1 = static_cast<double>(m_weight[p_cluster1]);
+        const double weight2 = static_cast<double>(m_weight[p_cluster2]);
+
+        for (std::size_t dimension = 0; dimension < m_dimension; dimension++) {
+            mean1[dimension] = (weight1 * mean1[dimension] + weight2 * mean2[dimension]) / (weight1 + weight2);
         }
     }
 
-    std::set<std::vector<double> *> * temporary = new std::set<std::vector<double> *>();
+    select_representors(p_cluster1, candidates);
+
+    m_weight[p_cluster1] += m_weight[p_cluster2];
+    m_next_point[m_last_point[p_cluster1]] = m_first_point[p_cluster2];
+    m_last_point[p_cluster1] = m_last_point[p_cluster2];
+
+    /* clusters whose closest cluster has been merged look for new one, others check the merged cluster */
+    parallel_for(std::size_t(0), m_active.size(), [this, p_cluster1, p_cluster2](const std::size_t p_position) {
+        const std::size_t cluster = m_active[p_position];
+        if (cluster == p_cluster1) {
+            return;
+        }
 
-    for (std::size_t index = 0; index < number_repr_points; index++) {
-        double maximal_distance = 0;
-        std::vector<double> * maximal_point = nullptr;
+        const double distance = get_distance(cluster, p_cluster1);
+        m_merged_distance[cluster] = distance;
 
-        for (auto & point : *(merged_cluster->points)) {
-            double minimal_distance = 0;
-            if (index == 0) {
-                minimal_distance = euclidean_distance_square(*point, *(merged_cluster->mean));
+        if ( (m_closest[cluster] == p_cluster1) || (m_closest[cluster] == p_cluster2) ) {
+            if (m_closest_distance[cluster] < distance) {
+                find_closest(cluster, m_closest[cluster], m_closest_distance[cluster]);
             }
             else {
-                double temp_minimal_distance = std::numeric_limits<double>::max();
-                for (auto p : (*temporary)) {
-                    double minimal_candidate = euclidean_distance_square(*point, *p);
-                    if (minimal_candidate < temp_minimal_distance) {
-                        temp_minimal_distance = minimal_candidate;
-                    }
-                }
-
-                minimal_distance = temp_minimal_distance;
+                m_closest[cluster] = p_cluster1;
+                m_closest_distance[cluster] = distance;
             }
 
-            if (minimal_distance >= maximal_distance) {
-                maximal_distance = minimal_distance;
-                maximal_point = point;
-            }
+            m_updated[cluster] = 1;
         }
+        else if (distance < m_closest_distance[cluster]) {
+            m_closest[cluster] = p_cluster1;
+            m_closest_distance[cluster] = distance;
 
-        if (temporary->find(maximal_point) == temporary->end()) {
-            temporary->insert(maximal_point);
+            m_updated[cluster] = 1;
         }
-    }
+    });
+
+    m_closest[p_cluster1] = NONE_INDEX;
+    m_closest_distance[p_cluster1] = std::numeric_limits<double>::max();
 
-    for (auto & point : *temporary) {
-        std::vector<double> * representative_point = new std::vector<double>(point->size(), 0);
-        for (std::size_t index = 0; index < point->size(); index++) {
-            (*representative_point)[index] = (*point)[index] + compression * ( (*merged_cluster->mean)[index] - (*point)[index] );
+    for (const std::size_t cluster : m_active) {
+        if ( (cluster != p_cluster1) && (m_merged_distance[cluster] < m_closest_distance[p_cluster1]) ) {
+            m_closest[p_cluster1] = cluster;
+            m_closest_distance[p_cluster1] = m_merged_distance[cluster];
         }
+    }
+
+    m_queue.push(p_cluster1, m_closest_distance[p_cluster1]);
 
-        merged_cluster->rep->push_back(representative_point);
+    for (const std::size_t cluster : m_active) {
+        if (m_updated[cluster]) {
+            m_updated[cluster] = 0;
+            m_queue.update(cluster, m_closest_distance[cluster]);
+        }
     }
+}
 
-    delete temporary;
-    temporary = nullptr;
 
-    insert_representative_points(merged_cluster);
+std::vector<std::size_t> cure_arena::get_ordered_clusters() const {
+    std::vector<std::pair<std::size_t, std::size_t>> order;
+    order.reserve(m_active.size());
 
-    std::list<relocation_info> relocation_request;
+    for (const std::size_t cluster : m_active) {
+        std::size_t first_point = m_first_point[cluster];
+        for (std::size_t point = m_first_point[cluster]; point != NONE_INDEX; point = m_next_point[point]) {
+            first_point = std::min(first_point, point);
+        }
 
-    if (!queue->empty()) {
-        merged_cluster->closest = *(queue->begin());
-        merged_cluster->distance_closest = get_distance(merged_cluster, merged_cluster->closest);
+        order.emplace_back(first_point, cluster);
+    }
 
-        /* relocation request */
-        for (auto iterator_cluster = queue->begin(); iterator_cluster != queue->end(); iterator_cluster++) {
-            auto cluster = *iterator_cluster;
+    std::sort(order.begin(), order.end());
 
-            const double distance = get_distance(merged_cluster, cluster);
-            const double real_euclidean_distance = std::sqrt(distance);
+    std::vector<std::size_t> clusters;
+    clusters.reserve(order.size());
+    for (const auto & entry : order) {
+        clusters.push_back(entry.second);
+    }
 
-            /* Check if distance between new cluster and current is the best than now. */
-            if (distance < merged_cluster->distance_closest) {
-                merged_cluster->closest = cluster;
-                merged_cluster->distance_closest = distance;
-            }
+    return clusters;
+}
 
-            /* Check if current cluster has removed neighbor. */
-            if ( (cluster->closest == cluster1) || (cluster->closest == cluster2) ) {
-                /* If previous distance was less then distance to new cluster then nearest cluster should be found in the tree. */
-                if (cluster->distance_closest < distance) {
-                    cure_cluster * nearest_cluster = nullptr;
-                    double nearest_distance = std::numeric_limits<double>::max();
-
-                    for (auto & point : *(cluster->rep)) {
-                        /* we are using Eucliean Square metric, but kdtree searcher requires common Eucliean distance (but output results are square) */
-                        kdtree_searcher searcher(*point, tree->get_root(), real_euclidean_distance);
-
-                        std::vector<double> nearest_node_distances;
-                        std::vector<kdnode::ptr> nearest_nodes;
-                        searcher.find_nearest_nodes(nearest_node_distances, nearest_nodes);
-
-                        for (std::size_t index = 0; index < nearest_nodes.size(); index++) {
-                            if ( (nearest_node_distances[index] < nearest_distance) && ( nearest_nodes[index]->get_payload() != cluster ) ) {
-                                nearest_distance = nearest_node_distances[index];
-                                nearest_cluster = static_cast<cure_cluster *>(nearest_nodes[index]->get_payload());
-                            }
-                        }
-                    }
-
-                    if (nearest_cluster == nullptr) {
-                        relocation_request.emplace_back(iterator_cluster, merged_cluster, distance);
-                    }
-                    else {
-                        relocation_request.emplace_back(iterator_cluster, nearest_cluster, nearest_distance);
-                    }
-                }
-                else {
-                    relocation_request.emplace_back(iterator_cluster, merged_cluster, distance);
-                }
-            }
+
+void cure_arena::get_clusters(const std::size_t p_offset, cluster_sequence & p_clusters) const {
+    const std::vector<std::size_t> order = get_ordered_clusters();
+
+    p_clusters.resize(order.size());
+    for (std::size_t index = 0; index < order.size(); index++) {
+        cluster & points = p_clusters[index];
+        points.clear();
+        points.reserve(m_weight[order[index]]);
+
+        for (std::size_t point = m_first_point[order[index]]; point != NONE_INDEX; point = m_next_point[point]) {
+            points.push_back(point + p_offset);
         }
+
+        std::sort(points.begin(), points.end());
     }
+}
+
+
+void cure_arena::get_representors(representor_sequence & p_representors, dataset & p_means) const {
+    const std::vector<std::size_t> order = get_ordered_clusters();
 
-    delete cluster1; cluster1 = nullptr;
-    delete cluster2; cluster2 = nullptr;
+    p_representors.resize(order.size());
+    p_means.resize(order.size());
 
-    /* insert merged cluster */
-    insert_cluster(merged_cluster);
+    for (std::size_t index = 0; index < order.size(); index++) {
+        const std::size_t cluster = order[index];
 
-    /* relocate requested clusters */
-    if (!relocation_request.empty()) {
-        for (auto & info : relocation_request) {
-            auto cluster = *(info.get_cluster_iterator());
-            queue->erase(info.get_cluster_iterator());
+        p_means[index].assign(mean(cluster), mean(cluster) + m_dimension);
 
-            cluster->closest = info.get_closest_cluster();
-            cluster->distance_closest = info.get_closest_distance();
-            insert_cluster(cluster);
+        p_representors[index].resize(m_amount_representors[cluster]);
+        for (std::size_t i = 0; i < m_amount_representors[cluster]; i++) {
+            const double * point = representor(cluster) + i * m_dimension;
+            p_representors[index][i].assign(point, point + m_dimension);
         }
     }
 }
 
 
-void cure_queue::insert_cluster(cure_cluster * inserted_cluster) {
-    queue->insert(inserted_cluster);
+
+cure::cure(const size_t clusters_number, const size_t points_number, const double level_compression) :
+    number_points(points_number),
+    number_clusters(clusters_number),
+    compression(level_compression)
+{ }
+
+
+cure::cure(const size_t clusters_number,
+           const size_t points_number,
+           const double level_compression,
+           const std::size_t p_sample_size,
+           const std::size_t p_amount_partitions,
+           const double p_reduction) :
+    number_points(points_number),
+    number_clusters(clusters_number),
+    compression(level_compression),
+    sample_size(p_sample_size),
+    amount_partitions(p_amount_partitions),
+    reduction(p_reduction)
+{ }
+
+
+void cure::process(const dataset & p_data, cluster_data & p_result) {
+    std::vector<double> buffer;
+    process(pack_points(p_data, buffer), p_result);
 }
 
 
-void cure_queue::remove_cluster(cure_cluster * removed_cluster) {
-    auto range = queue->equal_range(removed_cluster);
-    for (auto iter = range.first; iter != range.second; iter++) {
-        if (*iter == removed_cluster) {
-            queue->erase(iter);
-            return;
-        }
-    }
+void cure::process(const points_view<double> & p_points, cluster_data & p_result) {
+    process_view(p_points, p_result);
+}
+
 
-    throw std::runtime_error("CURE queue corruption detected, impossible to remove cluster from the queue. Please report to 'pyclustering@yandex.ru'.");
+void cure::process(const points_view<float> & p_points, cluster_data & p_result) {
+    process_view(p_points, p_result);
 }
 
 
-void cure_queue::remove_representative_points(cure_cluster * cluster) {
-    for (auto & point : *(cluster->rep)) {
-        tree->remove(*point, (void *) cluster);
+template <typename TypeValue>
+void cure::process_view(const points_view<TypeValue> & p_points, cluster_data & p_result) {
+    if (number_points == 0) {
+        throw std::invalid_argument("Amount of representative points should be greater than 0.");
+    }
+
+    if ( (amount_partitions > 1) && (reduction <= 0.0) ) {
+        throw std::invalid_argument("Reduction of partitions should be greater than 0.");
     }
-}
 
+    cure_data & result = static_cast<cure_data &>(p_result);
+    result.clusters().clear();
+    result.representors().clear();
+    result.means().clear();
 
-void cure_queue::insert_representative_points(cure_cluster * cluster) {
-    for (auto & point : *(cluster->rep)) {
-        tree->insert(*point, cluster);
+    const std::size_t amount = p_points.rows();
+    if (amount == 0) {
+        return;
     }
-}
 
+    const bool sampled = (sample_size != 0) && (sample_size < amount);
+    const std::size_t amount_sample = sampled ? sample_size : amount;
 
+    if (!sampled && (amount_partitions <= 1)) {
+        cluster_all(p_points, result);
+        return;
+    }
 
-relocation_info::relocation_info(const cure_queue::iterator & cluster_iterator, cure_cluster * closest_cluster, const double closest_distance) :
-    m_cluster_iterator(cluster_iterator),
-    m_closest_cluster(closest_cluster),
-    m_closest_distance(closest_distance)
-{ }
+    /* random sample, its order defines partitions */
+    index_sequence sample(amount);
+    std::iota(sample.begin(), sample.end(), std::size_t(0));
 
+    std::mt19937 generator(std::random_device{ }());
+    for (std::size_t i = 0; i < amount_sample; i++) {
+        std::uniform_int_distribution<std::size_t> distribution(i, amount - 1);
+        std::swap(sample[i], sample[distribution(generator)]);
+    }
 
-cure_queue::iterator relocation_info::get_cluster_iterator() const {
-    return m_cluster_iterator; 
-}
+    sample.resize(amount_sample);
 
+    std::vector<double> buffer(amount_sample * p_points.cols());
+    for (std::size_t i = 0; i < amount_sample; i++) {
+        std::copy(p_points.row(sample[i]), p_points.row(sample[i]) + p_points.cols(), buffer.begin() + i * p_points.cols());
+    }
 
-cure_cluster * relocation_info::get_closest_cluster() {
-    return m_closest_cluster;
-}
+    cluster_sample(points_view<double>(buffer.data(), amount_sample, p_points.cols(), p_points.cols()), result);
+
+    for (auto & cluster : result.clusters()) {
+        for (auto & index_point : cluster) {
+            index_point = sample[index_point];
+        }
+    }
+
+    if (sampled) {
+        assign_points(p_points, sample, result);
+    }
 
+    /* clusters are ordered by their first point as in case of processing without sample */
+    cluster_sequence & clusters = result.clusters();
+    for (auto & cluster : clusters) {
+        std::sort(cluster.begin(), cluster.end());
+    }
 
-double relocation_info::get_closest_distance() const {
-    return m_closest_distance;
+    std::vector<std::size_t> order(clusters.size());
+    std::iota(order.begin(), order.end(), std::size_t(0));
+    std::sort(order.begin(), order.end(), [&clusters](const std::size_t p_index1, const std::size_t p_index2) {
+        return clusters[p_index1].front() < clusters[p_index2].front();
+    });
+
+    cure_data ordered;
+    for (const std::size_t index : order) {
+        ordered.clusters().push_back(std::move(clusters[index]));
+        ordered.representors().push_back(std::move(result.representors()[index]));
+        ordered.means().push_back(std::move(result.means()[index]));
+    }
+
+    result.clusters() = std::move(ordered.clusters());
+    result.representors() = std::move(ordered.representors());
+    result.means() = std::move(ordered.means());
 }
 
 
+void cure::cluster_all(const points_view<double> & p_points, cure_data & p_result) const {
+    cluster_sample(p_points, p_result);
+}
 
-cure::cure(const size_t clusters_number, size_t points_number, const double level_compression) :
-    queue(nullptr),
-    number_points(points_number),
-    number_clusters(clusters_number),
-    compression(level_compression),
-    data(nullptr)
-{ }
 
+void cure::cluster_all(const points_view<float> & p_points, cure_data & p_result) const {
+    /* arena keeps scattered and representative points of each cluster, so converted points are a small part of its memory */
+    std::vector<double> buffer(p_points.rows() * p_points.cols());
+    for (std::size_t i = 0; i < p_points.rows(); i++) {
+        std::copy(p_points.row(i), p_points.row(i) + p_points.cols(), buffer.begin() + i * p_points.cols());
+    }
 
-cure::~cure() {
-    delete queue;
+    cluster_sample(points_view<double>(buffer.data(), p_points.rows(), p_points.cols(), p_points.cols()), p_result);
 }
 
 
-void cure::process(const dataset & p_data, cluster_data & p_result) {
-    delete queue;
+void cure::cluster_sample(const points_view<double> & p_sample, cure_data & p_result) const {
+    const std::size_t amount = p_sample.rows();
+    const std::size_t partitions = std::max(std::size_t(1), std::min(amount_partitions, amount));
 
-    queue = new cure_queue(&p_data);
-    data = &p_data;
+    if (partitions == 1) {
+        cure_arena arena(p_sample, number_points, compression);
+        arena.initialize();
+        arena.merge(number_clusters);
 
-    std::size_t allocated_clusters = queue->size();
-    while(allocated_clusters > number_clusters) {
-        cure_cluster * cluster1 = *(queue->begin());
-        cure_cluster * cluster2 = cluster1->closest;
+        arena.get_clusters(0, p_result.clusters());
+        arena.get_representors(p_result.representors(), p_result.means());
+        return;
+    }
+
+    /* partitions are clustered independently, memory is released as soon as partial clusters are extracted */
+    std::vector<cluster_sequence> partial_clusters(partitions);
+
+    parallel_for(std::size_t(0), partitions, [this, &p_sample, &partial_clusters, amount, partitions](const std::size_t p_partition) {
+        const std::size_t begin = p_partition * amount / partitions;
+        const std::size_t end = (p_partition + 1) * amount / partitions;
+
+        const points_view<double> partition(p_sample.row(begin), end - begin, p_sample.cols(), p_sample.stride());
+        const std::size_t amount_partial = static_cast<std::size_t>(std::ceil(static_cast<double>(end - begin) / reduction));
+
+        cure_arena arena(partition, number_points, compression);
+        arena.initialize();
+        arena.merge(std::max(number_clusters, amount_partial));
 
-        /* merge new cluster using these clusters */
-        queue->merge(cluster1, cluster2, number_points, compression);
+        arena.get_clusters(begin, partial_clusters[p_partition]);
+    }, 1);
 
-        allocated_clusters = queue->size();
+    cluster_sequence groups;
+    for (auto & clusters : partial_clusters) {
+        std::move(clusters.begin(), clusters.end(), std::back_inserter(groups));
+        cluster_sequence().swap(clusters);
     }
 
-    p_result = cure_data();
-    cure_data & result = (cure_data &) p_result;
+    cure_arena arena(p_sample, number_points, compression);
+    arena.initialize(groups);
+    arena.merge(number_clusters);
 
-    /* prepare standard representation of clusters */
-    cluster_sequence & clusters = result.clusters();
-    representor_sequence & representors = result.representors();
+    arena.get_clusters(0, p_result.clusters());
+    arena.get_representors(p_result.representors(), p_result.means());
+}
 
-    clusters.resize(queue->size());
-    representors.resize(queue->size());
 
-    size_t cluster_index = 0;
-    for (auto cure_cluster = queue->begin(); cure_cluster != queue->end(); ++cure_cluster, cluster_index++) {
-        cluster & standard_cluster = clusters[cluster_index];
-        for (auto point = (*cure_cluster)->points->begin(); point != (*cure_cluster)->points->end(); ++point) {
-            size_t index_point = (size_t) (*point - &(*(data->begin())));
-            standard_cluster.push_back(index_point);
-        }
+template <typename TypeValue>
+void cure::assign_points(const points_view<TypeValue> & p_points, const index_sequence & p_sample, cure_data & p_result) const {
+    const std::size_t dimension = p_points.cols();
+
+    /* representative points are converted to type of the points, so the points are not converted */
+    std::vector<TypeValue> representors;
+    index_sequence owners;
 
-        dataset & cluster_representors = representors[cluster_index];
-        for (auto point : *(*cure_cluster)->rep) {
-            cluster_representors.push_back(*point);
+    for (std::size_t index_cluster = 0; index_cluster < p_result.representors().size(); index_cluster++) {
+        for (const auto & point : p_result.representors()[index_cluster]) {
+            representors.insert(representors.end(), point.begin(), point.end());
+            owners.push_back(index_cluster);
         }
+    }
 
-        result.means().push_back((*(*cure_cluster)->mean));
+    std::vector<char> in_sample(p_points.rows(), 0);
+    for (const std::size_t index_point : p_sample) {
+        in_sample[index_point] = 1;
     }
 
-    p_result = result;
+    index_sequence labels(p_points.rows(), 0);
+    parallel_for(std::size_t(0), p_points.rows(), [&p_points, &representors, &owners, &in_sample, &labels, dimension](const std::size_t p_index) {
+        if (in_sample[p_index]) {
+            return;
+        }
 
-    delete queue;
-    queue = nullptr;
+        double minimal_distance = std::numeric_limits<double>::max();
+        for (std::size_t i = 0; i < owners.size(); i++) {
+            const double distance = simd::euclidean_distance_square(p_points.row(p_index), representors.data() + i * dimension, dimension);
+            if (distance < minimal_distance) {
+                minimal_distance = distance;
+                labels[p_index] = owners[i];
+            }
+        }
+    });
+
+    for (std::size_t index_point = 0; index_point < p_points.rows(); index_point++) {
+        if (!in_sample[index_point]) {
+            p_result.clusters()[labels[index_point]].push_back(index_point);
+        }
+    }
 }
 
 
@@ -23,44 +23,102 @@
 
 #include <pyclustering/cluster/dbscan.hpp>
 
+#include <pyclustering/container/disjoint_set.hpp>
+
+#include <pyclustering/parallel/parallel.hpp>
+
 #include <string>
 #include <unordered_set>
 
 
+using namespace pyclustering::container;
+using namespace pyclustering::parallel;
+using namespace pyclustering::utils::metric;
+
+
 namespace pyclustering {
 
 namespace clst {
 
 
-dbscan::dbscan(const double p_radius_connectivity, const size_t p_minimum_neighbors) :
+dbscan::dbscan(const double p_radius_connectivity, const size_t p_minimum_neighbors, const bool p_parallel) :
         m_data_ptr(nullptr),
         m_result_ptr(nullptr),
         m_visited(std::vector<bool>()),
         m_belong(std::vector<bool>()),
         m_initial_radius(p_radius_connectivity),
-        m_neighbors(p_minimum_neighbors)
+        m_neighbors(p_minimum_neighbors),
+        m_parallel(p_parallel)
 { }
 
 
+dbscan::dbscan(const double p_radius_connectivity, const size_t p_minimum_neighbors, const hnsw_parameters & p_index_parameters, const bool p_parallel) :
+        dbscan(p_radius_connectivity, p_minimum_neighbors, p_parallel)
+{
+    m_approximate = true;
+    m_index_parameters = p_index_parameters;
+}
+
+
 void dbscan::process(const dataset & p_data, cluster_data & p_result) {
     process(p_data, dbscan_data_t::POINTS, p_result);
 }
 
 
 void dbscan::process(const dataset & p_data, const dbscan_data_t p_type, cluster_data & p_result) {
-    m_data_ptr  = &p_data;
-    m_type      = p_type;
+    m_data_ptr    = &p_data;
+    m_points_ptr  = nullptr;
+    m_size        = p_data.size();
+    m_type        = p_type;
+
+    process_input(p_result);
+}
+
 
+void dbscan::process(const points_view<double> & p_points, cluster_data & p_result) {
+    m_data_ptr    = nullptr;
+    m_points_ptr  = &p_points;
+    m_size        = p_points.rows();
+    m_type        = dbscan_data_t::POINTS;
+
+    process_input(p_result);
+}
+
+
+void dbscan::process_input(cluster_data & p_result) {
     if (m_type == dbscan_data_t::POINTS) {
-        create_kdtree(*m_data_ptr);
+        if (m_approximate) {
+            create_index();
+        }
+        else {
+            create_kdtree();
+        }
     }
 
-    m_visited = std::vector<bool>(m_data_ptr->size(), false);
+    m_visited = std::vector<bool>(m_size, false);
     m_belong = m_visited;
+    m_queued = m_visited;
 
     m_result_ptr = (dbscan_data *) &p_result;
 
-    for (size_t i = 0; i < m_data_ptr->size(); i++) {
+    if (m_parallel) {
+        process_parallel();
+    }
+    else {
+        process_sequential();
+    }
+
+    m_kdtree = container::flat_kdtree();
+    m_index = container::hnsw_index();
+
+    m_data_ptr = nullptr;
+    m_points_ptr = nullptr;
+    m_result_ptr = nullptr;
+}
+
+
+void dbscan::process_sequential() {
+    for (size_t i = 0; i < m_size; i++) {
         if (m_visited[i]) {
             continue;
         }
@@ -76,14 +134,11 @@ void dbscan::process(const dataset & p_data, const dbscan_data_t p_type, cluster
         }
     }
 
-    for (size_t i = 0; i < m_data_ptr->size(); i++) {
+    for (size_t i = 0; i < m_size; i++) {
         if (!m_belong[i]) {
             m_result_ptr->noise().emplace_back(i);
         }
     }
-
-    m_data_ptr = nullptr;
-    m_result_ptr = nullptr;
 }
 
 
@@ -95,6 +150,12 @@ void dbscan::expand_cluster(const std::size_t p_index, cluster & allocated_clust
         allocated_cluster.push_back(p_index);
         m_belong[p_index] = true;
 
+        /* bitmap of objects that are already in the check list */
+        m_queued[p_index] = true;
+        for (const auto index_neighbor : index_matrix_neighbors) {
+            m_queued[index_neighbor] = true;
+        }
+
         for (std::size_t k = 0; k < index_matrix_neighbors.size(); k++) {
             std::size_t index_neighbor = index_matrix_neighbors[k];
 
@@ -108,10 +169,9 @@ void dbscan::expand_cluster(const std::size_t p_index, cluster & allocated_clust
 
                     /* Add neighbors of the neighbor for checking */
                     for (auto neighbor_index : neighbor_neighbor_indexes) {
-                        /* Check if some of neighbors already in check list */
-                        std::vector<std::size_t>::const_iterator position = std::find(index_matrix_neighbors.begin(), index_matrix_neighbors.end(), neighbor_index);
-                        if (position == index_matrix_neighbors.end()) {
-                            /* Add neighbor if it does not exist in the list */
+                        /* Add neighbor if it does not exist in the list */
+                        if (!m_queued[neighbor_index]) {
+                            m_queued[neighbor_index] = true;
                             index_matrix_neighbors.push_back(neighbor_index);
                         }
                     }
@@ -124,11 +184,79 @@ void dbscan::expand_cluster(const std::size_t p_index, cluster & allocated_clust
             }
         }
 
+        /* only objects of the check list were marked, so the bitmap is reset without touching the rest */
+        m_queued[p_index] = false;
+        for (const auto index_neighbor : index_matrix_neighbors) {
+            m_queued[index_neighbor] = false;
+        }
+
         index_matrix_neighbors.clear();
     }
 }
 
 
+void dbscan::process_parallel() {
+    const std::size_t size = m_size;
+
+    /* phase 1: range queries are independent, kd-tree is only read */
+    std::vector<std::vector<std::size_t>> neighbors(size);
+    parallel_for(std::size_t(0), size, [this, &neighbors](const std::size_t p_index) {
+        get_neighbors(p_index, neighbors[p_index]);
+    });
+
+    std::vector<bool> core(size, false);
+    for (std::size_t i = 0; i < size; i++) {
+        core[i] = (neighbors[i].size() >= m_neighbors);
+    }
+
+    /* phase 2: core objects that are neighbors belong to the same cluster */
+    disjoint_set clusters(size);
+    for (std::size_t i = 0; i < size; i++) {
+        if (!core[i]) {
+            continue;
+        }
+
+        for (const auto index_neighbor : neighbors[i]) {
+            if (core[index_neighbor]) {
+                clusters.merge(i, index_neighbor);
+            }
+        }
+    }
+
+    /* phase 3: border objects join the cluster of the first core neighbor */
+    std::vector<std::size_t> owner(size, size);
+    for (std::size_t i = 0; i < size; i++) {
+        if (core[i]) {
+            owner[i] = clusters.find(i);
+            continue;
+        }
+
+        for (const auto index_neighbor : neighbors[i]) {
+            if (core[index_neighbor]) {
+                owner[i] = clusters.find(index_neighbor);
+                break;
+            }
+        }
+    }
+
+    std::vector<std::size_t> cluster_index(size, size);
+    for (std::size_t i = 0; i < size; i++) {
+        const std::size_t root = owner[i];
+        if (root == size) {
+            m_result_ptr->noise().emplace_back(i);
+            continue;
+        }
+
+        if (cluster_index[root] == size) {
+            cluster_index[root] = m_result_ptr->clusters().size();
+            m_result_ptr->clusters().emplace_back();
+        }
+
+        m_result_ptr->clusters()[cluster_index[root]].push_back(i);
+    }
+}
+
+
 void dbscan::get_neighbors(const size_t p_index, std::vector<size_t> & p_neighbors) {
     switch(m_type) {
     case dbscan_data_t::POINTS:
@@ -146,10 +274,22 @@ void dbscan::get_neighbors(const size_t p_index, std::vector<size_t> & p_neighbo
 
 
 void dbscan::get_neighbors_from_points(const size_t p_index, std::vector<size_t> & p_neighbors) {
-    container::kdtree_searcher searcher((*m_data_ptr)[p_index], m_kdtree.get_root(), m_initial_radius);
-    searcher.find_nearest([&p_index, &p_neighbors](const container::kdnode::ptr & node, const double distance) {
-            if (p_index != (std::size_t) node->get_payload()) {
-                p_neighbors.push_back((std::size_t) node->get_payload());
+    if (m_approximate) {
+        thread_local hnsw_index::neighbor_sequence neighbors;
+        m_index.radius_search(get_point(p_index), m_initial_radius, neighbors);
+
+        for (const auto & neighbor : neighbors) {
+            if (neighbor.m_index != p_index) {
+                p_neighbors.push_back(neighbor.m_index);
+            }
+        }
+
+        return;
+    }
+
+    m_kdtree.radius_search(get_point(p_index), m_initial_radius, [p_index, &p_neighbors](const std::size_t p_index_neighbor, const double) {
+            if (p_index != p_index_neighbor) {
+                p_neighbors.push_back(p_index_neighbor);
             }
         });
 }
@@ -166,9 +306,27 @@ void dbscan::get_neighbors_from_distance_matrix(const size_t p_index, std::vecto
 }
 
 
-void dbscan::create_kdtree(const dataset & p_data) {
-    for (std::size_t index = 0; index < p_data.size(); index++) {
-        m_kdtree.insert(p_data[index], (void *) index);
+const double * dbscan::get_point(const std::size_t p_index) const {
+    return (m_points_ptr != nullptr) ? m_points_ptr->row(p_index) : (*m_data_ptr)[p_index].data();
+}
+
+
+void dbscan::create_kdtree() {
+    if (m_points_ptr != nullptr) {
+        m_kdtree = container::flat_kdtree(*m_points_ptr);
+    }
+    else {
+        m_kdtree = container::flat_kdtree(*m_data_ptr);
+    }
+}
+
+
+void dbscan::create_index() {
+    if (m_points_ptr != nullptr) {
+        m_index = container::hnsw_index(*m_points_ptr, m_index_parameters);
+    }
+    else {
+        m_index = container::hnsw_index(*m_data_ptr, m_index_parameters);
     }
 }
 
@@ -25,14 +25,17 @@
 #include <pyclustering/parallel/parallel.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <unordered_map>
 
 #include <pyclustering/utils/metric.hpp>
+#include <pyclustering/utils/metric_simd.hpp>
 
 
 using namespace pyclustering::parallel;
 using namespace pyclustering::utils::metric;
+using namespace pyclustering::utils::metric::simd;
 
 
 namespace pyclustering {
@@ -44,14 +47,49 @@ const double             kmeans::DEFAULT_TOLERANCE                       = 0.001
 
 const std::size_t        kmeans::DEFAULT_ITERMAX                         = 100;
 
+const std::size_t        kmeans::HAMERLY_MAX_CLUSTERS                    = 32;
 
-kmeans::kmeans(const dataset & p_initial_centers, const double p_tolerance, const std::size_t p_itermax, const distance_metric<point> & p_metric) :
+const std::size_t        kmeans::ELKAN_MAX_BOUNDS                        = std::size_t(1) << 25;
+
+
+/* Center and its distance to another center, Hamerly assignment keeps them sorted by distance for each center. */
+struct center_neighbor {
+    double          m_distance  = 0.0;
+    std::size_t     m_index     = 0;
+};
+
+
+/* Calculates square Euclidean distances from the point to the specified centers, four centers share each load of the point. */
+template <typename TypeValue, typename TypeIndex>
+static void calculate_center_distances(const TypeValue * p_point, const std::vector<TypeValue> & p_centers, const std::size_t p_dimension,
+    const std::size_t p_amount, const TypeIndex & p_index, const kernel_set<TypeValue> & p_kernels, double * p_distances)
+{
+    std::size_t position = 0;
+    for (; position + DOT_PRODUCT_BLOCK_SIZE <= p_amount; position += DOT_PRODUCT_BLOCK_SIZE) {
+        const TypeValue * centers[DOT_PRODUCT_BLOCK_SIZE] = {
+            p_centers.data() + p_index(position) * p_dimension,
+            p_centers.data() + p_index(position + 1) * p_dimension,
+            p_centers.data() + p_index(position + 2) * p_dimension,
+            p_centers.data() + p_index(position + 3) * p_dimension
+        };
+
+        p_kernels.euclidean_distance_square_block(p_point, centers, p_dimension, p_distances + position);
+    }
+
+    for (; position < p_amount; position++) {
+        p_distances[position] = p_kernels.euclidean_distance_square(p_point, p_centers.data() + p_index(position) * p_dimension, p_dimension);
+    }
+}
+
+
+kmeans::kmeans(const dataset & p_initial_centers, const double p_tolerance, const std::size_t p_itermax, const distance_metric<point> & p_metric, const kmeans_assignment p_assignment) :
     m_tolerance(p_tolerance),
     m_itermax(p_itermax),
     m_initial_centers(p_initial_centers),
     m_ptr_result(nullptr),
     m_ptr_data(nullptr),
-    m_metric(p_metric)
+    m_metric(p_metric),
+    m_assignment(p_assignment)
 { }
 
 
@@ -70,6 +108,36 @@ void kmeans::process(const dataset & p_data, const index_sequence & p_indexes, c
         throw std::invalid_argument("Dimension of the input data and dimension of the initial cluster centers must be the same.");
     }
 
+    if ((m_assignment != kmeans_assignment::LLOYD) && !m_ptr_result->is_observed()) {
+        std::vector<double> buffer;
+        points_view<double> points;
+        if (p_indexes.empty()) {
+            points = pack_points(p_data, buffer);
+        }
+        else {
+            const std::size_t dimension = p_data[0].size();
+            buffer.resize(p_indexes.size() * dimension);
+            for (std::size_t i = 0; i < p_indexes.size(); i++) {
+                std::copy(p_data[p_indexes[i]].begin(), p_data[p_indexes[i]].end(), buffer.begin() + i * dimension);
+            }
+
+            points = points_view<double>(buffer.data(), p_indexes.size(), dimension, dimension);
+        }
+
+        process_bounded(points, *m_ptr_result);
+
+        /* rows of the packed buffer are translated back to the indexes of the input data */
+        if (!p_indexes.empty()) {
+            for (auto & current_cluster : m_ptr_result->clusters()) {
+                for (auto & index_point : current_cluster) {
+                    index_point = p_indexes[index_point];
+                }
+            }
+        }
+
+        return;
+    }
+
     m_ptr_result->centers().assign(m_initial_centers.begin(), m_initial_centers.end());
 
     if (m_ptr_result->is_observed()) {
@@ -96,6 +164,381 @@ void kmeans::process(const dataset & p_data, const index_sequence & p_indexes, c
 }
 
 
+void kmeans::process(const points_view<double> & p_points, cluster_data & p_result) {
+    process_view(p_points, p_result);
+}
+
+
+void kmeans::process(const points_view<float> & p_points, cluster_data & p_result) {
+    process_view(p_points, p_result);
+}
+
+
+template <typename TypeValue>
+void kmeans::process_view(const points_view<TypeValue> & p_points, cluster_data & p_result) {
+    m_ptr_result = (kmeans_data *) &p_result;
+
+    if (p_points.cols() != m_initial_centers[0].size()) {
+        throw std::invalid_argument("Dimension of the input data and dimension of the initial cluster centers must be the same.");
+    }
+
+    process_bounded(p_points, *m_ptr_result);
+}
+
+
+kmeans_assignment kmeans::choose_assignment(const std::size_t p_amount_points) const {
+    if (m_assignment != kmeans_assignment::AUTOMATIC) {
+        return m_assignment;
+    }
+
+    const std::size_t amount_clusters = m_initial_centers.size();
+    if ((amount_clusters <= HAMERLY_MAX_CLUSTERS) || (p_amount_points * amount_clusters > ELKAN_MAX_BOUNDS)) {
+        return kmeans_assignment::HAMERLY;
+    }
+
+    return kmeans_assignment::ELKAN;
+}
+
+
+template <typename TypeValue>
+void kmeans::process_bounded(const points_view<TypeValue> & p_points, kmeans_data & p_result) {
+    const std::size_t amount = p_points.rows();
+    const std::size_t dimension = p_points.cols();
+    const std::size_t amount_clusters = m_initial_centers.size();
+    const kmeans_assignment assignment = choose_assignment(amount);
+    const kernel_set<TypeValue> & kernels = get_kernels<TypeValue>();
+
+    /* centers have type of the points for the distance kernels, sums of clusters are accumulated in double */
+    std::vector<TypeValue> centers(amount_clusters * dimension);
+    for (std::size_t index_cluster = 0; index_cluster < amount_clusters; index_cluster++) {
+        std::copy(m_initial_centers[index_cluster].begin(), m_initial_centers[index_cluster].end(), centers.begin() + index_cluster * dimension);
+    }
+
+    /* sums and sizes of clusters are updated only by points that change cluster */
+    std::vector<double> sums(amount_clusters * dimension, 0.0);
+    std::vector<std::size_t> sizes(amount_clusters, 0);
+
+    std::vector<std::size_t> labels(amount, amount_clusters);
+    std::vector<std::size_t> previous_labels(amount, amount_clusters);
+
+    /* upper bound of the distance to the own center, lower bound of the distance to other centers (Hamerly) or to each center (Elkan) */
+    std::vector<double> upper(amount, 0.0);
+    std::vector<double> lower;
+    if (assignment == kmeans_assignment::HAMERLY) {
+        lower.resize(amount, 0.0);
+    }
+    else if (assignment == kmeans_assignment::ELKAN) {
+        lower.resize(amount * amount_clusters, 0.0);
+    }
+
+    std::vector<double> half_center_distances;                /* Elkan */
+    std::vector<center_neighbor> neighbors;                     /* Hamerly */
+    std::vector<double> separation(amount_clusters, 0.0);      /* half of the distance to the closest other center */
+    std::vector<double> shifts(amount_clusters, 0.0);
+    std::vector<double> changes(amount_clusters, 0.0);
+
+    const auto assign_exhaustively = [&](const std::size_t p_index) {
+        thread_local std::vector<double> distances;
+        distances.resize(amount_clusters);
+        calculate_center_distances(p_points.row(p_index), centers, dimension, amount_clusters,
+            [](const std::size_t p_position) { return p_position; }, kernels, distances.data());
+
+        std::size_t closest = 0;
+        double closest_distance = std::numeric_limits<double>::max();
+        double second_distance = std::numeric_limits<double>::max();
+        for (std::size_t index_cluster = 0; index_cluster < amount_clusters; index_cluster++) {
+            if (distances[index_cluster] < closest_distance) {
+                second_distance = closest_distance;
+                closest_distance = distances[index_cluster];
+                closest = index_cluster;
+            }
+            else if (distances[index_cluster] < second_distance) {
+                second_distance = distances[index_cluster];
+            }
+        }
+
+        labels[p_index] = closest;
+        upper[p_index] = std::sqrt(closest_distance);
+
+        if (assignment == kmeans_assignment::HAMERLY) {
+            lower[p_index] = std::sqrt(second_distance);
+        }
+        else if (assignment == kmeans_assignment::ELKAN) {
+            double * bounds = lower.data() + p_index * amount_clusters;
+            for (std::size_t index_cluster = 0; index_cluster < amount_clusters; index_cluster++) {
+                bounds[index_cluster] = std::sqrt(distances[index_cluster]);
+            }
+        }
+    };
+
+    const auto distance_to_center = [&](const std::size_t p_index, const std::size_t p_index_cluster) {
+        return std::sqrt(kernels.euclidean_distance_square(p_points.row(p_index), centers.data() + p_index_cluster * dimension, dimension));
+    };
+
+    const auto assign_hamerly = [&](const std::size_t p_index) {
+        const double bound = std::max(separation[labels[p_index]], lower[p_index]);
+        if (upper[p_index] <= bound) {
+            return;
+        }
+
+        const std::size_t label = labels[p_index];
+        const double distance = distance_to_center(p_index, label);
+        upper[p_index] = distance;
+        if (distance <= bound) {
+            return;
+        }
+
+        /* centers are visited in order of distance to the current center, the point is at least (their distance - distance)
+           far from them, so the search stops when this exceeds the second closest distance and both bounds stay exact */
+        const center_neighbor * row = neighbors.data() + label * amount_clusters;
+
+        std::size_t closest = label;
+        double closest_distance = std::numeric_limits<double>::max();
+        double second_distance = std::numeric_limits<double>::max();
+        for (std::size_t position = 0; position < amount_clusters; position += DOT_PRODUCT_BLOCK_SIZE) {
+            if (row[position].m_distance - distance >= second_distance) {
+                break;
+            }
+
+            const std::size_t block = std::min(DOT_PRODUCT_BLOCK_SIZE, amount_clusters - position);
+
+            double distances[DOT_PRODUCT_BLOCK_SIZE];
+            calculate_center_distances(p_points.row(p_index), centers, dimension, block,
+                [row, position](const std::size_t p_position) { return row[position + p_position].m_index; }, kernels, distances);
+
+            for (std::size_t i = 0; i < block; i++) {
+                const double candidate_distance = std::sqrt(distances[i]);
+                if (candidate_distance < closest_distance) {
+                    second_distance = closest_distance;
+                    closest_distance = candidate_distance;
+                    closest = row[position + i].m_index;
+                }
+                else if (candidate_distance < second_distance) {
+                    second_distance = candidate_distance;
+                }
+            }
+        }
+
+        labels[p_index] = closest;
+        upper[p_index] = closest_distance;
+        lower[p_index] = second_distance;
+    };
+
+    const auto assign_elkan = [&](const std::size_t p_index) {
+        std::size_t label = labels[p_index];
+        double distance = upper[p_index];
+        if (distance <= separation[label]) {
+            return;
+        }
+
+        double * bounds = lower.data() + p_index * amount_clusters;
+        bool tight = false;
+        for (std::size_t index_cluster = 0; index_cluster < amount_clusters; index_cluster++) {
+            if ((index_cluster == label) || (distance <= bounds[index_cluster]) || (distance <= half_center_distances[label * amount_clusters + index_cluster])) {
+                continue;
+            }
+
+            if (!tight) {
+                distance = distance_to_center(p_index, label);
+                bounds[label] = distance;
+                tight = true;
+
+                if ((distance <= bounds[index_cluster]) || (distance <= half_center_distances[label * amount_clusters + index_cluster])) {
+                    continue;
+                }
+            }
+
+            const double candidate_distance = distance_to_center(p_index, index_cluster);
+            bounds[index_cluster] = candidate_distance;
+            if (candidate_distance < distance) {
+                distance = candidate_distance;
+                label = index_cluster;
+            }
+        }
+
+        labels[p_index] = label;
+        upper[p_index] = distance;
+    };
+
+    bool assigned = false;
+    double current_change = std::numeric_limits<double>::max();
+
+    for (std::size_t iteration = 0; iteration < m_itermax && current_change > m_tolerance; iteration++) {
+        if (!assigned || (assignment == kmeans_assignment::LLOYD)) {
+            parallel_for(std::size_t(0), amount, assign_exhaustively);
+            assigned = true;
+        }
+        else if (assignment == kmeans_assignment::HAMERLY) {
+            neighbors.resize(amount_clusters * amount_clusters);
+            parallel_for(std::size_t(0), amount_clusters, [&](const std::size_t p_index_cluster) {
+                thread_local std::vector<double> distances;
+                distances.resize(amount_clusters);
+                calculate_center_distances(centers.data() + p_index_cluster * dimension, centers, dimension, amount_clusters,
+                    [](const std::size_t p_position) { return p_position; }, kernels, distances.data());
+
+                center_neighbor * row = neighbors.data() + p_index_cluster * amount_clusters;
+                for (std::size_t index_other = 0; index_other < amount_clusters; index_other++) {
+                    row[index_other].m_distance = std::sqrt(distances[index_other]);
+                    row[index_other].m_index = index_other;
+                }
+
+                /* the center itself goes first even if another center has the same coordinates */
+                row[p_index_cluster].m_distance = -1.0;
+                std::sort(row, row + amount_clusters, [](const center_neighbor & p_neighbor1, const center_neighbor & p_neighbor2) {
+                    return p_neighbor1.m_distance < p_neighbor2.m_distance;
+                });
+                row[0].m_distance = 0.0;
+
+                separation[p_index_cluster] = (amount_clusters > 1) ? 0.5 * row[1].m_distance : std::numeric_limits<double>::max();
+            });
+
+            parallel_for(std::size_t(0), amount, assign_hamerly);
+        }
+        else {
+            half_center_distances.resize(amount_clusters * amount_clusters);
+            compute_distance_matrix(points_view<TypeValue>(centers.data(), amount_clusters, dimension, dimension),
+                distance_type::EUCLIDEAN, half_center_distances.data(), amount_clusters);
+
+            for (std::size_t index_cluster = 0; index_cluster < amount_clusters; index_cluster++) {
+                double * row = half_center_distances.data() + index_cluster * amount_clusters;
+                separation[index_cluster] = std::numeric_limits<double>::max();
+                for (std::size_t index_other = 0; index_other < amount_clusters; index_other++) {
+                    row[index_other] *= 0.5;
+                    if ((index_other != index_cluster) && (row[index_other] < separation[index_cluster])) {
+                        separation[index_cluster] = row[index_other];
+                    }
+                }
+            }
+
+            parallel_for(std::size_t(0), amount, assign_elkan);
+        }
+
+        for (std::size_t index_point = 0; index_point < amount; index_point++) {
+            const std::size_t previous = previous_labels[index_point];
+            const std::size_t current = labels[index_point];
+            if (previous == current) {
+                continue;
+            }
+
+            const TypeValue * coordinates = p_points.row(index_point);
+            if (previous != amount_clusters) {
+                double * sum = sums.data() + previous * dimension;
+                for (std::size_t i = 0; i < dimension; i++) {
+                    sum[i] -= coordinates[i];
+                }
+                sizes[previous]--;
+            }
+
+            double * sum = sums.data() + current * dimension;
+            for (std::size_t i = 0; i < dimension; i++) {
+                sum[i] += coordinates[i];
+            }
+            sizes[current]++;
+
+            previous_labels[index_point] = current;
+        }
+
+        /* centers of empty clusters stay in place */
+        parallel_for(std::size_t(0), amount_clusters, [&](const std::size_t p_index_cluster) {
+            shifts[p_index_cluster] = 0.0;
+            changes[p_index_cluster] = 0.0;
+            if (sizes[p_index_cluster] == 0) {
+                return;
+            }
+
+            TypeValue * center = centers.data() + p_index_cluster * dimension;
+            const double * sum = sums.data() + p_index_cluster * dimension;
+
+            const std::vector<TypeValue> previous_values(center, center + dimension);
+            const point previous_center(center, center + dimension);
+            for (std::size_t i = 0; i < dimension; i++) {
+                center[i] = static_cast<TypeValue>(sum[i] / (double) sizes[p_index_cluster]);
+            }
+
+            shifts[p_index_cluster] = std::sqrt(kernels.euclidean_distance_square(previous_values.data(), center, dimension));
+            changes[p_index_cluster] = m_metric(previous_center, point(center, center + dimension));
+        });
+
+        current_change = *std::max_element(changes.begin(), changes.end());
+
+        /* bounds are moved by the center shifts, so they stay valid without calculation of distances */
+        if (assignment == kmeans_assignment::HAMERLY) {
+            std::size_t farthest = 0;
+            double farthest_shift = 0.0;
+            double second_shift = 0.0;
+            for (std::size_t index_cluster = 0; index_cluster < amount_clusters; index_cluster++) {
+                if (shifts[index_cluster] > farthest_shift) {
+                    second_shift = farthest_shift;
+                    farthest_shift = shifts[index_cluster];
+                    farthest = index_cluster;
+                }
+                else if (shifts[index_cluster] > second_shift) {
+                    second_shift = shifts[index_cluster];
+                }
+            }
+
+            parallel_for(std::size_t(0), amount, [&](const std::size_t p_index) {
+                upper[p_index] += shifts[labels[p_index]];
+                lower[p_index] -= (labels[p_index] == farthest) ? second_shift : farthest_shift;
+            });
+        }
+        else if (assignment == kmeans_assignment::ELKAN) {
+            parallel_for(std::size_t(0), amount, [&](const std::size_t p_index) {
+                upper[p_index] += shifts[labels[p_index]];
+
+                double * bounds = lower.data() + p_index * amount_clusters;
+                for (std::size_t index_cluster = 0; index_cluster < amount_clusters; index_cluster++) {
+                    bounds[index_cluster] = std::max(bounds[index_cluster] - shifts[index_cluster], 0.0);
+                }
+            });
+        }
+    }
+
+    cluster_sequence & clusters = p_result.clusters();
+    dataset & result_centers = p_result.centers();
+
+    clusters.clear();
+    result_centers.clear();
+    p_result.wce() = 0.0;
+
+    if (!assigned) {
+        result_centers.assign(m_initial_centers.begin(), m_initial_centers.end());
+        return;
+    }
+
+    dataset final_centers(amount_clusters);
+    for (std::size_t index_cluster = 0; index_cluster < amount_clusters; index_cluster++) {
+        final_centers[index_cluster].assign(centers.begin() + index_cluster * dimension, centers.begin() + (index_cluster + 1) * dimension);
+    }
+
+    std::vector<double> errors(amount, 0.0);
+    parallel_for(std::size_t(0), amount, [&](const std::size_t p_index) {
+        thread_local point coordinates;
+        coordinates.assign(p_points.row(p_index), p_points.row(p_index) + dimension);
+        errors[p_index] = m_metric(coordinates, final_centers[labels[p_index]]);
+    });
+
+    for (const double error : errors) {
+        p_result.wce() += error;
+    }
+
+    /* clusters and centers are erased together, so they stay aligned */
+    std::vector<std::size_t> positions(amount_clusters, 0);
+    for (std::size_t index_cluster = 0; index_cluster < amount_clusters; index_cluster++) {
+        if (sizes[index_cluster] > 0) {
+            positions[index_cluster] = clusters.size();
+            clusters.emplace_back();
+            clusters.back().reserve(sizes[index_cluster]);
+            result_centers.push_back(std::move(final_centers[index_cluster]));
+        }
+    }
+
+    for (std::size_t index_point = 0; index_point < amount; index_point++) {
+        clusters[positions[labels[index_point]]].push_back(index_point);
+    }
+}
+
+
 void kmeans::update_clusters(const dataset & p_centers, cluster_sequence & p_clusters) {
     const dataset & data = *m_ptr_data;
 
@@ -23,6 +23,8 @@
 
 #include <pyclustering/cluster/kmeans_plus_plus.hpp>
 
+#include <pyclustering/parallel/parallel.hpp>
+
 #include <algorithm>
 #include <chrono>
 #include <exception>
@@ -127,6 +129,7 @@ void kmeans_plus_plus::store_temporal_params(const dataset & p_data, const index
 
     m_allocated_indexes.clear();
     m_free_indexes.clear();
+    m_shortest_distances.clear();
 
     if (m_indexes_ptr->empty())
     {
@@ -188,35 +191,24 @@ kmeans_plus_plus::center_description kmeans_plus_plus::get_next_center() const
 
 void kmeans_plus_plus::calculate_shortest_distances(std::vector<double> & p_distances) const
 {
-    p_distances.reserve(m_data_ptr->size());
-
-    if (m_indexes_ptr->empty())
-    {
-        for (auto & point : (*m_data_ptr)) {
-            double shortest_distance = get_shortest_distance(point);
-            p_distances.push_back(shortest_distance);
-        }
-    }
-    else {
-        for (auto index : (*m_indexes_ptr)) {
-            double shortest_distance = get_shortest_distance((*m_data_ptr)[index]);
-            p_distances.push_back(shortest_distance);
-        }
+    const std::size_t length = m_indexes_ptr->empty() ? m_data_ptr->size() : m_indexes_ptr->size();
+    if (m_shortest_distances.size() != length) {
+        m_shortest_distances.assign(length, std::numeric_limits<double>::max());
     }
 
-}
-
+    /* allocated indexes are positions in the index sequence when it is specified */
+    const std::size_t last_center = m_allocated_indexes.back();
+    const point & center = m_indexes_ptr->empty() ? (*m_data_ptr)[last_center] : (*m_data_ptr)[(*m_indexes_ptr)[last_center]];
 
-double kmeans_plus_plus::get_shortest_distance(const point & p_point) const {
-    double shortest_distance = std::numeric_limits<double>::max();
-    for (auto & index_point : m_allocated_indexes) {
-        double distance = std::abs(m_dist_func(p_point, m_data_ptr->at(index_point)));
-        if (distance < shortest_distance) {
-            shortest_distance = distance;
+    parallel::parallel_for(std::size_t(0), length, [this, &center](const std::size_t p_index) {
+        const point & current_point = m_indexes_ptr->empty() ? (*m_data_ptr)[p_index] : (*m_data_ptr)[(*m_indexes_ptr)[p_index]];
+        const double distance = std::abs(m_dist_func(current_point, center));
+        if (distance < m_shortest_distances[p_index]) {
+            m_shortest_distances[p_index] = distance;
         }
-    }
+    });
 
-    return shortest_distance;
+    p_distances = m_shortest_distances;
 }
 
 
@@ -0,0 +1,306 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include <pyclustering/cluster/minibatch_kmeans.hpp>
+
+#include <pyclustering/cluster/kmeans_plus_plus.hpp>
+#include <pyclustering/parallel/parallel.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+
+using namespace pyclustering::parallel;
+using namespace pyclustering::utils::metric;
+
+
+namespace pyclustering {
+
+namespace clst {
+
+
+const std::size_t minibatch_kmeans::DEFAULT_BATCH_SIZE  = 1024;
+
+const std::size_t minibatch_kmeans::DEFAULT_ITERMAX     = 100;
+
+
+minibatch_kmeans::minibatch_kmeans(const std::size_t p_amount_clusters, const std::size_t p_batch_size, const std::size_t p_itermax) :
+    m_amount_clusters(p_amount_clusters),
+    m_batch_size(p_batch_size),
+    m_itermax(p_itermax)
+{
+    if (p_amount_clusters == 0) {
+        throw std::invalid_argument("Amount of clusters should be greater than 0.");
+    }
+
+    if (p_batch_size == 0) {
+        throw std::invalid_argument("Batch size should be greater than 0.");
+    }
+}
+
+
+void minibatch_kmeans::process(const dataset & p_data, cluster_data & p_result) {
+    std::vector<double> buffer;
+    process(pack_points(p_data, buffer), p_result);
+}
+
+
+void minibatch_kmeans::process(const points_view<double> & p_points, cluster_data & p_result) {
+    process_view(p_points, p_result);
+}
+
+
+void minibatch_kmeans::process(const points_view<float> & p_points, cluster_data & p_result) {
+    process_view(p_points, p_result);
+}
+
+
+template <typename TypeValue>
+void minibatch_kmeans::process_view(const points_view<TypeValue> & p_points, cluster_data & p_result) {
+    if (p_points.rows() < m_amount_clusters) {
+        throw std::invalid_argument("Amount of points should be equal or greater than amount of clusters.");
+    }
+
+    reset();
+
+    /* batches are consecutive parts of a random permutation, so the points used to initialize centers are distinct */
+    std::vector<std::size_t> order(p_points.rows());
+    std::iota(order.begin(), order.end(), std::size_t(0));
+
+    std::mt19937 generator(std::random_device{ }());
+    std::shuffle(order.begin(), order.end(), generator);
+
+    /* only the batch is converted to double, points are assigned in their own type */
+    const std::size_t batch_size = std::min(m_batch_size, p_points.rows());
+    std::vector<double> batch(batch_size * p_points.cols());
+
+    std::size_t position = 0;
+    for (std::size_t iteration = 0; (iteration < m_itermax) || !is_initialized(); iteration++) {
+        for (std::size_t i = 0; i < batch_size; i++) {
+            if (position == order.size()) {
+                std::shuffle(order.begin(), order.end(), generator);
+                position = 0;
+            }
+
+            const TypeValue * point = p_points.row(order[position++]);
+            std::copy(point, point + p_points.cols(), batch.begin() + i * p_points.cols());
+        }
+
+        partial_fit(points_view<double>(batch.data(), batch_size, p_points.cols(), p_points.cols()));
+    }
+
+    assign(p_points, p_result);
+}
+
+
+void minibatch_kmeans::partial_fit(const points_view<double> & p_batch) {
+    if (p_batch.rows() == 0) {
+        return;
+    }
+
+    if (m_dimension == 0) {
+        m_dimension = p_batch.cols();
+    }
+    else if (m_dimension != p_batch.cols()) {
+        throw std::invalid_argument("Dimension of the batch should be the same as dimension of the previous batches.");
+    }
+
+    if (is_initialized()) {
+        update_centers(p_batch);
+        return;
+    }
+
+    for (std::size_t i = 0; i < p_batch.rows(); i++) {
+        m_seed_points.insert(m_seed_points.end(), p_batch.row(i), p_batch.row(i) + m_dimension);
+    }
+
+    if (m_seed_points.size() / m_dimension >= std::max(m_amount_clusters, m_batch_size)) {
+        initialize_centers();
+    }
+}
+
+
+void minibatch_kmeans::partial_fit(const dataset & p_batch) {
+    std::vector<double> buffer;
+    partial_fit(pack_points(p_batch, buffer));
+}
+
+
+bool minibatch_kmeans::is_initialized() const {
+    return !m_centers.empty();
+}
+
+
+void minibatch_kmeans::predict(const points_view<double> & p_points, index_sequence & p_labels) const {
+    predict_view(p_points, p_labels);
+}
+
+
+void minibatch_kmeans::predict(const points_view<float> & p_points, index_sequence & p_labels) const {
+    predict_view(p_points, p_labels);
+}
+
+
+template <typename TypeValue>
+void minibatch_kmeans::predict_view(const points_view<TypeValue> & p_points, index_sequence & p_labels) const {
+    if (!is_initialized()) {
+        throw std::logic_error("Centers are not initialized, more points should be passed.");
+    }
+
+    std::vector<TypeValue> buffer;
+    const points_view<TypeValue> centers = centers_view(buffer);
+
+    p_labels.resize(p_points.rows());
+    parallel_for(std::size_t(0), p_points.rows(), [&p_points, &p_labels, &centers](const std::size_t p_index) {
+        p_labels[p_index] = find_closest_point(p_points.row(p_index), centers);
+    });
+}
+
+
+void minibatch_kmeans::assign(const points_view<double> & p_points, cluster_data & p_result) const {
+    assign_view(p_points, p_result);
+}
+
+
+void minibatch_kmeans::assign(const points_view<float> & p_points, cluster_data & p_result) const {
+    assign_view(p_points, p_result);
+}
+
+
+template <typename TypeValue>
+void minibatch_kmeans::assign_view(const points_view<TypeValue> & p_points, cluster_data & p_result) const {
+    if (!is_initialized()) {
+        throw std::logic_error("Centers are not initialized, more points should be passed.");
+    }
+
+    std::vector<TypeValue> buffer;
+    const points_view<TypeValue> centers = centers_view(buffer);
+
+    index_sequence labels(p_points.rows());
+    std::vector<double> errors(p_points.rows());
+    parallel_for(std::size_t(0), p_points.rows(), [&p_points, &labels, &errors, &centers](const std::size_t p_index) {
+        labels[p_index] = find_closest_point(p_points.row(p_index), centers, &errors[p_index]);
+    });
+
+    kmeans_data & result = (kmeans_data &) p_result;
+    result.clusters().assign(m_amount_clusters, cluster());
+    result.wce() = std::accumulate(errors.begin(), errors.end(), 0.0);
+
+    for (std::size_t index_point = 0; index_point < labels.size(); index_point++) {
+        result.clusters()[labels[index_point]].push_back(index_point);
+    }
+
+    /* clusters and centers are erased together, so they stay aligned */
+    dataset all_centers = get_centers();
+    result.centers().clear();
+
+    std::size_t position = 0;
+    for (std::size_t index_cluster = 0; index_cluster < m_amount_clusters; index_cluster++) {
+        if (!result.clusters()[index_cluster].empty()) {
+            result.clusters()[position++] = std::move(result.clusters()[index_cluster]);
+            result.centers().push_back(std::move(all_centers[index_cluster]));
+        }
+    }
+
+    result.clusters().resize(position);
+}
+
+
+dataset minibatch_kmeans::get_centers() const {
+    dataset centers;
+    for (std::size_t index_cluster = 0; index_cluster < m_centers.size() / std::max(m_dimension, std::size_t(1)); index_cluster++) {
+        centers.emplace_back(m_centers.begin() + index_cluster * m_dimension, m_centers.begin() + (index_cluster + 1) * m_dimension);
+    }
+
+    return centers;
+}
+
+
+void minibatch_kmeans::reset() {
+    m_dimension = 0;
+    m_centers.clear();
+    m_counts.clear();
+    m_seed_points.clear();
+}
+
+
+points_view<double> minibatch_kmeans::centers_view(std::vector<double> & p_buffer) const {
+    (void) p_buffer;
+    return points_view<double>(m_centers.data(), m_amount_clusters, m_dimension, m_dimension);
+}
+
+
+points_view<float> minibatch_kmeans::centers_view(std::vector<float> & p_buffer) const {
+    p_buffer.assign(m_centers.begin(), m_centers.end());
+    return points_view<float>(p_buffer.data(), m_amount_clusters, m_dimension, m_dimension);
+}
+
+
+void minibatch_kmeans::initialize_centers() {
+    const std::size_t amount = m_seed_points.size() / m_dimension;
+
+    dataset seed;
+    seed.reserve(amount);
+    for (std::size_t i = 0; i < amount; i++) {
+        seed.emplace_back(m_seed_points.begin() + i * m_dimension, m_seed_points.begin() + (i + 1) * m_dimension);
+    }
+
+    dataset initial_centers;
+    kmeans_plus_plus(m_amount_clusters).initialize(seed, initial_centers);
+
+    m_centers.resize(m_amount_clusters * m_dimension);
+    for (std::size_t index_cluster = 0; index_cluster < m_amount_clusters; index_cluster++) {
+        std::copy(initial_centers[index_cluster].begin(), initial_centers[index_cluster].end(), m_centers.begin() + index_cluster * m_dimension);
+    }
+
+    m_counts.assign(m_amount_clusters, 0);
+
+    /* collected points are the first batch */
+    std::vector<double> points;
+    points.swap(m_seed_points);
+    update_centers(points_view<double>(points.data(), amount, m_dimension, m_dimension));
+}
+
+
+void minibatch_kmeans::update_centers(const points_view<double> & p_batch) {
+    index_sequence labels;
+    predict(p_batch, labels);
+
+    /* centers are moved after the whole batch is assigned */
+    for (std::size_t index_point = 0; index_point < p_batch.rows(); index_point++) {
+        const std::size_t index_cluster = labels[index_point];
+        const double rate = 1.0 / (double) (++m_counts[index_cluster]);
+
+        double * center = m_centers.data() + index_cluster * m_dimension;
+        const double * point = p_batch.row(index_point);
+        for (std::size_t i = 0; i < m_dimension; i++) {
+            center[i] += rate * (point[i] - center[i]);
+        }
+    }
+}
+
+
+}
+
+}
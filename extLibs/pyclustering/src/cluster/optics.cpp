@@ -23,13 +23,20 @@
 #include <pyclustering/cluster/optics.hpp>
 #include <pyclustering/cluster/ordering_analyser.hpp>
 
+#include <pyclustering/parallel/parallel.hpp>
+
+#include <pyclustering/utils/metric_simd.hpp>
+
 #include <algorithm>
 #include <cmath>
 #include <limits>
-#include <map>
 #include <string>
 
 
+using namespace pyclustering::parallel;
+using namespace pyclustering::utils::metric;
+
+
 namespace pyclustering {
 
 namespace clst {
@@ -53,6 +60,14 @@ optics::optics(const double p_radius, const std::size_t p_neighbors, const std::
 }
 
 
+optics::optics(const double p_radius, const std::size_t p_neighbors, const std::size_t p_amount_clusters, const container::hnsw_parameters & p_index_parameters) :
+    optics(p_radius, p_neighbors, p_amount_clusters)
+{
+    m_approximate = true;
+    m_index_parameters = p_index_parameters;
+}
+
+
 void optics::process(const dataset & p_data, cluster_data & p_result) {
     process(p_data, optics_data_t::POINTS, p_result);
 }
@@ -60,9 +75,50 @@ void optics::process(const dataset & p_data, cluster_data & p_result) {
 
 void optics::process(const dataset & p_data, const optics_data_t p_type, cluster_data & p_result) {
     m_data_ptr    = &p_data;
-    m_result_ptr  = (optics_data *) &p_result;
+    m_points_ptr  = nullptr;
+    m_points_float_ptr = nullptr;
+    m_size        = p_data.size();
     m_type        = p_type;
 
+    process_input(p_result);
+}
+
+
+void optics::process(const points_view<double> & p_points, cluster_data & p_result) {
+    m_data_ptr    = nullptr;
+    m_points_ptr  = &p_points;
+    m_points_float_ptr = nullptr;
+    m_size        = p_points.rows();
+    m_type        = optics_data_t::POINTS;
+
+    process_input(p_result);
+}
+
+
+void optics::process(const points_view<float> & p_points, cluster_data & p_result) {
+    if (m_approximate) {
+        std::vector<double> buffer(p_points.rows() * p_points.cols());
+        for (std::size_t i = 0; i < p_points.rows(); i++) {
+            std::copy(p_points.row(i), p_points.row(i) + p_points.cols(), buffer.begin() + i * p_points.cols());
+        }
+
+        process(points_view<double>(buffer.data(), p_points.rows(), p_points.cols(), p_points.cols()), p_result);
+        return;
+    }
+
+    m_data_ptr    = nullptr;
+    m_points_ptr  = nullptr;
+    m_points_float_ptr = &p_points;
+    m_size        = p_points.rows();
+    m_type        = optics_data_t::POINTS;
+
+    process_input(p_result);
+}
+
+
+void optics::process_input(cluster_data & p_result) {
+    m_result_ptr  = (optics_data *) &p_result;
+
     calculate_cluster_result();
 
     if ( (m_amount_clusters > 0) && (m_amount_clusters != m_result_ptr->clusters().size()) ) {
@@ -76,7 +132,13 @@ void optics::process(const dataset & p_data, const optics_data_t p_type, cluster
 
     m_result_ptr->set_radius(m_radius);
 
+    m_neighborhoods = { };
+    m_kdtree        = container::flat_kdtree();
+    m_index         = container::hnsw_index();
+
     m_data_ptr    = nullptr;
+    m_points_ptr  = nullptr;
+    m_points_float_ptr = nullptr;
     m_result_ptr  = nullptr;
 }
 
@@ -90,14 +152,22 @@ void optics::calculate_cluster_result() {
 
 void optics::initialize() {
     if (m_type == optics_data_t::POINTS) {
-        create_kdtree();
+        /* index does not depend on the radius, so it is reused when radius is changed */
+        if (m_approximate) {
+            if (m_index.empty()) {
+                create_index();
+            }
+        }
+        else if (m_data_ptr != nullptr) {
+            create_kdtree();
+        }
     }
 
     m_optics_objects = &(m_result_ptr->optics_objects());
     if (m_optics_objects->empty()) {
-        m_optics_objects->reserve(m_data_ptr->size());
+        m_optics_objects->reserve(m_size);
 
-        for (std::size_t i = 0; i < m_data_ptr->size(); i++) {
+        for (std::size_t i = 0; i < m_size; i++) {
             m_optics_objects->emplace_back(i, optics::NONE_DISTANCE, optics::NONE_DISTANCE);
         }
     }
@@ -107,16 +177,78 @@ void optics::initialize() {
 
 
     m_ordered_database.clear();
+    m_ordered_database.reserve(m_size);
 
     m_result_ptr->clusters().clear();
     m_result_ptr->noise().clear();
+
+    calculate_neighborhoods();
+}
+
+
+void optics::calculate_neighborhoods() {
+    m_neighborhoods.assign(m_size, neighbors_collection());
+
+    parallel_for(std::size_t(0), m_size, [this](const std::size_t p_index) {
+        get_neighbors(p_index, m_neighborhoods[p_index]);
+    });
+
+    if (m_approximate) {
+        symmetrize_neighborhoods();
+    }
+
+    parallel_for(std::size_t(0), m_size, [this](const std::size_t p_index) {
+        neighbors_collection & neighbors = m_neighborhoods[p_index];
+
+        /* the same order of neighbors as in the sorted container that was used before */
+        std::stable_sort(neighbors.begin(), neighbors.end(), neighbor_descriptor_less());
+
+        optics_descriptor & optics_object = (*m_optics_objects)[p_index];
+        optics_object.m_core_distance = (neighbors.size() >= m_neighbors) ? get_core_distance(neighbors) : optics::NONE_DISTANCE;
+    });
+}
+
+
+void optics::symmetrize_neighborhoods() {
+    /* approximate search may miss the object in the neighborhood of its neighbor, such object would be
+       unreachable in the ordering, so every neighborhood is completed by the objects that found it */
+    std::vector<neighbors_collection> reverse(m_size);
+    for (std::size_t index = 0; index < m_size; index++) {
+        for (const auto & neighbor : m_neighborhoods[index]) {
+            reverse[neighbor.m_index].emplace_back(index, neighbor.m_reachability_distance);
+        }
+    }
+
+    parallel_for(std::size_t(0), m_size, [this, &reverse](const std::size_t p_index) {
+        /* objects of the neighborhood are marked by the stamp that is unique for every call on the thread,
+           so the marks of the previous neighborhoods do not have to be cleared */
+        thread_local std::vector<std::size_t> stamps;
+        thread_local std::size_t stamp = 0;
+        if (stamps.size() < m_size) {
+            stamps.resize(m_size, 0);
+        }
+        stamp++;
+
+        neighbors_collection & neighbors = m_neighborhoods[p_index];
+        for (const auto & neighbor : neighbors) {
+            stamps[neighbor.m_index] = stamp;
+        }
+
+        for (const auto & neighbor : reverse[p_index]) {
+            if (stamps[neighbor.m_index] != stamp) {
+                neighbors.push_back(neighbor);
+            }
+        }
+    });
 }
 
 
 void optics::allocate_clusters() {
+    container::indexed_heap order_seed(m_size);
+
     for (auto & optics_object : *m_optics_objects) {
         if (!optics_object.m_processed) {
-            expand_cluster_order(optics_object);
+            expand_cluster_order(optics_object, order_seed);
         }
     }
 
@@ -124,68 +256,45 @@ void optics::allocate_clusters() {
 }
 
 
-void optics::expand_cluster_order(optics_descriptor & p_object) {
+void optics::expand_cluster_order(optics_descriptor & p_object, container::indexed_heap & p_order_seed) {
     p_object.m_processed = true;
-
-    neighbors_collection neighbors;
-    get_neighbors(p_object.m_index, neighbors);
-
     m_ordered_database.push_back(&p_object);
 
-    if (neighbors.size() >= m_neighbors) {
-        p_object.m_core_distance = get_core_distance(neighbors);
-
-        std::multiset<optics_descriptor *, optics_pointer_descriptor_less> order_seed;
-        update_order_seed(p_object, neighbors, order_seed);
+    if (p_object.m_core_distance == optics::NONE_DISTANCE) {
+        return;
+    }
 
-        while(!order_seed.empty()) {
-            optics_descriptor * descriptor = *(order_seed.begin());
-            order_seed.erase(order_seed.begin());
+    update_order_seed(p_object, p_order_seed);
 
-            get_neighbors(descriptor->m_index, neighbors);
-            descriptor->m_processed = true;
+    while(!p_order_seed.empty()) {
+        optics_descriptor & descriptor = (*m_optics_objects)[p_order_seed.pop()];
 
-            m_ordered_database.push_back(descriptor);
+        descriptor.m_processed = true;
+        m_ordered_database.push_back(&descriptor);
 
-            if (neighbors.size() >= m_neighbors) {
-                descriptor->m_core_distance = get_core_distance(neighbors);
-                update_order_seed(*descriptor, neighbors, order_seed);
-            }
-            else {
-                descriptor->m_core_distance = optics::NONE_DISTANCE;
-            }
+        if (descriptor.m_core_distance != optics::NONE_DISTANCE) {
+            update_order_seed(descriptor, p_order_seed);
         }
     }
-    else {
-        p_object.m_core_distance = optics::NONE_DISTANCE;
-    }
 }
 
 
-void optics::update_order_seed(const optics_descriptor & p_object, const neighbors_collection & p_neighbors, std::multiset<optics_descriptor *, optics_pointer_descriptor_less> & order_seed) {
-    for (auto & descriptor : p_neighbors) {
+void optics::update_order_seed(const optics_descriptor & p_object, container::indexed_heap & p_order_seed) {
+    for (auto & descriptor : m_neighborhoods[p_object.m_index]) {
         std::size_t index_neighbor = descriptor.m_index;
         double current_reachability_distance = descriptor.m_reachability_distance;
 
-        optics_descriptor & optics_object = m_optics_objects->at(index_neighbor);
+        optics_descriptor & optics_object = (*m_optics_objects)[index_neighbor];
         if (!optics_object.m_processed) {
             double reachable_distance = std::max({ current_reachability_distance, p_object.m_core_distance });
 
             if (optics_object.m_reachability_distance == optics::NONE_DISTANCE) {
                 optics_object.m_reachability_distance = reachable_distance;
-                order_seed.insert(&optics_object);
+                p_order_seed.push(index_neighbor, reachable_distance);
             }
-            else {
-                if (reachable_distance < optics_object.m_reachability_distance) {
-                    optics_object.m_reachability_distance = reachable_distance;
-
-                    auto object_iterator = std::find_if(order_seed.begin(), order_seed.end(), [&optics_object](optics_descriptor * obj) {
-                        return obj->m_index == optics_object.m_index;
-                    });
-
-                    order_seed.erase(object_iterator);
-                    order_seed.insert(&optics_object);
-                }
+            else if (reachable_distance < optics_object.m_reachability_distance) {
+                optics_object.m_reachability_distance = reachable_distance;
+                p_order_seed.decrease(index_neighbor, reachable_distance);
             }
         }
     }
@@ -216,6 +325,21 @@ void optics::extract_clusters() {
 
 
 void optics::get_neighbors(const size_t p_index, neighbors_collection & p_neighbors) {
+    if (m_approximate && (m_type == optics_data_t::POINTS)) {
+        get_neighbors_from_index(p_index, p_neighbors);
+        return;
+    }
+
+    if (m_points_ptr != nullptr) {
+        get_neighbors_from_view(*m_points_ptr, p_index, p_neighbors);
+        return;
+    }
+
+    if (m_points_float_ptr != nullptr) {
+        get_neighbors_from_view(*m_points_float_ptr, p_index, p_neighbors);
+        return;
+    }
+
     switch(m_type) {
     case optics_data_t::POINTS:
         get_neighbors_from_points(p_index, p_neighbors);
@@ -234,15 +358,11 @@ void optics::get_neighbors(const size_t p_index, neighbors_collection & p_neighb
 void optics::get_neighbors_from_points(const std::size_t p_index, neighbors_collection & p_neighbors) {
     p_neighbors.clear();
 
-    container::kdtree_searcher searcher((*m_data_ptr)[p_index], m_kdtree.get_root(), m_radius);
-
-    container::kdtree_searcher::rule_store rule = [&p_index, &p_neighbors](const container::kdnode::ptr & p_node, const double p_distance) {
-            if (p_index != (std::size_t) p_node->get_payload()) {
-                p_neighbors.emplace((std::size_t) p_node->get_payload(), std::sqrt(p_distance));
+    m_kdtree.radius_search((*m_data_ptr)[p_index].data(), m_radius, [p_index, &p_neighbors](const std::size_t p_index_neighbor, const double p_distance) {
+            if (p_index != p_index_neighbor) {
+                p_neighbors.emplace_back(p_index_neighbor, std::sqrt(p_distance));
             }
-        };
-
-    searcher.find_nearest(rule);
+        });
 }
 
 
@@ -253,19 +373,66 @@ void optics::get_neighbors_from_distance_matrix(const std::size_t p_index, neigh
     for (std::size_t index_neighbor = 0; index_neighbor < distances.size(); index_neighbor++) {
         const double candidate_distance = distances[index_neighbor];
         if ( (candidate_distance <= m_radius) && (index_neighbor != p_index) ) {
-            p_neighbors.emplace(index_neighbor, candidate_distance);
+            p_neighbors.emplace_back(index_neighbor, candidate_distance);
+        }
+    }
+}
+
+
+template <typename TypeValue>
+void optics::get_neighbors_from_view(const points_view<TypeValue> & p_points, const std::size_t p_index, neighbors_collection & p_neighbors) {
+    p_neighbors.clear();
+
+    const simd::kernel_set<TypeValue> & kernels = simd::get_kernels<TypeValue>();
+
+    const TypeValue * point = p_points.row(p_index);
+    const double radius_square = m_radius * m_radius;
+
+    std::size_t index = 0;
+    for (; index + simd::DOT_PRODUCT_BLOCK_SIZE <= p_points.rows(); index += simd::DOT_PRODUCT_BLOCK_SIZE) {
+        const TypeValue * others[simd::DOT_PRODUCT_BLOCK_SIZE] = { p_points.row(index), p_points.row(index + 1), p_points.row(index + 2), p_points.row(index + 3) };
+
+        double distances[simd::DOT_PRODUCT_BLOCK_SIZE];
+        kernels.euclidean_distance_square_block(point, others, p_points.cols(), distances);
+
+        for (std::size_t k = 0; k < simd::DOT_PRODUCT_BLOCK_SIZE; k++) {
+            if ( (distances[k] <= radius_square) && (index + k != p_index) ) {
+                p_neighbors.emplace_back(index + k, std::sqrt(distances[k]));
+            }
+        }
+    }
+
+    for (; index < p_points.rows(); index++) {
+        const double distance = kernels.euclidean_distance_square(point, p_points.row(index), p_points.cols());
+        if ( (distance <= radius_square) && (index != p_index) ) {
+            p_neighbors.emplace_back(index, std::sqrt(distance));
+        }
+    }
+}
+
+
+void optics::get_neighbors_from_index(const std::size_t p_index, neighbors_collection & p_neighbors) {
+    p_neighbors.clear();
+
+    const double * point = (m_points_ptr != nullptr) ? m_points_ptr->row(p_index) : (*m_data_ptr)[p_index].data();
+
+    thread_local container::hnsw_index::neighbor_sequence neighbors;
+    m_index.radius_search(point, m_radius, neighbors);
+
+    for (const auto & neighbor : neighbors) {
+        if (neighbor.m_index != p_index) {
+            p_neighbors.emplace_back(neighbor.m_index, std::sqrt(neighbor.m_distance));
         }
     }
 }
 
 
 double optics::get_core_distance(const neighbors_collection & p_neighbors) const {
-    auto iter = p_neighbors.cbegin();
-    for (std::size_t index = 0; index < (m_neighbors - 1); ++index) {
-        ++iter;
+    if (m_neighbors == 0) {
+        return 0.0;
     }
 
-    return iter->m_reachability_distance;
+    return p_neighbors[m_neighbors - 1].m_reachability_distance;
 }
 
 
@@ -287,10 +454,16 @@ void optics::calculate_ordering() {
 
 
 void optics::create_kdtree() {
-    m_kdtree = container::kdtree();
+    m_kdtree = container::flat_kdtree(*m_data_ptr);
+}
 
-    for (std::size_t index = 0; index < m_data_ptr->size(); index++) {
-        m_kdtree.insert((*m_data_ptr)[index], (void *) index);
+
+void optics::create_index() {
+    if (m_points_ptr != nullptr) {
+        m_index = container::hnsw_index(*m_points_ptr, m_index_parameters);
+    }
+    else {
+        m_index = container::hnsw_index(*m_data_ptr, m_index_parameters);
     }
 }
 
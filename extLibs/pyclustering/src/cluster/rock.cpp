@@ -22,13 +22,22 @@
 
 #include <pyclustering/cluster/rock.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <climits>
 #include <iostream>
+#include <mutex>
+
+#include <pyclustering/container/adjacency_bit_matrix.hpp>
+#include <pyclustering/container/adjacency_factory.hpp>
+
+#include <pyclustering/parallel/parallel.hpp>
 
 #include <pyclustering/utils/metric.hpp>
+#include <pyclustering/utils/distance_matrix.hpp>
 
 
+using namespace pyclustering::parallel;
 using namespace pyclustering::utils::metric;
 using namespace pyclustering::container;
 
@@ -38,8 +47,22 @@ namespace pyclustering {
 namespace clst {
 
 
+bool rock::rock_merge_candidate::operator<(const rock_merge_candidate & p_other) const {
+    if (m_goodness != p_other.m_goodness) {
+        return m_goodness < p_other.m_goodness;
+    }
+
+    /* the first pair in the order of clusters wins ties, as in the exhaustive search */
+    if (m_cluster1 != p_other.m_cluster1) {
+        return m_cluster1 > p_other.m_cluster1;
+    }
+
+    return m_cluster2 > p_other.m_cluster2;
+}
+
+
 rock::rock() :
-    m_adjacency_matrix(adjacency_matrix()),
+    m_adjacency(nullptr),
     m_radius(0.0),
     m_degree_normalization(0.0),
     m_number_clusters(0)
@@ -47,7 +70,7 @@ rock::rock() :
 
 
 rock::rock(const double radius, const std::size_t number_clusters, const double threshold) :
-    m_adjacency_matrix(adjacency_matrix()),
+    m_adjacency(nullptr),
     m_radius(radius * radius),
     m_degree_normalization(1.0 + 2.0 * ( (1.0 - threshold) / (1.0 + threshold) )),
     m_number_clusters(number_clusters)
@@ -55,91 +78,258 @@ rock::rock(const double radius, const std::size_t number_clusters, const double
 
 
 void rock::process(const dataset & p_data, cluster_data & p_result) {
-    create_adjacency_matrix(p_data);
+    create_adjacency_collection(p_data);
+    calculate_links();
+
+    m_adjacency = nullptr;  /* links contain everything that is needed - clear to save memory */
 
     /* initialize first version of clusters */
+    m_clusters.clear();
     for (size_t index = 0; index < p_data.size(); index++) {
         m_clusters.push_back(cluster(1, index));
     }
 
-    while( (m_number_clusters < m_clusters.size()) && (merge_cluster()) ) { }
+    m_versions.assign(p_data.size(), 0);
+
+    m_queue = rock_merge_queue();
+    for (std::size_t index_cluster = 0; index_cluster < m_links.size(); index_cluster++) {
+        for (const auto & link : m_links[index_cluster]) {
+            if (index_cluster < link.first) {
+                push_candidate(index_cluster, link.first, link.second);
+            }
+        }
+    }
+
+    std::size_t number_clusters = m_clusters.size();
+    while( (m_number_clusters < number_clusters) && (merge_cluster()) ) {
+        number_clusters--;
+    }
 
-    /* copy results to the output result (it much more optimal to store in list representation for ROCK algorithm) */
+    /* copy results to the output result, merged clusters are empty */
     p_result = rock_data();
-    p_result.clusters().insert(p_result.clusters().begin(), m_clusters.begin(), m_clusters.end());
+    for (auto & allocated_cluster : m_clusters) {
+        if (!allocated_cluster.empty()) {
+            p_result.clusters().push_back(std::move(allocated_cluster));
+        }
+    }
 
-    m_clusters.clear();         /* no need it anymore - clear to save memory */
-    m_adjacency_matrix.clear(); /* no need it anymore - clear to save memory */
+    /* no need it anymore - clear to save memory */
+    m_clusters.clear();
+    m_links.clear();
+    m_versions.clear();
+    m_queue = rock_merge_queue();
 }
 
 
-void rock::create_adjacency_matrix(const dataset & p_data) {
-    m_adjacency_matrix = adjacency_matrix(p_data.size());
-    for (size_t i = 0; i < m_adjacency_matrix.size(); i++) {
-        for (size_t j = i + 1; j < m_adjacency_matrix.size(); j++) {
-            double distance = euclidean_distance_square(p_data[i], p_data[j]);
+void rock::create_adjacency_collection(const dataset & p_data) {
+    std::vector<double> points_buffer;
+    const points_view<double> points = pack_points(p_data, points_buffer);
+
+    const adjacency_unweight_t storing_type = adjacency_unweight_factory::select_storing_type(p_data.size(), estimate_connections(points));
+    m_adjacency = adjacency_unweight_factory::create_collection(p_data.size(), storing_type);
+
+    /* tiles are processed concurrently and may touch the same rows, connections are collected and then stored under the lock */
+    std::mutex adjacency_mutex;
+    for_each_distance_tile(points, distance_type::EUCLIDEAN_SQUARE, [this, &adjacency_mutex](const distance_tile & p_tile) {
+        thread_local std::vector<std::pair<std::size_t, std::size_t>> connections;
+        connections.clear();
 
-            if (distance < m_radius) {
-                m_adjacency_matrix.set_connection(i, j);
-                m_adjacency_matrix.set_connection(j, i);
+        for (size_t i = p_tile.m_row_begin; i < p_tile.m_row_end; i++) {
+            for (size_t j = p_tile.first_column(i); j < p_tile.m_col_end; j++) {
+                if (p_tile(i, j) < m_radius) {
+                    connections.emplace_back(i, j);
+                }
             }
         }
+
+        std::lock_guard<std::mutex> lock(adjacency_mutex);
+        for (const auto & connection : connections) {
+            m_adjacency->set_connection(connection.first, connection.second);
+            m_adjacency->set_connection(connection.second, connection.first);
+        }
+    });
+}
+
+
+std::size_t rock::estimate_connections(const points_view<double> & p_points) const {
+    static const std::size_t SAMPLE_SIZE = 256;
+
+    const std::size_t size = p_points.rows();
+    const std::size_t sample_size = std::min(SAMPLE_SIZE, size);
+    if (sample_size == 0) {
+        return 0;
     }
+
+    /* evenly spaced points are used as a sample, every of them is compared with all points */
+    std::vector<std::size_t> sample_connections(sample_size, 0);
+    parallel_for(std::size_t(0), sample_size, [this, size, sample_size, &p_points, &sample_connections](const std::size_t p_index) {
+        const std::size_t index_point = p_index * size / sample_size;
+        for (std::size_t j = 0; j < size; j++) {
+            if ((j != index_point) && (simd::euclidean_distance_square(p_points.row(index_point), p_points.row(j), p_points.cols()) < m_radius)) {
+                sample_connections[p_index]++;
+            }
+        }
+    });
+
+    std::size_t total_connections = 0;
+    for (const auto amount : sample_connections) {
+        total_connections += amount;
+    }
+
+    return total_connections * size / sample_size;
 }
 
 
-bool rock::merge_cluster() {
-    auto cluster1 = m_clusters.end();
-    auto cluster2 = m_clusters.end();
+void rock::calculate_links() {
+    const std::size_t size = m_adjacency->size();
 
-    double maximum_goodness = 0;
+    std::vector<std::vector<std::size_t>> neighbors(size);
+    parallel_for(std::size_t(0), size, [this, &neighbors](const std::size_t p_index) {
+        m_adjacency->get_neighbors(p_index, neighbors[p_index]);
+        neighbors[p_index].push_back(p_index);
+    });
 
-    for (auto i = m_clusters.begin(); i != m_clusters.end(); ++i) {
-        auto next = i;
-        for (auto j = ++next; j != m_clusters.end(); ++j) {
-            double goodness = calculate_goodness(*i, *j);
-            if (goodness > maximum_goodness) {
-                maximum_goodness = goodness;
+    /* sparse product visits every pair of neighbors of every point, bit matrix product visits every element of every pair of rows */
+    double sparse_cost = 0.0;
+    for (const auto & point_neighbors : neighbors) {
+        sparse_cost += (double) point_neighbors.size() * (double) point_neighbors.size();
+    }
 
-                cluster1 = i;
-                cluster2 = j;
+    const double bit_matrix_cost = (double) size * (double) size * (double) size / 128.0;
+
+    std::vector<std::vector<std::pair<std::size_t, std::size_t>>> links(size);
+
+    const adjacency_bit_matrix * bit_matrix = dynamic_cast<const adjacency_bit_matrix *>(m_adjacency.get());
+    if ( (bit_matrix != nullptr) && (bit_matrix_cost < sparse_cost) ) {
+        /* only upper triangle is counted, every point is a neighbor of itself so connected points share two more neighbors */
+        parallel_for(std::size_t(0), size, [size, bit_matrix, &links](const std::size_t p_index) {
+            for (std::size_t j = p_index + 1; j < size; j++) {
+                const std::size_t number_links = bit_matrix->count_common_neighbors(p_index, j) +
+                    (bit_matrix->has_connection(p_index, j) ? 2 : 0);
+
+                if (number_links > 0) {
+                    links[p_index].emplace_back(j, number_links);
+                }
+            }
+        });
+
+        m_links.assign(size, rock_link_map());
+        for (std::size_t index = 0; index < size; index++) {
+            for (const auto & link : links[index]) {
+                m_links[index].insert(link);
+                m_links[link.first].emplace(index, link.second);
             }
+
+            links[index] = { };
         }
-    }
 
-    if (cluster1 == cluster2) {
-        return false;   /* clusters are totally separated (no links between them), it's impossible to made a desicion which of them should be merged */
+        return;
     }
 
-    (*cluster1).insert((*cluster1).end(), (*cluster2).begin(), (*cluster2).end());
-    m_clusters.erase(cluster2);
+    /* row of the product is accumulated in the dense counter, only touched elements are visited */
+    parallel_for(std::size_t(0), size, [size, &neighbors, &links](const std::size_t p_index) {
+        thread_local std::vector<std::size_t> counters;
+        thread_local std::vector<std::size_t> touched;
+        if (counters.size() < size) {
+            counters.assign(size, 0);
+        }
 
-    return true;
+        for (const auto index_neighbor : neighbors[p_index]) {
+            for (const auto index_linked : neighbors[index_neighbor]) {
+                if ((index_linked != p_index) && (counters[index_linked]++ == 0)) {
+                    touched.push_back(index_linked);
+                }
+            }
+        }
+
+        links[p_index].reserve(touched.size());
+        for (const auto index_linked : touched) {
+            links[p_index].emplace_back(index_linked, counters[index_linked]);
+            counters[index_linked] = 0;
+        }
+
+        touched.clear();
+    });
+
+    m_links.assign(size, rock_link_map());
+    for (std::size_t index = 0; index < size; index++) {
+        m_links[index].insert(links[index].begin(), links[index].end());
+        links[index] = { };
+    }
 }
 
-size_t rock::calculate_links(const cluster & cluster1, const cluster & cluster2) const {
-    size_t number_links = 0;
-    for (auto i : cluster1) {
-        for (auto j : cluster2) {
-            number_links += (size_t) m_adjacency_matrix.has_connection(i, j);
+
+bool rock::merge_cluster() {
+    /* outdated candidates are dropped lazily when they reach the top of the queue */
+    while (!m_queue.empty()) {
+        const rock_merge_candidate candidate = m_queue.top();
+        m_queue.pop();
+
+        if ( (candidate.m_version1 != m_versions[candidate.m_cluster1]) || (candidate.m_version2 != m_versions[candidate.m_cluster2]) ) {
+            continue;
+        }
+
+        const std::size_t cluster1 = candidate.m_cluster1;
+        const std::size_t cluster2 = candidate.m_cluster2;
+
+        m_clusters[cluster1].insert(m_clusters[cluster1].end(), m_clusters[cluster2].begin(), m_clusters[cluster2].end());
+        m_clusters[cluster2] = cluster();
+
+        /* links of the merged cluster are the sum of links of both clusters */
+        rock_link_map merged_links = std::move(m_links[cluster1]);
+        merged_links.erase(cluster2);
+        for (const auto & link : m_links[cluster2]) {
+            if (link.first != cluster1) {
+                merged_links[link.first] += link.second;
+            }
+        }
+
+        m_links[cluster2] = rock_link_map();
+        m_links[cluster1] = std::move(merged_links);
+
+        /* both clusters are changed, so all candidates that contain them are outdated */
+        m_versions[cluster1]++;
+        m_versions[cluster2]++;
+
+        for (const auto & link : m_links[cluster1]) {
+            rock_link_map & neighbor_links = m_links[link.first];
+            neighbor_links.erase(cluster2);
+            neighbor_links[cluster1] = link.second;
+
+            push_candidate(cluster1, link.first, link.second);
         }
+
+        return true;
     }
 
-    return number_links;
+    return false;   /* clusters are totally separated (no links between them), it's impossible to made a desicion which of them should be merged */
 }
 
-double rock::calculate_goodness(const cluster & cluster1, const cluster & cluster2) const {
-    const double number_links = (double) calculate_links(cluster1, cluster2);
 
-    const double size_cluster1 = (double) cluster1.size();
-    const double size_cluster2 = (double) cluster2.size();
+void rock::push_candidate(const std::size_t cluster1, const std::size_t cluster2, const std::size_t number_links) {
+    rock_merge_candidate candidate;
+    candidate.m_cluster1 = std::min(cluster1, cluster2);
+    candidate.m_cluster2 = std::max(cluster1, cluster2);
+    candidate.m_version1 = m_versions[candidate.m_cluster1];
+    candidate.m_version2 = m_versions[candidate.m_cluster2];
+    candidate.m_goodness = calculate_goodness(number_links, m_clusters[cluster1].size(), m_clusters[cluster2].size());
 
-    return number_links / ( std::pow( size_cluster1 + size_cluster2, m_degree_normalization ) -
-        std::pow( size_cluster1, m_degree_normalization ) -
-        std::pow( size_cluster2, m_degree_normalization ) );
+    if (candidate.m_goodness > 0.0) {
+        m_queue.push(candidate);
+    }
 }
 
 
+double rock::calculate_goodness(const std::size_t number_links, const std::size_t size_cluster1, const std::size_t size_cluster2) const {
+    const double size1 = (double) size_cluster1;
+    const double size2 = (double) size_cluster2;
+
+    return (double) number_links / ( std::pow( size1 + size2, m_degree_normalization ) -
+        std::pow( size1, m_degree_normalization ) -
+        std::pow( size2, m_degree_normalization ) );
 }
 
+
 }
+
+}
\ No newline at end of file
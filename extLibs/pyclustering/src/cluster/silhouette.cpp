@@ -20,8 +20,22 @@
 *
 */
 
+
 #include <pyclustering/cluster/silhouette.hpp>
 
+#include <pyclustering/parallel/parallel.hpp>
+
+#include <pyclustering/utils/metric_simd.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+
+
+using namespace pyclustering::parallel;
+
 
 namespace pyclustering {
 
@@ -33,6 +47,12 @@ silhouette::silhouette(const distance_metric<point> & p_metric) :
 { }
 
 
+silhouette::silhouette(const distance_metric<point> & p_metric, const std::size_t p_sample_size) :
+    m_metric(p_metric),
+    m_sample_size(p_sample_size)
+{ }
+
+
 void silhouette::process(const dataset & p_data, const cluster_sequence & p_clusters, silhouette_data & p_result) {
     process(p_data, p_clusters, silhouette_data_t::POINTS, p_result);
 }
@@ -44,77 +64,213 @@ void silhouette::process(const dataset & p_data, const cluster_sequence & p_clus
     m_result    = &p_result;
     m_type      = p_type;
 
-    m_result->get_score().reserve(m_data->size());
+    object_sequence objects;
+    select_objects(objects);
 
-    for (std::size_t index_cluster = 0; index_cluster < m_clusters->size(); index_cluster++) {
-        const auto & current_cluster = m_clusters->at(index_cluster);
+    auto & scores = m_result->get_score();
+    scores.resize(objects.size());
+
+    parallel_for(std::size_t(0), objects.size(), [this, &objects, &scores](const std::size_t p_index) {
+        scores[p_index] = calculate_score(objects[p_index].first, objects[p_index].second);
+    });
+
+    std::size_t population = 0;
+    for (const auto & current_cluster : p_clusters) {
+        population += current_cluster.size();
+    }
+
+    calculate_confidence_interval(population);
+
+    m_data      = nullptr;
+    m_clusters  = nullptr;
+    m_result    = nullptr;
+}
+
+
+void silhouette::process(const points_view<double> & p_points, const cluster_sequence & p_clusters, silhouette_data & p_result) {
+    m_clusters  = &p_clusters;
+    m_result    = &p_result;
+
+    const simd::kernel_set<double> & kernels = simd::get_kernels<double>();
+    const std::size_t dimension = p_points.cols();
+
+    /* sum of square distances from x to the cluster is |C| * |x - c|^2 + sum of |y - c|^2, where c is the cluster center */
+    std::vector<double> centers(p_clusters.size() * dimension, 0.0);
+    std::vector<double> scatters(p_clusters.size(), 0.0);
+
+    parallel_for(std::size_t(0), p_clusters.size(), [&](const std::size_t p_index_cluster) {
+        const auto & current_cluster = p_clusters[p_index_cluster];
+        if (current_cluster.empty()) {
+            return;
+        }
+
+        double * center = centers.data() + p_index_cluster * dimension;
         for (const auto index_point : current_cluster) {
-            m_result->get_score().push_back(calculate_score(index_point, index_cluster));
+            const double * point = p_points.row(index_point);
+            for (std::size_t i = 0; i < dimension; i++) {
+                center[i] += point[i];
+            }
         }
+
+        for (std::size_t i = 0; i < dimension; i++) {
+            center[i] /= (double) current_cluster.size();
+        }
+
+        for (const auto index_point : current_cluster) {
+            scatters[p_index_cluster] += kernels.euclidean_distance_square(p_points.row(index_point), center, dimension);
+        }
+    });
+
+    object_sequence objects;
+    select_objects(objects);
+
+    auto & scores = m_result->get_score();
+    scores.resize(objects.size());
+
+    parallel_for(std::size_t(0), objects.size(), [&](const std::size_t p_index) {
+        const double * point = p_points.row(objects[p_index].first);
+
+        std::vector<double> cluster_difference(p_clusters.size());
+        for (std::size_t index_cluster = 0; index_cluster < p_clusters.size(); index_cluster++) {
+            const double * center = centers.data() + index_cluster * dimension;
+            cluster_difference[index_cluster] = p_clusters[index_cluster].size() * kernels.euclidean_distance_square(point, center, dimension) + scatters[index_cluster];
+        }
+
+        scores[p_index] = calculate_score(objects[p_index].second, cluster_difference);
+    });
+
+    std::size_t population = 0;
+    for (const auto & current_cluster : p_clusters) {
+        population += current_cluster.size();
     }
+
+    calculate_confidence_interval(population);
+
+    m_clusters  = nullptr;
+    m_result    = nullptr;
 }
 
 
-double silhouette::calculate_score(const std::size_t p_index_point, const std::size_t p_index_cluster) const {
-    std::vector<double> dataset_difference;
-    calculate_dataset_difference(p_index_point, dataset_difference);
+void silhouette::select_objects(object_sequence & p_objects) const {
+    for (std::size_t index_cluster = 0; index_cluster < m_clusters->size(); index_cluster++) {
+        for (const auto index_point : m_clusters->at(index_cluster)) {
+            p_objects.emplace_back(index_point, index_cluster);
+        }
+    }
 
-    const double a_score = calculate_within_cluster_score(p_index_cluster, dataset_difference);
-    const double b_score = caclulate_optimal_neighbor_cluster_score(p_index_cluster, dataset_difference);
+    if ( (m_sample_size == 0) || (m_sample_size >= p_objects.size()) ) {
+        return;
+    }
 
-    return (b_score - a_score) / std::max(a_score, b_score);
+    /* partial Fisher-Yates shuffle, sampled objects are kept in order of the clusters */
+    std::mt19937 generator(std::random_device{ }());
+    std::vector<std::size_t> positions(p_objects.size());
+    std::iota(positions.begin(), positions.end(), 0);
+
+    for (std::size_t i = 0; i < m_sample_size; i++) {
+        std::uniform_int_distribution<std::size_t> distribution(i, positions.size() - 1);
+        std::swap(positions[i], positions[distribution(generator)]);
+    }
+
+    positions.resize(m_sample_size);
+    std::sort(positions.begin(), positions.end());
+
+    object_sequence sample;
+    sample.reserve(m_sample_size);
+    for (const auto position : positions) {
+        sample.push_back(p_objects[position]);
+    }
+
+    p_objects = std::move(sample);
 }
 
 
-void silhouette::calculate_dataset_difference(const std::size_t p_index_point, std::vector<double> & p_dataset_difference) const {
-    if (m_type == silhouette_data_t::DISTANCE_MATRIX) {
-        p_dataset_difference = m_data->at(p_index_point);
+void silhouette::calculate_confidence_interval(const std::size_t p_population) const {
+    const auto & scores = m_result->get_score();
+    const std::size_t size = scores.size();
+
+    if ( (size >= p_population) || (size < 2) ) {
+        m_result->set_confidence_interval(0.0);
         return;
     }
 
-    p_dataset_difference.reserve(m_data->size());
+    double mean = 0.0;
+    for (const auto score : scores) {
+        mean += score;
+    }
+    mean /= (double) size;
 
-    const auto & current_point = m_data->at(p_index_point);
-    for (const auto & point : *m_data) {
-        p_dataset_difference.push_back(m_metric(current_point, point));
+    double variance = 0.0;
+    for (const auto score : scores) {
+        variance += (score - mean) * (score - mean);
     }
+    variance /= (double) (size - 1);
+
+    /* normal approximation with correction for sampling without replacement */
+    const double correction = (double) (p_population - size) / (double) (p_population - 1);
+    m_result->set_confidence_interval(1.96 * std::sqrt(variance / (double) size * correction));
 }
 
 
-double silhouette::calculate_cluster_difference(const std::size_t p_index_cluster, const std::vector<double> & p_dataset_difference) const {
-    double cluster_difference = 0.0;
+double silhouette::calculate_score(const std::size_t p_index_point, const std::size_t p_index_cluster) const {
+    std::vector<double> cluster_difference;
+    calculate_cluster_difference(p_index_point, cluster_difference);
 
-    const auto & current_cluster = m_clusters->at(p_index_cluster);
-    for (const auto index_point : current_cluster) {
-        cluster_difference += p_dataset_difference[index_point];
-    }
+    return calculate_score(p_index_cluster, cluster_difference);
+}
+
+
+double silhouette::calculate_score(const std::size_t p_index_cluster, const std::vector<double> & p_cluster_difference) const {
+    const double a_score = calculate_within_cluster_score(p_index_cluster, p_cluster_difference);
+    const double b_score = caclulate_optimal_neighbor_cluster_score(p_index_cluster, p_cluster_difference);
+
+    return (b_score - a_score) / std::max(a_score, b_score);
+}
+
+
+void silhouette::calculate_cluster_difference(const std::size_t p_index_point, std::vector<double> & p_cluster_difference) const {
+    p_cluster_difference.assign(m_clusters->size(), 0.0);
 
-    return cluster_difference;
+    const auto & current_point = m_data->at(p_index_point);
+    for (std::size_t index_cluster = 0; index_cluster < m_clusters->size(); index_cluster++) {
+        double difference = 0.0;
+
+        if (m_type == silhouette_data_t::DISTANCE_MATRIX) {
+            for (const auto index_neighbor : m_clusters->at(index_cluster)) {
+                difference += current_point[index_neighbor];
+            }
+        }
+        else {
+            for (const auto index_neighbor : m_clusters->at(index_cluster)) {
+                difference += m_metric(current_point, m_data->at(index_neighbor));
+            }
+        }
+
+        p_cluster_difference[index_cluster] = difference;
+    }
 }
 
 
-double silhouette::calculate_within_cluster_score(const std::size_t p_index_cluster, const std::vector<double> & p_dataset_difference) const {
-    double score = calculate_cluster_difference(p_index_cluster, p_dataset_difference);
+double silhouette::calculate_within_cluster_score(const std::size_t p_index_cluster, const std::vector<double> & p_cluster_difference) const {
     const std::size_t cluster_size = m_clusters->at(p_index_cluster).size();
     if (cluster_size == 1) {
         return std::nan("1");
     }
 
-    return score / (cluster_size - 1);
+    return p_cluster_difference[p_index_cluster] / (cluster_size - 1);
 }
 
 
-double silhouette::calculate_cluster_score(const std::size_t p_index_cluster, const std::vector<double> & p_dataset_difference) const {
-    const double score = calculate_cluster_difference(p_index_cluster, p_dataset_difference);
-    return score / m_clusters->at(p_index_cluster).size();
+double silhouette::calculate_cluster_score(const std::size_t p_index_cluster, const std::vector<double> & p_cluster_difference) const {
+    return p_cluster_difference[p_index_cluster] / m_clusters->at(p_index_cluster).size();
 }
 
 
-double silhouette::caclulate_optimal_neighbor_cluster_score(const std::size_t p_index_cluster, const std::vector<double> & p_dataset_difference) const {
+double silhouette::caclulate_optimal_neighbor_cluster_score(const std::size_t p_index_cluster, const std::vector<double> & p_cluster_difference) const {
     double optimal_score = std::numeric_limits<double>::infinity();
     for (std::size_t index_neighbor_cluster = 0; index_neighbor_cluster < m_clusters->size(); index_neighbor_cluster++) {
         if (p_index_cluster != index_neighbor_cluster) {
-            const double candidate_score = calculate_cluster_score(index_neighbor_cluster, p_dataset_difference);
+            const double candidate_score = calculate_cluster_score(index_neighbor_cluster, p_cluster_difference);
             if (candidate_score < optimal_score) {
                 optimal_score = candidate_score;
             }
@@ -28,20 +28,75 @@
 #include <pyclustering/cluster/kmedians.hpp>
 #include <pyclustering/cluster/kmedoids.hpp>
 
+#include <pyclustering/parallel/parallel.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <mutex>
 #include <numeric>
 
 
+using namespace pyclustering::parallel;
+
+
 namespace pyclustering {
 
 namespace clst {
 
 
+namespace {
+
+/* amount of points per cluster in the sample that is used to seed K-Means */
+constexpr std::size_t SEEDING_SAMPLE_FACTOR = 16;
+
+}
+
+
+void silhouette_ksearch_allocator::allocate(const std::size_t p_amount, const dataset & p_data, const points_view<double> & p_points, cluster_sequence & p_clusters) {
+    (void) p_points;
+    allocate(p_amount, p_data, p_clusters);
+}
+
+
+void silhouette_ksearch_allocator::allocate(const std::size_t p_amount, const points_view<double> & p_points, cluster_sequence & p_clusters) {
+    dataset data(p_points.rows());
+    for (std::size_t i = 0; i < p_points.rows(); i++) {
+        data[i].assign(p_points.row(i), p_points.row(i) + p_points.cols());
+    }
+
+    allocate(p_amount, data, p_clusters);
+}
+
+
 void kmeans_allocator::allocate(const std::size_t p_amount, const dataset & p_data, cluster_sequence & p_clusters) {
+    std::vector<double> buffer;
+    allocate(p_amount, pack_points(p_data, buffer), p_clusters);
+}
+
+
+void kmeans_allocator::allocate(const std::size_t p_amount, const dataset & p_data, const points_view<double> & p_points, cluster_sequence & p_clusters) {
+    (void) p_data;
+    allocate(p_amount, p_points, p_clusters);
+}
+
+
+void kmeans_allocator::allocate(const std::size_t p_amount, const points_view<double> & p_points, cluster_sequence & p_clusters) {
+    /* seeding cost does not depend on the size of the data, the search seeds every amount of clusters */
+    const std::size_t sample_size = std::min(p_points.rows(), p_amount * SEEDING_SAMPLE_FACTOR);
+
+    dataset sample(sample_size);
+    for (std::size_t i = 0; i < sample_size; i++) {
+        const double * row = p_points.row(i * p_points.rows() / sample_size);
+        sample[i].assign(row, row + p_points.cols());
+    }
+
     dataset initial_centers;
-    kmeans_plus_plus(p_amount).initialize(p_data, initial_centers);
+    kmeans_plus_plus(p_amount).initialize(sample, initial_centers);
 
     kmeans_data result;
-    kmeans(initial_centers).process(p_data, result);
+    kmeans(initial_centers, kmeans::DEFAULT_TOLERANCE, kmeans::DEFAULT_ITERMAX,
+        distance_metric_factory<point>::euclidean_square(), kmeans_assignment::AUTOMATIC).process(p_points, result);
 
     p_clusters = std::move(result.clusters());
 }
@@ -70,10 +125,11 @@ void kmedoids_allocator::allocate(const std::size_t p_amount, const dataset & p_
 
 
 
-silhouette_ksearch::silhouette_ksearch(const std::size_t p_kmin, const std::size_t p_kmax, const silhouette_ksearch_allocator::ptr & p_allocator) :
+silhouette_ksearch::silhouette_ksearch(const std::size_t p_kmin, const std::size_t p_kmax, const silhouette_ksearch_allocator::ptr & p_allocator, const double p_time_budget) :
     m_kmin(p_kmin),
     m_kmax(p_kmax),
-    m_allocator(p_allocator)
+    m_allocator(p_allocator),
+    m_time_budget(p_time_budget)
 {
     if (m_kmin <= 1) {
         throw std::invalid_argument("K min value '" + std::to_string(m_kmin) + 
@@ -83,37 +139,68 @@ silhouette_ksearch::silhouette_ksearch(const std::size_t p_kmin, const std::size
 
 
 void silhouette_ksearch::process(const dataset & p_data, silhouette_ksearch_data & p_result) {
-    if (m_kmax > p_data.size()) {
+    std::vector<double> buffer;
+    process(&p_data, pack_points(p_data, buffer), p_result);
+}
+
+
+void silhouette_ksearch::process(const points_view<double> & p_points, silhouette_ksearch_data & p_result) {
+    process(nullptr, p_points, p_result);
+}
+
+
+void silhouette_ksearch::process(const dataset * const p_data, const points_view<double> & p_points, silhouette_ksearch_data & p_result) {
+    if (m_kmax > p_points.rows()) {
         throw std::invalid_argument("K max value '" + std::to_string(m_kmax) + 
-            "' should be bigger than amount of objects '" + std::to_string(p_data.size()) + "' in input data.");
+            "' should be bigger than amount of objects '" + std::to_string(p_points.rows()) + "' in input data.");
     }
 
-    p_result.scores().reserve(m_kmax - m_kmin);
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(m_time_budget));
 
-    for (std::size_t k = m_kmin; k < m_kmax; k++) {
+    const std::size_t amount = (m_kmax > m_kmin) ? m_kmax - m_kmin : 0;
+    p_result.scores().assign(amount, std::nan("1"));
+
+    std::mutex best_mutex;
+
+    parallel_for(std::size_t(0), amount, [&](const std::size_t p_index) {
+        if ( (p_index > 0) && (m_time_budget > 0.0) && (std::chrono::steady_clock::now() >= deadline) ) {
+            return;
+        }
+
+        const std::size_t k = m_kmin + p_index;
+
+        /* allocator gets the dataset if it has been provided, so it does not have to copy the points */
         cluster_sequence clusters;
-        m_allocator->allocate(k, p_data, clusters);
+        if (p_data != nullptr) {
+            m_allocator->allocate(k, *p_data, p_points, clusters);
+        }
+        else {
+            m_allocator->allocate(k, p_points, clusters);
+        }
 
-        if (clusters.size() != k) {
-            p_result.scores().push_back(std::nan("1"));
-            continue;
+        /* coincident points may leave clusters empty, the remaining ones are scored, but one cluster has no score */
+        if (clusters.size() < 2) {
+            return;
         }
-        
+
         silhouette_data result;
-        silhouette().process(p_data, clusters, result);
+        silhouette().process(p_points, clusters, result);
 
         const auto & scores = result.get_score();
         const double score = std::accumulate(scores.begin(), scores.end(), 0.0) / scores.size();
-        p_result.scores().push_back(score);
+        p_result.scores()[p_index] = score;
 
-        if (score > p_result.get_score()) {
-            p_result.set_amount(k);
+        /* the smallest amount wins in case of equal scores, the same as in case of sequential search */
+        const std::size_t allocated = clusters.size();
+        std::lock_guard<std::mutex> guard(best_mutex);
+        if ( (score > p_result.get_score()) || ((score == p_result.get_score()) && (p_result.get_amount() > allocated)) ) {
+            p_result.set_amount(allocated);
             p_result.set_score(score);
+            p_result.clusters() = std::move(clusters);
         }
-    }
+    }, 1);
 }
 
-
 }
 
 }
\ No newline at end of file
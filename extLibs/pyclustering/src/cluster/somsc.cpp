@@ -31,9 +31,10 @@ namespace pyclustering {
 namespace clst {
 
 
-somsc::somsc(const std::size_t p_amount_clusters, const std::size_t p_epoch) :
+somsc::somsc(const std::size_t p_amount_clusters, const std::size_t p_epoch, const som_train_type p_train_type) :
         m_amount_clusters(p_amount_clusters),
-        m_epoch(p_epoch)
+        m_epoch(p_epoch),
+        m_train_type(p_train_type)
 { }
 
 
@@ -42,7 +43,34 @@ void somsc::process(const dataset & p_data, cluster_data & p_result) {
 
     som_parameters params;
     som som_map(1, m_amount_clusters, som_conn_type::SOM_GRID_FOUR, params);
-    som_map.train(p_data, m_epoch, true);
+    if (m_train_type == som_train_type::SOM_BATCH) {
+        som_map.train_batch(p_data, m_epoch, true);
+    }
+    else {
+        som_map.train(p_data, m_epoch, true);
+    }
+
+    p_result.clusters() = som_map.get_capture_objects();
+}
+
+
+void somsc::process(const utils::metric::points_view<double> & p_points, cluster_data & p_result) {
+    process_view(p_points, p_result);
+}
+
+
+void somsc::process(const utils::metric::points_view<float> & p_points, cluster_data & p_result) {
+    process_view(p_points, p_result);
+}
+
+
+template <typename TypeValue>
+void somsc::process_view(const utils::metric::points_view<TypeValue> & p_points, cluster_data & p_result) {
+    p_result = somsc_data();
+
+    som_parameters params;
+    som som_map(1, m_amount_clusters, som_conn_type::SOM_GRID_FOUR, params);
+    som_map.train_batch(p_points, m_epoch, true);
 
     p_result.clusters() = som_map.get_capture_objects();
 }
@@ -23,6 +23,7 @@
 
 #include <pyclustering/cluster/syncnet.hpp>
 
+#include <algorithm>
 #include <limits>
 
 #include <pyclustering/utils/metric.hpp>
@@ -166,6 +167,34 @@ void syncnet::phase_kuramoto_equation(const double t, const differ_state<double>
 }
 
 
+bool syncnet::create_coupling(sync_coupling & p_coupling) const {
+    create_coupling_structure(distance_conn_weights == nullptr, p_coupling);
+
+    p_coupling.m_scale.resize(size());
+    p_coupling.m_frequency.assign(size(), 0.0);     /* internal frequency is not used by the network */
+
+    if (distance_conn_weights != nullptr) {
+        p_coupling.m_weights.resize(p_coupling.m_neighbors.size());
+    }
+    else {
+        p_coupling.m_weights.clear();
+    }
+
+    for (std::size_t index = 0; index < size(); index++) {
+        const std::size_t num_neighbors = std::max(p_coupling.degree(index), std::size_t(1));
+        p_coupling.m_scale[index] = weight / static_cast<double>(num_neighbors);
+
+        if (distance_conn_weights != nullptr) {
+            for (std::size_t k = p_coupling.m_offsets[index]; k < p_coupling.m_offsets[index + 1]; k++) {
+                p_coupling.m_weights[k] = (*distance_conn_weights)[index][p_coupling.m_neighbors[k]];
+            }
+        }
+    }
+
+    return true;
+}
+
+
 void syncnet::process(const double order, const solve_type solver, const bool collect_dynamic, syncnet_analyser & analyser) {
     simulate_dynamic(order, 0.1, solver, collect_dynamic, analyser);
 }
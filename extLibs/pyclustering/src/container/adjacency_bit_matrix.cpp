@@ -22,6 +22,7 @@
 
 #include <pyclustering/container/adjacency_bit_matrix.hpp>
 
+#include <bitset>
 #include <string>
 #include <stdexcept>
 
@@ -34,9 +35,56 @@ namespace container {
 const size_t adjacency_bit_matrix::DEFAULT_EXISTANCE_CONNECTION_VALUE = 0x01;
 const size_t adjacency_bit_matrix::DEFAULT_NON_EXISTANCE_CONNECTION_VALUE = 0x00;
 
+const size_t adjacency_bit_matrix::BITS_PER_ELEMENT = (sizeof(size_t) << 3);
+
+
+namespace {
+
+
+std::size_t count_common_bits_generic(const std::size_t * p_row1, const std::size_t * p_row2, const std::size_t p_length) {
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < p_length; i++) {
+        result += std::bitset<sizeof(std::size_t) << 3>(p_row1[i] & p_row2[i]).count();
+    }
+
+    return result;
+}
+
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+
+__attribute__((target("popcnt")))
+std::size_t count_common_bits_popcnt(const std::size_t * p_row1, const std::size_t * p_row2, const std::size_t p_length) {
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < p_length; i++) {
+        result += (std::size_t) __builtin_popcountll((unsigned long long) (p_row1[i] & p_row2[i]));
+    }
+
+    return result;
+}
+
+
+using count_common_bits_function = std::size_t (*)(const std::size_t *, const std::size_t *, const std::size_t);
+
+std::size_t count_common_bits(const std::size_t * p_row1, const std::size_t * p_row2, const std::size_t p_length) {
+    static const count_common_bits_function function = __builtin_cpu_supports("popcnt") ? count_common_bits_popcnt : count_common_bits_generic;
+    return function(p_row1, p_row2, p_length);
+}
+
+#else
+
+std::size_t count_common_bits(const std::size_t * p_row1, const std::size_t * p_row2, const std::size_t p_length) {
+    return count_common_bits_generic(p_row1, p_row2, p_length);
+}
+
+#endif
+
+
+}
+
 
 adjacency_bit_matrix::adjacency_bit_matrix(const size_t node_amount) :
-    m_adjacency(node_amount, std::vector<size_t>(node_amount, 0)),
+    m_adjacency(node_amount, std::vector<size_t>((node_amount + BITS_PER_ELEMENT - 1) / BITS_PER_ELEMENT, 0)),
     m_size(node_amount)
 { }
 
@@ -69,15 +117,28 @@ bool adjacency_bit_matrix::has_connection(const size_t node_index1, const size_t
 
 void adjacency_bit_matrix::get_neighbors(const size_t node_index, std::vector<size_t> & node_neighbors) const {
     node_neighbors.clear();
-    
-    for (size_t neighbor_index = 0; neighbor_index != m_adjacency.size(); neighbor_index++) {
-        if (has_connection(node_index, neighbor_index)) {
-            node_neighbors.push_back(neighbor_index);
+
+    const std::vector<size_t> & row = m_adjacency[node_index];
+    for (size_t index_element = 0; index_element < row.size(); index_element++) {
+        const size_t element = row[index_element];
+        if (element == 0) {
+            continue;   /* sparse rows skip whole elements */
+        }
+
+        for (size_t bit_number = 0; bit_number < BITS_PER_ELEMENT; bit_number++) {
+            if ((element >> bit_number) & (size_t) DEFAULT_EXISTANCE_CONNECTION_VALUE) {
+                node_neighbors.push_back(index_element * BITS_PER_ELEMENT + bit_number);
+            }
         }
     }
 }
 
 
+size_t adjacency_bit_matrix::count_common_neighbors(const size_t node_index1, const size_t node_index2) const {
+    return count_common_bits(m_adjacency[node_index1].data(), m_adjacency[node_index2].data(), m_adjacency[node_index1].size());
+}
+
+
 void adjacency_bit_matrix::clear() {
     m_adjacency.clear();
     m_size = 0;
@@ -85,11 +146,10 @@ void adjacency_bit_matrix::clear() {
 
 
 void adjacency_bit_matrix::update_connection(const size_t node_index1, const size_t node_index2, const size_t state_connection) {
-    size_t element_byte_length = (sizeof(size_t) << 3);
-    size_t index_element = node_index2 / element_byte_length;
-    size_t bit_number = node_index2 % element_byte_length;
+    size_t index_element = node_index2 / BITS_PER_ELEMENT;
+    size_t bit_number = node_index2 % BITS_PER_ELEMENT;
 
-    if ( (node_index1 > m_adjacency.size()) || (index_element > m_adjacency.size()) ) {
+    if ( (node_index1 >= m_size) || (node_index2 >= m_size) ) {
         std::string message("adjacency bit matrix size: " + std::to_string(m_adjacency.size()) + ", index1: " + std::to_string(node_index1) + ", index2: " + std::to_string(node_index2));
         throw std::out_of_range(message);
     }
@@ -61,6 +61,15 @@ std::shared_ptr<adjacency_collection> adjacency_unweight_factory::create_collect
 }
 
 
+adjacency_unweight_t adjacency_unweight_factory::select_storing_type(const size_t amount_nodes, const size_t amount_connections) {
+    /* hash set node with its bucket takes roughly 32 bytes per connection, bit matrix takes one bit per pair of nodes */
+    const double list_bytes = 32.0 * (double) amount_connections;
+    const double bit_matrix_bytes = (double) amount_nodes * (double) amount_nodes / 8.0;
+
+    return (list_bytes < bit_matrix_bytes) ? adjacency_unweight_t::ADJACENCY_LIST : adjacency_unweight_t::ADJACENCY_BIT_MATRIX;
+}
+
+
 std::shared_ptr<adjacency_weight_collection> adjacency_weight_factory::create_collection(const size_t amount_nodes, const adjacency_weight_t storing_type, const connection_t structure_type, const std::function<double()> & weight_value_generator) {
     adjacency_weight_collection * collection = nullptr;
 
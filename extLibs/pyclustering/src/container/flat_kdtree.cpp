@@ -0,0 +1,222 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include <pyclustering/container/flat_kdtree.hpp>
+
+#include <pyclustering/parallel/parallel.hpp>
+
+#include <numeric>
+
+
+using namespace pyclustering::parallel;
+using namespace pyclustering::utils::metric;
+
+
+namespace pyclustering {
+
+namespace container {
+
+
+/* maximum amount of points of the node that are used to find the coordinate with the widest spread */
+const std::size_t SPREAD_SAMPLE_SIZE = 256;
+
+
+flat_kdtree::flat_kdtree(const points_view<double> & p_points, const std::size_t p_leaf_size) :
+    m_dimension(p_points.cols()),
+    m_leaf_size(std::max(p_leaf_size, std::size_t(1)))
+{
+    build(p_points);
+}
+
+
+flat_kdtree::flat_kdtree(const dataset & p_points, const std::size_t p_leaf_size) :
+    m_leaf_size(std::max(p_leaf_size, std::size_t(1)))
+{
+    std::vector<double> buffer;
+    const points_view<double> points = pack_points(p_points, buffer);
+
+    m_dimension = points.cols();
+    build(points);
+}
+
+
+void flat_kdtree::build(const points_view<double> & p_points) {
+    m_nodes.clear();
+    m_indexes.resize(p_points.rows());
+    std::iota(m_indexes.begin(), m_indexes.end(), 0);
+
+    if (p_points.rows() == 0) {
+        m_points.clear();
+        return;
+    }
+
+    m_nodes.reserve(2 * (p_points.rows() / m_leaf_size + 1));
+
+    std::vector<std::pair<double, std::size_t>> keys(p_points.rows());
+    build_node(p_points, 0, p_points.rows(), keys);
+
+    /* coordinates are stored in order of the leaves */
+    m_points.resize(p_points.rows() * m_dimension);
+    parallel_for(std::size_t(0), p_points.rows(), [this, &p_points](const std::size_t p_position) {
+        const double * source = p_points.row(m_indexes[p_position]);
+        std::copy(source, source + m_dimension, m_points.data() + p_position * m_dimension);
+    });
+}
+
+
+std::size_t flat_kdtree::build_node(const points_view<double> & p_points, const std::size_t p_begin, const std::size_t p_end, std::vector<std::pair<double, std::size_t>> & p_keys) {
+    const std::size_t index_node = m_nodes.size();
+    m_nodes.push_back({ p_begin, p_end, 0, 0, 0.0 });
+
+    if (p_end - p_begin <= m_leaf_size) {
+        return index_node;
+    }
+
+    std::vector<double> minimum(p_points.row(m_indexes[p_begin]), p_points.row(m_indexes[p_begin]) + m_dimension);
+    std::vector<double> maximum(minimum);
+
+    const std::size_t step = std::max((p_end - p_begin) / SPREAD_SAMPLE_SIZE, std::size_t(1));
+    for (std::size_t position = p_begin + step; position < p_end; position += step) {
+        const double * point = p_points.row(m_indexes[position]);
+        for (std::size_t i = 0; i < m_dimension; i++) {
+            minimum[i] = std::min(minimum[i], point[i]);
+            maximum[i] = std::max(maximum[i], point[i]);
+        }
+    }
+
+    std::size_t discriminator = 0;
+    for (std::size_t i = 1; i < m_dimension; i++) {
+        if (maximum[i] - minimum[i] > maximum[discriminator] - minimum[discriminator]) {
+            discriminator = i;
+        }
+    }
+
+    /* all points are equal, they cannot be split */
+    if ( (m_dimension == 0) || (maximum[discriminator] == minimum[discriminator]) ) {
+        return index_node;
+    }
+
+    /* coordinates are gathered once, so the partitioning does not jump over rows of the points */
+    for (std::size_t position = p_begin; position < p_end; position++) {
+        p_keys[position] = { p_points.row(m_indexes[position])[discriminator], m_indexes[position] };
+    }
+
+    const std::size_t middle = p_begin + (p_end - p_begin) / 2;
+    std::nth_element(p_keys.begin() + p_begin, p_keys.begin() + middle, p_keys.begin() + p_end);
+
+    for (std::size_t position = p_begin; position < p_end; position++) {
+        m_indexes[position] = p_keys[position].second;
+    }
+
+    m_nodes[index_node].m_discriminator = discriminator;
+    m_nodes[index_node].m_value = p_keys[middle].first;
+
+    build_node(p_points, p_begin, middle, p_keys);
+    const std::size_t index_right = build_node(p_points, middle, p_end, p_keys);
+    m_nodes[index_node].m_right = index_right;
+
+    return index_node;
+}
+
+
+void flat_kdtree::radius_search(const points_view<double> & p_queries, const double p_radius, std::vector<neighbor_sequence> & p_result) const {
+    p_result.assign(p_queries.rows(), neighbor_sequence());
+
+    parallel_for(std::size_t(0), p_queries.rows(), [this, &p_queries, p_radius, &p_result](const std::size_t p_index) {
+        neighbor_sequence & neighbors = p_result[p_index];
+        radius_search(p_queries.row(p_index), p_radius, [&neighbors](const std::size_t p_index_neighbor, const double p_distance) {
+            neighbors.push_back({ p_index_neighbor, p_distance });
+        });
+    });
+}
+
+
+void flat_kdtree::knn_search(const double * p_point, const std::size_t p_amount, neighbor_sequence & p_result) const {
+    p_result.clear();
+    if (m_nodes.empty() || (p_amount == 0)) {
+        return;
+    }
+
+    p_result.reserve(p_amount + 1);
+
+    std::vector<double> offsets(m_dimension, 0.0);
+    knn_search_node(0, p_point, p_amount, 0.0, offsets.data(), p_result);
+
+    std::sort_heap(p_result.begin(), p_result.end(), [](const neighbor & p_neighbor1, const neighbor & p_neighbor2) {
+        return p_neighbor1.m_distance < p_neighbor2.m_distance;
+    });
+}
+
+
+void flat_kdtree::knn_search(const points_view<double> & p_queries, const std::size_t p_amount, std::vector<neighbor_sequence> & p_result) const {
+    p_result.assign(p_queries.rows(), neighbor_sequence());
+
+    parallel_for(std::size_t(0), p_queries.rows(), [this, &p_queries, p_amount, &p_result](const std::size_t p_index) {
+        knn_search(p_queries.row(p_index), p_amount, p_result[p_index]);
+    });
+}
+
+
+void flat_kdtree::knn_search_node(const std::size_t p_node, const double * p_point, const std::size_t p_amount, const double p_cell_distance, double * p_offsets, neighbor_sequence & p_heap) const {
+    const node & current = m_nodes[p_node];
+
+    /* heap keeps the farthest of the nearest points on the top */
+    const auto farther = [](const neighbor & p_neighbor1, const neighbor & p_neighbor2) {
+        return p_neighbor1.m_distance < p_neighbor2.m_distance;
+    };
+
+    if (current.m_right == 0) {
+        visit_leaf(current, p_point, [this, p_amount, &p_heap, &farther](const std::size_t p_position, const double p_distance) {
+            if (p_heap.size() < p_amount) {
+                p_heap.push_back({ m_indexes[p_position], p_distance });
+                std::push_heap(p_heap.begin(), p_heap.end(), farther);
+            }
+            else if (p_distance < p_heap.front().m_distance) {
+                std::pop_heap(p_heap.begin(), p_heap.end(), farther);
+                p_heap.back() = { m_indexes[p_position], p_distance };
+                std::push_heap(p_heap.begin(), p_heap.end(), farther);
+            }
+        });
+
+        return;
+    }
+
+    const double difference = p_point[current.m_discriminator] - current.m_value;
+    const std::size_t near_child = (difference <= 0.0) ? p_node + 1 : current.m_right;
+    const std::size_t far_child = (difference <= 0.0) ? current.m_right : p_node + 1;
+
+    knn_search_node(near_child, p_point, p_amount, p_cell_distance, p_offsets, p_heap);
+
+    const double previous_offset = p_offsets[current.m_discriminator];
+    const double far_distance = p_cell_distance - previous_offset * previous_offset + difference * difference;
+    if ( (p_heap.size() < p_amount) || (far_distance < p_heap.front().m_distance) ) {
+        p_offsets[current.m_discriminator] = difference;
+        knn_search_node(far_child, p_point, p_amount, far_distance, p_offsets, p_heap);
+        p_offsets[current.m_discriminator] = previous_offset;
+    }
+}
+
+
+}
+
+}
@@ -0,0 +1,705 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include <pyclustering/container/hnsw_index.hpp>
+
+#include <pyclustering/parallel/parallel.hpp>
+
+#include <pyclustering/utils/metric_simd.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+
+using namespace pyclustering::parallel;
+using namespace pyclustering::utils::metric;
+
+
+namespace pyclustering {
+
+namespace container {
+
+
+namespace {
+
+
+/* identifier of the index file, contains version of the format */
+const char INDEX_FILE_MAGIC[8] = { 'P', 'C', 'H', 'N', 'S', 'W', '0', '1' };
+
+/* levels are stored in one byte */
+const std::size_t MAXIMUM_LEVEL = std::numeric_limits<std::uint8_t>::max();
+
+
+/**
+ *
+ * @brief   Set of visited nodes that is reused by queries of the same thread.
+ * @details Node is visited if its mark equals to the current generation, so the set is cleared in constant time.
+ *
+ */
+class visited_set {
+private:
+    std::vector<std::uint32_t>  m_marks         = { };
+    std::uint32_t               m_generation    = 0;
+
+public:
+    void reset(const std::size_t p_size) {
+        if (m_marks.size() < p_size) {
+            m_marks.assign(p_size, 0);
+            m_generation = 0;
+        }
+
+        m_generation++;
+        if (m_generation == 0) {
+            std::fill(m_marks.begin(), m_marks.end(), 0);
+            m_generation = 1;
+        }
+    }
+
+    bool insert(const std::size_t p_index) {
+        if (m_marks[p_index] == m_generation) {
+            return false;
+        }
+
+        m_marks[p_index] = m_generation;
+        return true;
+    }
+};
+
+
+visited_set & local_visited_set() {
+    thread_local visited_set visited;
+    return visited;
+}
+
+
+bool nearer(const point_neighbor & p_left, const point_neighbor & p_right) {
+    return p_left.m_distance < p_right.m_distance;
+}
+
+
+bool farther(const point_neighbor & p_left, const point_neighbor & p_right) {
+    return p_left.m_distance > p_right.m_distance;
+}
+
+
+template <typename TypeValue>
+void write_values(std::ofstream & p_stream, const TypeValue * p_values, const std::size_t p_size) {
+    p_stream.write(reinterpret_cast<const char *>(p_values), p_size * sizeof(TypeValue));
+}
+
+
+template <typename TypeValue>
+void read_values(std::ifstream & p_stream, TypeValue * p_values, const std::size_t p_size) {
+    p_stream.read(reinterpret_cast<char *>(p_values), p_size * sizeof(TypeValue));
+}
+
+
+/* checks lists of links that are stored one after another, each one is amount of links followed by capacity slots,
+   every link must point to a node that is present on the layer of its list: bottom lists are all on layer 0,
+   upper lists of a node start from layer 1 and go up */
+template <typename TypeLink>
+bool valid_links(const std::vector<TypeLink> & p_links, const std::size_t p_capacity, const std::vector<std::uint8_t> & p_levels, const bool p_upper) {
+    std::size_t layer = p_upper ? 1 : 0;
+    for (std::size_t begin = 0; begin < p_links.size(); begin += p_capacity + 1, layer += p_upper ? 1 : 0) {
+        const std::size_t amount = p_links[begin];
+        if (amount > p_capacity) {
+            return false;
+        }
+
+        for (std::size_t i = begin + 1; i <= begin + amount; i++) {
+            if ((p_links[i] >= p_levels.size()) || (p_levels[p_links[i]] < layer)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+
+}
+
+
+hnsw_index::hnsw_index(const points_view<double> & p_points, const hnsw_parameters & p_parameters) :
+    m_parameters(p_parameters),
+    m_dimension(p_points.cols())
+{
+    build(p_points);
+}
+
+
+hnsw_index::hnsw_index(const dataset & p_points, const hnsw_parameters & p_parameters) :
+    m_parameters(p_parameters)
+{
+    std::vector<double> buffer;
+    const points_view<double> points = pack_points(p_points, buffer);
+
+    m_dimension = points.cols();
+    build(points);
+}
+
+
+void hnsw_index::set_ef_search(const std::size_t p_ef_search) {
+    m_parameters.m_ef_search = std::max(p_ef_search, std::size_t(1));
+}
+
+
+void hnsw_index::build(const points_view<double> & p_points) {
+    if (m_parameters.m_connections < 2) {
+        throw std::invalid_argument("Amount of connections of the HNSW index should be at least 2.");
+    }
+
+    m_parameters.m_ef_construction = std::max(m_parameters.m_ef_construction, m_parameters.m_connections);
+    m_parameters.m_ef_search = std::max(m_parameters.m_ef_search, std::size_t(1));
+
+    m_size = p_points.rows();
+    m_points.resize(m_size * m_dimension);
+    for (std::size_t i = 0; i < m_size; i++) {
+        std::copy(p_points.row(i), p_points.row(i) + m_dimension, m_points.begin() + i * m_dimension);
+    }
+
+    /* levels are drawn before the insertion, so every node has its link lists when it becomes reachable */
+    std::mt19937 generator(m_parameters.m_seed);
+    m_levels.resize(m_size);
+    m_upper_links.assign(m_size, std::vector<link_type>());
+    for (std::size_t i = 0; i < m_size; i++) {
+        m_levels[i] = static_cast<std::uint8_t>(random_level(generator));
+        m_upper_links[i].assign(m_levels[i] * (capacity(1) + 1), 0);
+    }
+
+    m_bottom_links.assign(m_size * (capacity(0) + 1), 0);
+
+    if (m_size == 0) {
+        return;
+    }
+
+    m_entry = 0;
+    m_top_level = m_levels[0];
+
+    std::unique_ptr<spinlock[]> locks(new spinlock[m_size + 1]);
+    m_locks = locks.get();
+
+    parallel_for(std::size_t(1), m_size, [this](const std::size_t p_index) {
+        insert(p_index);
+    });
+
+    m_locks = nullptr;
+}
+
+
+std::size_t hnsw_index::random_level(std::mt19937 & p_generator) const {
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    const double multiplier = 1.0 / std::log(static_cast<double>(m_parameters.m_connections));
+    const double level = -std::log(1.0 - distribution(p_generator)) * multiplier;
+
+    return std::min(static_cast<std::size_t>(level), MAXIMUM_LEVEL);
+}
+
+
+void hnsw_index::insert(const std::size_t p_index) {
+    const double * point = row(p_index);
+    const std::size_t level = m_levels[p_index];
+
+    spinlock & entry_lock = m_locks[m_size];
+    entry_lock.lock();
+    const std::size_t entry = m_entry;
+    const std::size_t top_level = m_top_level;
+    entry_lock.unlock();
+
+    const std::size_t nearest = greedy_search(point, entry, top_level, level, true);
+
+    neighbor_sequence candidates = { { nearest, simd::euclidean_distance_square(point, row(nearest), m_dimension) } };
+    neighbor_sequence neighbors;
+
+    for (std::size_t current_level = std::min(level, top_level) + 1; current_level-- > 0; ) {
+        search_layer(point, current_level, m_parameters.m_ef_construction, candidates, true);
+
+        neighbors.clear();
+        for (const auto & candidate : candidates) {
+            if (candidate.m_index != p_index) {
+                neighbors.push_back(candidate);
+            }
+        }
+
+        select_neighbors(neighbors, m_parameters.m_connections);
+        connect(p_index, current_level, neighbors);
+    }
+
+    if (level > top_level) {
+        entry_lock.lock();
+        if (level > m_top_level) {
+            m_top_level = level;
+            m_entry = p_index;
+        }
+        entry_lock.unlock();
+    }
+}
+
+
+std::size_t hnsw_index::greedy_search(const double * p_point, std::size_t p_entry, const std::size_t p_from_level, const std::size_t p_to_level, const bool p_locked) const {
+    double distance = simd::euclidean_distance_square(p_point, row(p_entry), m_dimension);
+
+    std::vector<link_type> neighbors;
+    for (std::size_t level = p_from_level; level > p_to_level; level--) {
+        for (bool changed = true; changed; ) {
+            changed = false;
+
+            read_links(p_entry, level, neighbors, p_locked);
+            for (const auto index : neighbors) {
+                const double candidate_distance = simd::euclidean_distance_square(p_point, row(index), m_dimension);
+                if (candidate_distance < distance) {
+                    distance = candidate_distance;
+                    p_entry = index;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    return p_entry;
+}
+
+
+void hnsw_index::search_layer(const double * p_point, const std::size_t p_level, const std::size_t p_ef, neighbor_sequence & p_candidates, const bool p_locked) const {
+    const simd::kernel_set<double> & kernels = simd::get_kernels<double>();
+
+    thread_local std::vector<link_type> neighbors;
+    thread_local std::vector<link_type> unvisited;
+
+    visited_set & visited = local_visited_set();
+    visited.reset(m_size);
+
+    /* candidates to expand are ordered from the nearest, found points are ordered from the farthest */
+    neighbor_sequence queue;
+    neighbor_sequence found;
+    for (const auto & candidate : p_candidates) {
+        if (visited.insert(candidate.m_index)) {
+            queue.push_back(candidate);
+            found.push_back(candidate);
+        }
+    }
+
+    std::make_heap(queue.begin(), queue.end(), farther);
+    std::make_heap(found.begin(), found.end(), nearer);
+    while (found.size() > p_ef) {
+        std::pop_heap(found.begin(), found.end(), nearer);
+        found.pop_back();
+    }
+
+    auto consider = [&found, p_ef, &queue](const std::size_t p_index, const double p_distance) {
+        if ((found.size() < p_ef) || (p_distance < found.front().m_distance)) {
+            queue.push_back({ p_index, p_distance });
+            std::push_heap(queue.begin(), queue.end(), farther);
+
+            found.push_back({ p_index, p_distance });
+            std::push_heap(found.begin(), found.end(), nearer);
+
+            if (found.size() > p_ef) {
+                std::pop_heap(found.begin(), found.end(), nearer);
+                found.pop_back();
+            }
+        }
+    };
+
+    while (!queue.empty()) {
+        const point_neighbor current = queue.front();
+        if ((found.size() >= p_ef) && (current.m_distance > found.front().m_distance)) {
+            break;
+        }
+
+        std::pop_heap(queue.begin(), queue.end(), farther);
+        queue.pop_back();
+
+        read_links(current.m_index, p_level, neighbors, p_locked);
+
+        unvisited.clear();
+        for (const auto index : neighbors) {
+            if (visited.insert(index)) {
+                unvisited.push_back(index);
+            }
+        }
+
+        std::size_t position = 0;
+        for (; position + simd::DOT_PRODUCT_BLOCK_SIZE <= unvisited.size(); position += simd::DOT_PRODUCT_BLOCK_SIZE) {
+            const double * others[simd::DOT_PRODUCT_BLOCK_SIZE] = {
+                row(unvisited[position]), row(unvisited[position + 1]), row(unvisited[position + 2]), row(unvisited[position + 3]) };
+
+            double distances[simd::DOT_PRODUCT_BLOCK_SIZE];
+            kernels.euclidean_distance_square_block(p_point, others, m_dimension, distances);
+
+            for (std::size_t k = 0; k < simd::DOT_PRODUCT_BLOCK_SIZE; k++) {
+                consider(unvisited[position + k], distances[k]);
+            }
+        }
+
+        for (; position < unvisited.size(); position++) {
+            consider(unvisited[position], kernels.euclidean_distance_square(p_point, row(unvisited[position]), m_dimension));
+        }
+    }
+
+    std::sort_heap(found.begin(), found.end(), nearer);
+    p_candidates = std::move(found);
+}
+
+
+void hnsw_index::search(const double * p_point, const std::size_t p_ef, neighbor_sequence & p_result) const {
+    p_result.clear();
+    if (m_size == 0) {
+        return;
+    }
+
+    const std::size_t nearest = greedy_search(p_point, m_entry, m_top_level, 0, false);
+
+    p_result = { { nearest, simd::euclidean_distance_square(p_point, row(nearest), m_dimension) } };
+    search_layer(p_point, 0, p_ef, p_result, false);
+}
+
+
+void hnsw_index::select_neighbors(neighbor_sequence & p_candidates, const std::size_t p_amount) const {
+    if (p_candidates.size() <= p_amount) {
+        return;
+    }
+
+    /* candidate is skipped if it is closer to one of the selected neighbors than to the point, so links
+       lead in different directions and the graph stays connected between clusters */
+    neighbor_sequence selected;
+    selected.reserve(p_amount);
+
+    for (const auto & candidate : p_candidates) {
+        if (selected.size() == p_amount) {
+            break;
+        }
+
+        const double * candidate_point = row(candidate.m_index);
+        const bool diverse = std::none_of(selected.begin(), selected.end(), [this, &candidate, candidate_point](const point_neighbor & p_selected) {
+            return simd::euclidean_distance_square(candidate_point, row(p_selected.m_index), m_dimension) < candidate.m_distance;
+        });
+
+        if (diverse) {
+            selected.push_back(candidate);
+        }
+    }
+
+    p_candidates = std::move(selected);
+}
+
+
+void hnsw_index::connect(const std::size_t p_index, const std::size_t p_level, const neighbor_sequence & p_neighbors) {
+    const std::size_t limit = capacity(p_level);
+
+    m_locks[p_index].lock();
+    link_type * own_links = links(p_index, p_level);
+    own_links[0] = static_cast<link_type>(p_neighbors.size());
+    for (std::size_t i = 0; i < p_neighbors.size(); i++) {
+        own_links[i + 1] = static_cast<link_type>(p_neighbors[i].m_index);
+    }
+    m_locks[p_index].unlock();
+
+    neighbor_sequence candidates;
+    for (const auto & neighbor : p_neighbors) {
+        const std::size_t index_neighbor = neighbor.m_index;
+
+        std::lock_guard<spinlock> guard(m_locks[index_neighbor]);
+
+        link_type * neighbor_links = links(index_neighbor, p_level);
+        const std::size_t amount = neighbor_links[0];
+        if (amount < limit) {
+            neighbor_links[amount + 1] = static_cast<link_type>(p_index);
+            neighbor_links[0]++;
+            continue;
+        }
+
+        /* list is full, the new link competes with the existing ones */
+        candidates.clear();
+        candidates.push_back({ p_index, neighbor.m_distance });
+        for (std::size_t i = 1; i <= amount; i++) {
+            const std::size_t index_link = neighbor_links[i];
+            candidates.push_back({ index_link, simd::euclidean_distance_square(row(index_neighbor), row(index_link), m_dimension) });
+        }
+
+        std::sort(candidates.begin(), candidates.end(), nearer);
+        select_neighbors(candidates, limit);
+
+        neighbor_links[0] = static_cast<link_type>(candidates.size());
+        for (std::size_t i = 0; i < candidates.size(); i++) {
+            neighbor_links[i + 1] = static_cast<link_type>(candidates[i].m_index);
+        }
+    }
+}
+
+
+void hnsw_index::read_links(const std::size_t p_index, const std::size_t p_level, std::vector<link_type> & p_links, const bool p_locked) const {
+    if (p_locked) {
+        m_locks[p_index].lock();
+    }
+
+    const link_type * node_links = links(p_index, p_level);
+    p_links.assign(node_links + 1, node_links + 1 + node_links[0]);
+
+    if (p_locked) {
+        m_locks[p_index].unlock();
+    }
+}
+
+
+hnsw_index::link_type * hnsw_index::links(const std::size_t p_index, const std::size_t p_level) {
+    if (p_level == 0) {
+        return m_bottom_links.data() + p_index * (capacity(0) + 1);
+    }
+
+    return m_upper_links[p_index].data() + (p_level - 1) * (capacity(1) + 1);
+}
+
+
+const hnsw_index::link_type * hnsw_index::links(const std::size_t p_index, const std::size_t p_level) const {
+    return const_cast<hnsw_index *>(this)->links(p_index, p_level);
+}
+
+
+void hnsw_index::knn_search(const double * p_point, const std::size_t p_amount, neighbor_sequence & p_result) const {
+    if (p_amount == 0) {
+        p_result.clear();
+        return;
+    }
+
+    search(p_point, std::max(m_parameters.m_ef_search, p_amount), p_result);
+    if (p_result.size() > p_amount) {
+        p_result.resize(p_amount);
+    }
+}
+
+
+void hnsw_index::knn_search(const points_view<double> & p_queries, const std::size_t p_amount, std::vector<neighbor_sequence> & p_result) const {
+    p_result.resize(p_queries.rows());
+    parallel_for(std::size_t(0), p_queries.rows(), [this, &p_queries, p_amount, &p_result](const std::size_t p_index) {
+        knn_search(p_queries.row(p_index), p_amount, p_result[p_index]);
+    });
+}
+
+
+void hnsw_index::radius_search(const double * p_point, const double p_radius, neighbor_sequence & p_result) const {
+    const simd::kernel_set<double> & kernels = simd::get_kernels<double>();
+    const double radius_square = p_radius * p_radius;
+
+    search(p_point, m_parameters.m_ef_search, p_result);
+
+    /* neighborhood may be larger than the candidate list, it is grown through links of the found points
+       that are inside the radius, so the cost is proportional to the size of the neighborhood */
+    thread_local std::vector<link_type> neighbors;
+    thread_local std::vector<link_type> unvisited;
+    thread_local std::vector<std::size_t> queue;
+
+    visited_set & visited = local_visited_set();
+    visited.reset(m_size);
+
+    queue.clear();
+    for (const auto & neighbor : p_result) {
+        visited.insert(neighbor.m_index);
+        if (neighbor.m_distance <= radius_square) {
+            queue.push_back(neighbor.m_index);
+        }
+    }
+
+    auto consider = [&p_result, radius_square](const std::size_t p_index, const double p_distance) {
+        if (p_distance <= radius_square) {
+            p_result.push_back({ p_index, p_distance });
+            queue.push_back(p_index);
+        }
+    };
+
+    while (!queue.empty()) {
+        const std::size_t current = queue.back();
+        queue.pop_back();
+
+        read_links(current, 0, neighbors, false);
+
+        unvisited.clear();
+        for (const auto index : neighbors) {
+            if (visited.insert(index)) {
+                unvisited.push_back(index);
+            }
+        }
+
+        std::size_t position = 0;
+        for (; position + simd::DOT_PRODUCT_BLOCK_SIZE <= unvisited.size(); position += simd::DOT_PRODUCT_BLOCK_SIZE) {
+            const double * others[simd::DOT_PRODUCT_BLOCK_SIZE] = {
+                row(unvisited[position]), row(unvisited[position + 1]), row(unvisited[position + 2]), row(unvisited[position + 3]) };
+
+            double distances[simd::DOT_PRODUCT_BLOCK_SIZE];
+            kernels.euclidean_distance_square_block(p_point, others, m_dimension, distances);
+
+            for (std::size_t k = 0; k < simd::DOT_PRODUCT_BLOCK_SIZE; k++) {
+                consider(unvisited[position + k], distances[k]);
+            }
+        }
+
+        for (; position < unvisited.size(); position++) {
+            consider(unvisited[position], kernels.euclidean_distance_square(p_point, row(unvisited[position]), m_dimension));
+        }
+    }
+
+    std::sort(p_result.begin(), p_result.end(), nearer);
+
+    const auto border = std::upper_bound(p_result.begin(), p_result.end(), radius_square, [](const double p_distance, const point_neighbor & p_neighbor) {
+        return p_distance < p_neighbor.m_distance;
+    });
+
+    p_result.erase(border, p_result.end());
+}
+
+
+void hnsw_index::radius_search(const points_view<double> & p_queries, const double p_radius, std::vector<neighbor_sequence> & p_result) const {
+    p_result.resize(p_queries.rows());
+    parallel_for(std::size_t(0), p_queries.rows(), [this, &p_queries, p_radius, &p_result](const std::size_t p_index) {
+        radius_search(p_queries.row(p_index), p_radius, p_result[p_index]);
+    });
+}
+
+
+void hnsw_index::knn_graph(const std::size_t p_amount, std::vector<neighbor_sequence> & p_result) const {
+    p_result.resize(m_size);
+    parallel_for(std::size_t(0), m_size, [this, p_amount, &p_result](const std::size_t p_index) {
+        neighbor_sequence & neighbors = p_result[p_index];
+
+        /* the point itself is usually the nearest one, so one more neighbor is requested */
+        knn_search(row(p_index), p_amount + 1, neighbors);
+
+        const auto self = std::find_if(neighbors.begin(), neighbors.end(), [p_index](const point_neighbor & p_neighbor) {
+            return p_neighbor.m_index == p_index;
+        });
+
+        if (self != neighbors.end()) {
+            neighbors.erase(self);
+        }
+        else if (neighbors.size() > p_amount) {
+            neighbors.pop_back();
+        }
+    });
+}
+
+
+void hnsw_index::save(const std::string & p_path) const {
+    std::ofstream stream(p_path, std::ios::binary | std::ios::trunc);
+    if (!stream) {
+        throw std::runtime_error("Cannot open HNSW index file for writing: " + p_path);
+    }
+
+    const std::uint64_t header[] = { m_dimension, m_size, m_parameters.m_connections, m_parameters.m_ef_construction,
+        m_parameters.m_ef_search, m_parameters.m_seed, m_entry, m_top_level };
+
+    stream.write(INDEX_FILE_MAGIC, sizeof(INDEX_FILE_MAGIC));
+    write_values(stream, header, sizeof(header) / sizeof(header[0]));
+    write_values(stream, m_points.data(), m_points.size());
+    write_values(stream, m_levels.data(), m_levels.size());
+    write_values(stream, m_bottom_links.data(), m_bottom_links.size());
+    for (const auto & node_links : m_upper_links) {
+        write_values(stream, node_links.data(), node_links.size());
+    }
+
+    if (!stream.flush()) {
+        throw std::runtime_error("Cannot write HNSW index file: " + p_path);
+    }
+}
+
+
+void hnsw_index::load(const std::string & p_path) {
+    std::ifstream stream(p_path, std::ios::binary);
+    if (!stream) {
+        throw std::runtime_error("Cannot open HNSW index file: " + p_path);
+    }
+
+    char magic[sizeof(INDEX_FILE_MAGIC)] = { };
+    std::uint64_t header[8] = { };
+
+    stream.read(magic, sizeof(magic));
+    read_values(stream, header, sizeof(header) / sizeof(header[0]));
+    if (!stream || (std::memcmp(magic, INDEX_FILE_MAGIC, sizeof(INDEX_FILE_MAGIC)) != 0)) {
+        throw std::runtime_error("File is not an HNSW index: " + p_path);
+    }
+
+    hnsw_index index;
+    index.m_dimension = header[0];
+    index.m_size = header[1];
+    index.m_parameters.m_connections = header[2];
+    index.m_parameters.m_ef_construction = header[3];
+    index.m_parameters.m_ef_search = header[4];
+    index.m_parameters.m_seed = static_cast<std::uint32_t>(header[5]);
+    index.m_entry = header[6];
+    index.m_top_level = header[7];
+
+    if ((index.m_parameters.m_connections < 2) || (index.m_top_level > MAXIMUM_LEVEL) || (index.m_size > std::numeric_limits<link_type>::max())
+        || ((index.m_size != 0) && (index.m_entry >= index.m_size))) {
+        throw std::runtime_error("HNSW index file is corrupted: " + p_path);
+    }
+
+    index.m_points.resize(index.m_size * index.m_dimension);
+    index.m_levels.resize(index.m_size);
+    index.m_bottom_links.resize(index.m_size * (index.capacity(0) + 1));
+
+    read_values(stream, index.m_points.data(), index.m_points.size());
+    read_values(stream, index.m_levels.data(), index.m_levels.size());
+    read_values(stream, index.m_bottom_links.data(), index.m_bottom_links.size());
+
+    if (!stream) {
+        throw std::runtime_error("HNSW index file is truncated: " + p_path);
+    }
+
+    /* search starts from the top level of the entry point and follows links without range checks */
+    const bool valid_levels = std::all_of(index.m_levels.begin(), index.m_levels.end(), [&index](const std::uint8_t p_level) {
+        return p_level <= index.m_top_level;
+    });
+
+    if (!valid_levels || ((index.m_size != 0) && (index.m_levels[index.m_entry] != index.m_top_level))
+        || !valid_links(index.m_bottom_links, index.capacity(0), index.m_levels, false)) {
+        throw std::runtime_error("HNSW index file is corrupted: " + p_path);
+    }
+
+    index.m_upper_links.resize(index.m_size);
+    for (std::size_t i = 0; i < index.m_size; i++) {
+        index.m_upper_links[i].resize(index.m_levels[i] * (index.capacity(1) + 1));
+        read_values(stream, index.m_upper_links[i].data(), index.m_upper_links[i].size());
+
+        if (!stream) {
+            throw std::runtime_error("HNSW index file is truncated: " + p_path);
+        }
+
+        if (!valid_links(index.m_upper_links[i], index.capacity(1), index.m_levels, true)) {
+            throw std::runtime_error("HNSW index file is corrupted: " + p_path);
+        }
+    }
+
+    *this = std::move(index);
+}
+
+
+}
+
+}
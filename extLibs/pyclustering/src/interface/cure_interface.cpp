@@ -38,8 +38,36 @@ void * cure_algorithm(const pyclustering_package * const sample, const size_t nu
 }
 
 
+std::size_t cure_algorithm_view(const pyclustering_matrix * const p_sample,
+                                const std::size_t p_number_clusters,
+                                const std::size_t p_number_repr_points,
+                                const double p_compression,
+                                const std::size_t p_sample_size,
+                                const std::size_t p_amount_partitions,
+                                std::size_t * const p_labels,
+                                double * const p_means)
+{
+    return run_view_algorithm([&]() {
+        pyclustering::clst::cure solver(p_number_clusters, p_number_repr_points, p_compression, p_sample_size, p_amount_partitions);
+
+        pyclustering::clst::cure_data output_result;
+        const std::size_t size = visit_matrix(*p_sample, [&solver, &output_result](const auto & p_points) {
+            solver.process(p_points, output_result);
+            return p_points.rows();
+        });
+
+        write_labels(output_result.clusters(), size, p_labels);
+        if (p_means) {
+            write_rows(output_result.means(), p_means);
+        }
+
+        return output_result.clusters().size();
+    });
+}
+
+
 void cure_data_destroy(void * pointer_cure_data) {
-    delete (pyclustering::clst::cure *) pointer_cure_data;
+    delete (pyclustering::clst::cure_data *) pointer_cure_data;
 }
 
 
@@ -51,3 +51,23 @@ pyclustering_package * dbscan_algorithm(const pyclustering_package * const p_sam
 
     return package;
 }
+
+
+std::size_t dbscan_algorithm_view(const pyclustering_matrix * const p_sample,
+                                  const double p_radius,
+                                  const std::size_t p_minumum_neighbors,
+                                  std::size_t * const p_labels)
+{
+    return run_view_algorithm([&]() {
+        std::vector<double> sample_buffer;
+        const auto points = get_matrix_view(*p_sample, sample_buffer);
+
+        pyclustering::clst::dbscan solver(p_radius, p_minumum_neighbors);
+
+        pyclustering::clst::dbscan_data output_result;
+        solver.process(points, output_result);
+
+        write_labels(output_result.clusters(), points.rows(), p_labels);
+        return output_result.clusters().size();
+    });
+}
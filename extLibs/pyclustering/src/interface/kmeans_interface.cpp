@@ -26,6 +26,9 @@
 
 #include <pyclustering/utils/metric.hpp>
 
+#include <stdexcept>
+#include <string>
+
 
 using namespace pyclustering::utils::metric;
 
@@ -65,3 +68,42 @@ pyclustering_package * kmeans_algorithm(const pyclustering_package * const p_sam
 
     return package;
 }
+
+
+std::size_t kmeans_algorithm_view(const pyclustering_matrix * const p_sample,
+                                  const pyclustering_matrix * const p_initial_centers,
+                                  const double p_tolerance,
+                                  const std::size_t p_itermax,
+                                  std::size_t * const p_labels,
+                                  double * const p_centers)
+{
+    return run_view_algorithm([&]() {
+        std::vector<double> centers_buffer;
+        const points_view<double> initial_centers = get_matrix_view(*p_initial_centers, centers_buffer);
+
+        if ((initial_centers.rows() == 0) || (initial_centers.cols() != p_sample->cols)) {
+            throw std::invalid_argument("kmeans_algorithm_view() [" + std::to_string(__LINE__) + "]: '" + std::to_string(initial_centers.rows()) + "' initial centers of dimension '"
+                + std::to_string(initial_centers.cols()) + "' do not match data of dimension '" + std::to_string(p_sample->cols) + "'.");
+        }
+
+        pyclustering::dataset centers(initial_centers.rows());
+        for (std::size_t i = 0; i < initial_centers.rows(); i++) {
+            centers[i].assign(initial_centers.row(i), initial_centers.row(i) + initial_centers.cols());
+        }
+
+        pyclustering::clst::kmeans algorithm(centers, p_tolerance, p_itermax);
+
+        pyclustering::clst::kmeans_data output_result(false);
+        const std::size_t size = visit_matrix(*p_sample, [&algorithm, &output_result](const auto & p_points) {
+            algorithm.process(p_points, output_result);
+            return p_points.rows();
+        });
+
+        write_labels(output_result.clusters(), size, p_labels);
+        if (p_centers) {
+            write_rows(output_result.centers(), p_centers);
+        }
+
+        return output_result.clusters().size();
+    });
+}
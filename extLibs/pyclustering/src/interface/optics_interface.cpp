@@ -70,4 +70,31 @@ pyclustering_package * optics_algorithm(const pyclustering_package * const p_sam
     ((pyclustering_package **) package->data)[OPTICS_PACKAGE_INDEX_OPTICS_OBJECTS_REACHABILITY_DISTANCE] = package_reachability_distance;
 
     return package;
+}
+
+std::size_t optics_algorithm_view(const pyclustering_matrix * const p_sample,
+                                  const double p_radius,
+                                  const std::size_t p_minumum_neighbors,
+                                  const std::size_t p_amount_clusters,
+                                  std::size_t * const p_labels,
+                                  double * const p_reachability)
+{
+    return run_view_algorithm([&]() {
+        pyclustering::clst::optics solver(p_radius, p_minumum_neighbors, p_amount_clusters);
+
+        pyclustering::clst::optics_data output_result;
+        const std::size_t size = visit_matrix(*p_sample, [&solver, &output_result](const auto & p_points) {
+            solver.process(p_points, output_result);
+            return p_points.rows();
+        });
+
+        write_labels(output_result.clusters(), size, p_labels);
+        if (p_reachability) {
+            for (const auto & object : output_result.optics_objects()) {
+                p_reachability[object.m_index] = object.m_reachability_distance;
+            }
+        }
+
+        return output_result.clusters().size();
+    });
 }
\ No newline at end of file
@@ -0,0 +1,89 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include <pyclustering/interface/pyclustering_matrix.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+
+using namespace pyclustering::utils::metric;
+
+
+void check_matrix(const pyclustering_matrix & p_matrix) {
+    if ( (p_matrix.rows > 0) && (p_matrix.data == nullptr) ) {
+        throw std::invalid_argument("check_matrix() [" + std::to_string(__LINE__) + "]: matrix with '" + std::to_string(p_matrix.rows) + "' rows does not have data.");
+    }
+
+    if ( (p_matrix.rows > 1) && (p_matrix.stride < p_matrix.cols) ) {
+        throw std::invalid_argument("check_matrix() [" + std::to_string(__LINE__) + "]: stride '" + std::to_string(p_matrix.stride) + "' is less than amount of columns '" + std::to_string(p_matrix.cols) + "'.");
+    }
+
+    if ( (p_matrix.type != PYCLUSTERING_TYPE_DOUBLE) && (p_matrix.type != PYCLUSTERING_TYPE_FLOAT) ) {
+        throw std::invalid_argument("check_matrix() [" + std::to_string(__LINE__) + "]: type of matrix elements '" + std::to_string(p_matrix.type) + "' is not supported.");
+    }
+}
+
+
+points_view<double> get_matrix_view(const pyclustering_matrix & p_matrix, std::vector<double> & p_buffer) {
+    check_matrix(p_matrix);
+
+    switch(p_matrix.type) {
+    case PYCLUSTERING_TYPE_DOUBLE:
+        return points_view<double>((const double *) p_matrix.data, p_matrix.rows, p_matrix.cols, p_matrix.stride);
+
+    case PYCLUSTERING_TYPE_FLOAT: {
+        const float * const values = (const float *) p_matrix.data;
+
+        p_buffer.resize(p_matrix.rows * p_matrix.cols);
+        for (std::size_t i = 0; i < p_matrix.rows; i++) {
+            const float * const row = values + i * p_matrix.stride;
+            std::copy(row, row + p_matrix.cols, p_buffer.begin() + i * p_matrix.cols);
+        }
+
+        return points_view<double>(p_buffer.data(), p_matrix.rows, p_matrix.cols, p_matrix.cols);
+    }
+
+    default:
+        throw std::invalid_argument("get_matrix_view() [" + std::to_string(__LINE__) + "]: type of matrix elements '" + std::to_string(p_matrix.type) + "' is not supported.");
+    }
+}
+
+
+void write_labels(const pyclustering::clst::cluster_sequence & p_clusters, const std::size_t p_size, std::size_t * const p_labels) {
+    std::fill(p_labels, p_labels + p_size, PYCLUSTERING_NOISE_LABEL);
+
+    for (std::size_t index_cluster = 0; index_cluster < p_clusters.size(); index_cluster++) {
+        for (const auto index_object : p_clusters[index_cluster]) {
+            p_labels[index_object] = index_cluster;
+        }
+    }
+}
+
+
+void write_rows(const pyclustering::dataset & p_points, double * const p_buffer) {
+    double * position = p_buffer;
+    for (const auto & point : p_points) {
+        position = std::copy(point.begin(), point.end(), position);
+    }
+}
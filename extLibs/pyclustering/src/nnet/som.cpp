@@ -22,15 +22,22 @@
 
 #include <pyclustering/nnet/som.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <climits>
 #include <exception>
+#include <limits>
 #include <random>
+#include <stdexcept>
+
+#include <pyclustering/parallel/parallel.hpp>
 
 #include <pyclustering/utils/metric.hpp>
+#include <pyclustering/utils/metric_simd.hpp>
 
 
+using namespace pyclustering::parallel;
 using namespace pyclustering::utils::metric;
 
 
@@ -39,6 +46,27 @@ namespace pyclustering {
 namespace nnet {
 
 
+namespace {
+
+
+template <typename TypeRow>
+void calculate_bounds(const std::size_t p_amount, const std::size_t p_dimension, const TypeRow & p_row, std::vector<double> & p_minimum, std::vector<double> & p_maximum) {
+    p_minimum.assign(p_dimension, std::numeric_limits<double>::max());
+    p_maximum.assign(p_dimension, -std::numeric_limits<double>::max());
+
+    for (std::size_t i = 0; i < p_amount; i++) {
+        const auto * values = p_row(i);
+        for (std::size_t dim = 0; dim < p_dimension; dim++) {
+            p_minimum[dim] = std::min(p_minimum[dim], (double) values[dim]);
+            p_maximum[dim] = std::max(p_maximum[dim], (double) values[dim]);
+        }
+    }
+}
+
+
+}
+
+
 som_parameters & som_parameters::operator=(const som_parameters & p_other) {
     if (&p_other != this) {
         init_type = p_other.init_type;
@@ -203,25 +231,13 @@ void som::create_connections(const som_conn_type type) {
 }
 
 
-void som::create_initial_weights(const som_init_type type) {
-    size_t dimension = (*m_data)[0].size();
+void som::create_initial_weights(const som_init_type type, const std::vector<double> & p_minimum, const std::vector<double> & p_maximum) {
+    size_t dimension = p_minimum.size();
 
-    m_weights.resize(m_size, std::vector<double>(dimension, 0.0));
-
-    std::vector<double> maximum_value_dimension(dimension, -std::numeric_limits<double>::max());
-    std::vector<double> minimum_value_dimension(dimension, std::numeric_limits<double>::max());
-
-    for (size_t i = 0; i < m_data->size(); i++) {
-        for (size_t dim = 0; dim < dimension; dim++) {
-            if (maximum_value_dimension[dim] < (*m_data)[i][dim]) {
-                maximum_value_dimension[dim] = (*m_data)[i][dim];
-            }
+    m_weights.assign(m_size, std::vector<double>(dimension, 0.0));
 
-            if (minimum_value_dimension[dim] > (*m_data)[i][dim]) {
-                minimum_value_dimension[dim] = (*m_data)[i][dim];
-            }
-        }
-    }
+    const std::vector<double> & maximum_value_dimension = p_maximum;
+    const std::vector<double> & minimum_value_dimension = p_minimum;
 
     std::vector<double> width_value_dimension(dimension, 0);
     std::vector<double> center_value_dimension(dimension, 0);
@@ -315,11 +331,13 @@ void som::create_initial_weights(const som_init_type type) {
 
 
 size_t som::competition(const pattern & input_pattern) const {
+    const simd::kernel_set<double> & kernels = simd::get_kernels<double>();
+
     size_t index = 0;
-    double minimum = euclidean_distance_square(m_weights[0], input_pattern);
+    double minimum = kernels.euclidean_distance_square(m_weights[0].data(), input_pattern.data(), input_pattern.size());
 
     for (size_t i = 1; i < m_size; i++) {
-        double candidate = euclidean_distance_square(m_weights[i], input_pattern);
+        double candidate = kernels.euclidean_distance_square(m_weights[i].data(), input_pattern.data(), input_pattern.size());
         if (candidate < minimum) {
             index = i;
             minimum = candidate;
@@ -390,7 +408,9 @@ size_t som::train(const dataset & input_data, const size_t num_epochs, bool auto
     m_data = &input_data;
 
     /* create weights */
-    create_initial_weights(m_params.init_type);
+    std::vector<double> minimum, maximum;
+    calculate_bounds(input_data.size(), input_data[0].size(), [&input_data](const std::size_t p_index) { return input_data[p_index].data(); }, minimum, maximum);
+    create_initial_weights(m_params.init_type, minimum, maximum);
 
     size_t epouch = 1;
     for ( ; epouch < (m_epouchs + 1); epouch++) {
@@ -437,6 +457,215 @@ size_t som::train(const dataset & input_data, const size_t num_epochs, bool auto
 }
 
 
+std::size_t som::train_batch(const dataset & input_data, const size_t num_epochs, bool autostop) {
+    std::vector<double> buffer;
+    return train_batch(pack_points(input_data, buffer), num_epochs, autostop);
+}
+
+
+std::size_t som::train_batch(const points_view<double> & p_data, const size_t num_epochs, bool autostop) {
+    return train_view(p_data, num_epochs, autostop);
+}
+
+
+std::size_t som::train_batch(const points_view<float> & p_data, const size_t num_epochs, bool autostop) {
+    return train_view(p_data, num_epochs, autostop);
+}
+
+
+template <typename TypeValue>
+std::size_t som::train_view(const points_view<TypeValue> & p_data, const size_t num_epochs, bool autostop) {
+    for (size_t i = 0; i < m_capture_objects.size(); i++) {
+        m_capture_objects[i].clear();
+        m_awards[i] = 0;
+    }
+
+    m_epouchs = num_epochs;
+    m_data = nullptr;
+
+    if (p_data.rows() == 0) {
+        throw std::invalid_argument("Input data for SOM training is empty.");
+    }
+
+    std::vector<double> minimum, maximum;
+    calculate_bounds(p_data.rows(), p_data.cols(), [&p_data](const std::size_t p_index) { return p_data.row(p_index); }, minimum, maximum);
+    create_initial_weights(m_params.init_type, minimum, maximum);
+
+    std::vector<std::size_t> winners(p_data.rows());
+
+    size_t epouch = 1;
+    for ( ; epouch < (m_epouchs + 1); epouch++) {
+        m_local_radius = std::pow( ( m_params.init_radius * std::exp(-( (double) epouch / (double) m_epouchs)) ), 2);
+        m_learn_rate = m_params.init_learn_rate * std::exp(-( (double) epouch / (double) m_epouchs));
+
+        calculate_winners(p_data, winners);
+
+        /* winners are found before adaptation, as in online training */
+        if ( (autostop == true) || (epouch == m_epouchs) ) {
+            update_statistics(winners);
+        }
+
+        batch_adaptation(p_data, winners);
+
+        /* batch weights converge for every radius, so convergence is checked only when neighbors are not adapted anymore
+           (distance between neighbors is at least 1) */
+        if ( (autostop == true) && (m_local_radius < 1.0) ) {
+            double maximal_adaptation = calculate_maximal_adaptation();
+            if (maximal_adaptation < m_params.adaptation_threshold) {
+                return epouch;
+            }
+
+            for (size_t i = 0; i < m_weights.size(); i++) {
+                std::copy(m_weights[i].begin(), m_weights[i].end(), m_previous_weights[i].begin());
+            }
+        }
+    }
+
+    return epouch;
+}
+
+
+template <typename TypeValue>
+void som::calculate_winners(const points_view<TypeValue> & p_data, std::vector<std::size_t> & p_winners) const {
+    const simd::kernel_set<TypeValue> & kernels = simd::get_kernels<TypeValue>();
+    const std::size_t dimension = p_data.cols();
+
+    /* weights are packed in type of the patterns, so neurons are compared with the pattern by block kernel */
+    std::vector<TypeValue> weights(m_size * dimension);
+    for (std::size_t i = 0; i < m_size; i++) {
+        std::copy(m_weights[i].begin(), m_weights[i].end(), weights.begin() + i * dimension);
+    }
+
+    p_winners.resize(p_data.rows());
+    parallel_for(std::size_t(0), p_data.rows(), [this, &p_data, &p_winners, &weights, &kernels, dimension](const std::size_t p_index) {
+        const TypeValue * pattern = p_data.row(p_index);
+
+        std::size_t winner = 0;
+        double minimum = std::numeric_limits<double>::max();
+
+        std::size_t neuron = 0;
+        for (; neuron + simd::DOT_PRODUCT_BLOCK_SIZE <= m_size; neuron += simd::DOT_PRODUCT_BLOCK_SIZE) {
+            const TypeValue * others[simd::DOT_PRODUCT_BLOCK_SIZE] = {
+                weights.data() + neuron * dimension, weights.data() + (neuron + 1) * dimension,
+                weights.data() + (neuron + 2) * dimension, weights.data() + (neuron + 3) * dimension };
+
+            double distances[simd::DOT_PRODUCT_BLOCK_SIZE];
+            kernels.euclidean_distance_square_block(pattern, others, dimension, distances);
+
+            for (std::size_t k = 0; k < simd::DOT_PRODUCT_BLOCK_SIZE; k++) {
+                if (distances[k] < minimum) {
+                    minimum = distances[k];
+                    winner = neuron + k;
+                }
+            }
+        }
+
+        for (; neuron < m_size; neuron++) {
+            const double distance = kernels.euclidean_distance_square(pattern, weights.data() + neuron * dimension, dimension);
+            if (distance < minimum) {
+                minimum = distance;
+                winner = neuron;
+            }
+        }
+
+        p_winners[p_index] = winner;
+    });
+}
+
+
+template <typename TypeValue>
+void som::batch_adaptation(const points_view<TypeValue> & p_data, const std::vector<std::size_t> & p_winners) {
+    const std::size_t dimension = p_data.cols();
+
+    std::vector<std::size_t> amounts(m_size, 0);
+    for (const auto winner : p_winners) {
+        amounts[winner]++;
+    }
+
+    std::vector<std::size_t> offsets(m_size + 1, 0);
+    for (std::size_t i = 0; i < m_size; i++) {
+        offsets[i + 1] = offsets[i] + amounts[i];
+    }
+
+    std::vector<std::size_t> order(p_winners.size());
+    std::vector<std::size_t> positions(offsets.begin(), offsets.end() - 1);
+    for (std::size_t i = 0; i < p_winners.size(); i++) {
+        order[positions[p_winners[i]]++] = i;
+    }
+
+    /* sum of the patterns won by every neuron, neurons are summed independently */
+    std::vector<double> sums(m_size * dimension, 0.0);
+    parallel_for(std::size_t(0), m_size, [&p_data, &sums, &offsets, &order, dimension](const std::size_t p_neuron) {
+        double * sum = sums.data() + p_neuron * dimension;
+        for (std::size_t position = offsets[p_neuron]; position < offsets[p_neuron + 1]; position++) {
+            const TypeValue * pattern = p_data.row(order[position]);
+            for (std::size_t dim = 0; dim < dimension; dim++) {
+                sum[dim] += pattern[dim];
+            }
+        }
+    }, 1);
+
+    parallel_for(std::size_t(0), m_size, [this, &sums, &amounts, dimension](const std::size_t p_neuron) {
+        thread_local std::vector<double> numerator;
+        numerator.assign(dimension, 0.0);
+
+        double denominator = 0.0;
+        auto accumulate = [&denominator, &sums, &amounts, dimension](const std::size_t p_winner, const double p_influence) {
+            if (amounts[p_winner] == 0) {
+                return;
+            }
+
+            const double * sum = sums.data() + p_winner * dimension;
+            for (std::size_t dim = 0; dim < dimension; dim++) {
+                numerator[dim] += p_influence * sum[dim];
+            }
+
+            denominator += p_influence * (double) amounts[p_winner];
+        };
+
+        /* the same neighborhood and influence as in online adaptation */
+        if (m_conn_type == som_conn_type::SOM_FUNC_NEIGHBOR) {
+            for (std::size_t winner = 0; winner < m_size; winner++) {
+                const double distance = m_sqrt_distances[p_neuron][winner];
+                if (distance < m_local_radius) {
+                    accumulate(winner, std::exp( -( distance / (2.0 * m_local_radius) ) ));
+                }
+            }
+        }
+        else {
+            accumulate(p_neuron, 1.0);
+
+            for (const auto winner : m_neighbors[p_neuron]) {
+                const double distance = m_sqrt_distances[p_neuron][winner];
+                if (distance < m_local_radius) {
+                    accumulate(winner, std::exp( -( distance / (2.0 * m_local_radius) ) ));
+                }
+            }
+        }
+
+        if (denominator > 0.0) {
+            std::vector<double> & neuron_weight = m_weights[p_neuron];
+            for (std::size_t dim = 0; dim < dimension; dim++) {
+                neuron_weight[dim] = numerator[dim] / denominator;
+            }
+        }
+    }, 1);
+}
+
+
+void som::update_statistics(const std::vector<std::size_t> & p_winners) {
+    for (size_t i = 0; i < m_size; i++) {
+        m_awards[i] = 0;
+        m_capture_objects[i].clear();
+    }
+
+    for (std::size_t i = 0; i < p_winners.size(); i++) {
+        m_awards[p_winners[i]]++;
+        m_capture_objects[p_winners[i]].push_back(i);
+    }
+}
+
+
 void som::load(const dataset & p_weights, const som_award_sequence & p_awards, const som_gain_sequence & p_capture_objects) {
     if (p_weights.size() != m_size) {
         throw std::invalid_argument("Provided weights (" + std::to_string(p_weights.size()) + 
@@ -471,7 +700,7 @@ size_t som::simulate(const pattern & input_pattern) const {
 
 
 double som::calculate_maximal_adaptation() const {
-    size_t dimensions = (*m_data)[0].size();
+    size_t dimensions = m_weights[0].size();
     double maximal_adaptation = 0;
 
     for (size_t neuron_index = 0; neuron_index < m_size; neuron_index++) {
@@ -27,11 +27,14 @@
 #include <complex>
 #include <stdexcept>
 #include <chrono>
+#include <numeric>
+#include <algorithm>
 
 #include <pyclustering/container/adjacency_bit_matrix.hpp>
 #include <pyclustering/container/adjacency_connector.hpp>
 #include <pyclustering/container/adjacency_matrix.hpp>
 
+#include <pyclustering/differential/differ_factor.hpp>
 #include <pyclustering/differential/runge_kutta_4.hpp>
 #include <pyclustering/differential/runge_kutta_fehlberg_45.hpp>
 
@@ -59,6 +62,128 @@ namespace nnet {
 const std::size_t sync_network::MAXIMUM_MATRIX_REPRESENTATION_SIZE      = 4096;
 
 
+namespace {
+
+
+/* amount of terms that are summed by one task of the parallel reduction */
+constexpr std::size_t REDUCTION_BLOCK_SIZE = 1024;
+
+
+/**
+ *
+ * @brief   Sums terms [0, p_size) in parallel, sums of blocks are added in fixed order so result does not depend on
+ *           amount of threads.
+ *
+ */
+template <typename TypeTerm>
+double parallel_sum(const std::size_t p_size, std::vector<double> & p_partial_sums, const TypeTerm & p_term) {
+    const std::size_t amount_blocks = (p_size + REDUCTION_BLOCK_SIZE - 1) / REDUCTION_BLOCK_SIZE;
+    p_partial_sums.assign(amount_blocks, 0.0);
+
+    parallel_for(std::size_t(0), amount_blocks, [p_size, &p_partial_sums, &p_term](const std::size_t p_block) {
+        const std::size_t begin = p_block * REDUCTION_BLOCK_SIZE;
+        const std::size_t end = std::min(begin + REDUCTION_BLOCK_SIZE, p_size);
+
+        double sum = 0.0;
+        for (std::size_t index = begin; index < end; index++) {
+            sum += p_term(index);
+        }
+
+        p_partial_sums[p_block] = sum;
+    }, 1);
+
+    return std::accumulate(p_partial_sums.cbegin(), p_partial_sums.cend(), 0.0);
+}
+
+
+/**
+ *
+ * @brief   Solves scalar autonomous equation using classic Runge-Kutta method, follows 'runge_kutta_4'.
+ *
+ */
+template <typename TypeFunction>
+double integrate_runge_kutta_4(const TypeFunction & p_function, const double p_value, const double p_time_start, const double p_time_end, const std::size_t p_steps) {
+    const double step = (p_time_end - p_time_start) / (double) p_steps;
+
+    double value = p_value;
+    for (std::size_t i = 0; i < p_steps; i++) {
+        const double k1 = p_function(value) * step;
+        const double k2 = p_function(value + k1 / 2.0) * step;
+        const double k3 = p_function(value + k2 / 2.0) * step;
+        const double k4 = p_function(value + k3) * step;
+
+        value += (k1 + 2.0 * k2 + 2.0 * k3 + k4) / 6.0;
+    }
+
+    return value;
+}
+
+
+/**
+ *
+ * @brief   Solves scalar autonomous equation using Runge-Kutta-Fehlberg method, follows 'runge_kutta_fehlberg_45'.
+ *
+ */
+template <typename TypeFunction>
+double integrate_runge_kutta_fehlberg_45(const TypeFunction & p_function, const double p_value, const double p_time_start, const double p_time_end, const double p_tolerance) {
+    double h = (p_time_end - p_time_start) / 10.0;
+    const double hmin = h / 1000.0;
+    const double hmax = 1000.0 * h;
+
+    const double br = p_time_end - 0.00001 * std::abs(p_time_end);
+    const unsigned int iteration_limit = 300;
+
+    unsigned int iteration_counter = 0;
+
+    double time = p_time_start;
+    double value = p_value;
+
+    while (time < p_time_end) {
+        if ( (time + h) > br ) {
+            h = p_time_end - time;
+        }
+
+        const double k1 = h * p_function(value);
+        const double k2 = h * p_function(value + factor::B2 * k1);
+        const double k3 = h * p_function(value + factor::B3 * k1 + factor::C3 * k2);
+        const double k4 = h * p_function(value + factor::B4 * k1 + factor::C4 * k2 + factor::D4 * k3);
+        const double k5 = h * p_function(value + factor::B5 * k1 + factor::C5 * k2 + factor::D5 * k3 + factor::E5 * k4);
+        const double k6 = h * p_function(value + factor::B6 * k1 + factor::C6 * k2 + factor::D6 * k3 + factor::E6 * k4 + factor::F6 * k5);
+
+        const double err = std::abs(factor::R1 * k1 + factor::R3 * k3 + factor::R4 * k4 + factor::R5 * k5 + factor::R6 * k6);
+
+        if ( (err < p_tolerance) || (h < 2.0 * hmin) ) {
+            value += factor::N1 * k1 + factor::N3 * k3 + factor::N4 * k4 + factor::N5 * k5;
+            time = (time + h > br) ? p_time_end : time + h;
+
+            iteration_counter++;
+        }
+
+        double s = 0.0;
+        if (err != 0.0) {
+            s = 0.84 * std::pow( (p_tolerance * h / err), 0.25 );
+        }
+
+        if ( (s < 0.75) && (h > 2.0 * hmin) ) {
+            h = h / 2.0;
+        }
+
+        if ( (s > 1.5) && (h * 2.0 < hmax) ) {
+            h = 2.0 * h;
+        }
+
+        if (iteration_counter >= iteration_limit) {
+            break;
+        }
+    }
+
+    return value;
+}
+
+
+}
+
+
 
 double sync_ordering::calculate_sync_order(const std::vector<double> & p_phases) {
     phase_getter getter = [&p_phases](std::size_t index){ return p_phases[index]; };
@@ -74,15 +199,15 @@ double sync_ordering::calculate_sync_order(const std::vector<sync_oscillator> &
 
 template <class TypeContainer>
 double sync_ordering::calculate_sync_order_parameter(const TypeContainer & p_container, const phase_getter & p_getter) {
-    double exp_amount = 0.0;
-    double average_phase = 0.0;
+    std::vector<double> partial_sums;
 
-    for (std::size_t index = 0; index < p_container.size(); index++) {
-        const double phase = p_getter(index);
+    double exp_amount = parallel_sum(p_container.size(), partial_sums, [&p_getter](const std::size_t p_index) {
+        return std::exp( std::abs( std::complex<double>(0, 1) * p_getter(p_index) ) );
+    });
 
-        exp_amount += std::exp( std::abs( std::complex<double>(0, 1) * phase ) );
-        average_phase += phase;
-    }
+    double average_phase = parallel_sum(p_container.size(), partial_sums, [&p_getter](const std::size_t p_index) {
+        return p_getter(p_index);
+    });
 
     exp_amount /= p_container.size();
     average_phase = std::exp( std::abs( std::complex<double>(0, 1) * (average_phase / p_container.size()) ) );
@@ -105,22 +230,25 @@ double sync_ordering::calculate_local_sync_order(const std::shared_ptr<adjacency
 
 template <class TypeContainer>
 double sync_ordering::calculate_local_sync_order_parameter(const std::shared_ptr<adjacency_collection> & p_connections, const TypeContainer & p_container, const phase_getter & p_getter) {
-    double exp_amount = 0.0;
-    double number_neighbors = 0.0;
+    std::vector<double> partial_sums;
+    std::vector<std::size_t> amount_neighbors(p_container.size(), 0);
 
-    for (std::size_t i = 0; i < p_container.size(); i++) {
-        double phase = p_getter(i);
+    const double exp_amount = parallel_sum(p_container.size(), partial_sums, [&p_connections, &p_getter, &amount_neighbors](const std::size_t p_index) {
+        thread_local std::vector<std::size_t> neighbors;
+        p_connections->get_neighbors(p_index, neighbors);
 
-        std::vector<std::size_t> neighbors;
-        p_connections->get_neighbors(i, neighbors);
+        const double phase = p_getter(p_index);
 
+        double exp_sum = 0.0;
         for (auto & index_neighbor : neighbors) {
-            double phase_neighbor = p_getter(index_neighbor);
-            exp_amount += std::exp( -std::abs( phase_neighbor - phase ) );
+            exp_sum += std::exp( -std::abs( p_getter(index_neighbor) - phase ) );
         }
 
-        number_neighbors += static_cast<double>(neighbors.size());
-    }
+        amount_neighbors[p_index] = neighbors.size();
+        return exp_sum;
+    });
+
+    double number_neighbors = static_cast<double>(std::accumulate(amount_neighbors.cbegin(), amount_neighbors.cend(), std::size_t(0)));
 
     if (number_neighbors == 0.0) {
         number_neighbors = 1.0;
@@ -209,6 +337,67 @@ void sync_network::set_equation(equation<double> & solver) {
 }
 
 
+bool sync_network::create_coupling(sync_coupling & p_coupling) const {
+    create_coupling_structure(true, p_coupling);
+
+    p_coupling.m_weights.clear();
+    p_coupling.m_scale.assign(size(), weight / static_cast<double>(size()));
+    p_coupling.m_frequency.resize(size());
+
+    for (std::size_t index = 0; index < size(); index++) {
+        p_coupling.m_frequency[index] = m_oscillators[index].frequency;
+    }
+
+    return true;
+}
+
+
+void sync_network::create_coupling_structure(const bool p_allow_all_to_all, sync_coupling & p_coupling) const {
+    const std::size_t amount = size();
+
+    p_coupling.m_offsets.assign(amount + 1, 0);
+    p_coupling.m_neighbors.clear();
+    p_coupling.m_all_to_all = false;
+
+    parallel_for(std::size_t(0), amount, [this, &p_coupling](const std::size_t p_index) {
+        thread_local std::vector<std::size_t> neighbors;
+        m_connections->get_neighbors(p_index, neighbors);
+
+        p_coupling.m_offsets[p_index + 1] = neighbors.size();
+    });
+
+    std::partial_sum(p_coupling.m_offsets.begin(), p_coupling.m_offsets.end(), p_coupling.m_offsets.begin());
+
+    /* dense coupling is evaluated through total sums, lists of all-to-all structure are not needed */
+    if (p_allow_all_to_all && (amount > 1) && (p_coupling.m_offsets.back() == amount * (amount - 1))) {
+        p_coupling.m_all_to_all = true;
+        return;
+    }
+
+    p_coupling.m_neighbors.resize(p_coupling.m_offsets.back());
+
+    parallel_for(std::size_t(0), amount, [this, &p_coupling](const std::size_t p_index) {
+        thread_local std::vector<std::size_t> neighbors;
+        m_connections->get_neighbors(p_index, neighbors);
+
+        std::copy(neighbors.cbegin(), neighbors.cend(), p_coupling.m_neighbors.begin() + p_coupling.m_offsets[p_index]);
+    });
+}
+
+
+void sync_network::prepare_integrator() {
+    m_coupling_enabled = create_coupling(m_flat_coupling);
+    if (!m_coupling_enabled) {
+        return;
+    }
+
+    m_sin_phase.resize(size());
+    m_cos_phase.resize(size());
+    m_sin_coupling.resize(size());
+    m_cos_coupling.resize(size());
+}
+
+
 void sync_network::phase_kuramoto_equation(const double t, const differ_state<double> & inputs, const differ_extra<void *> & argv, differ_state<double> & outputs) const {
     outputs.resize(1);
     outputs[0] = phase_kuramoto(t, inputs[0], argv);
@@ -234,6 +423,8 @@ double sync_network::phase_kuramoto(const double t, const double teta, const std
 void sync_network::simulate_static(const std::size_t steps, const double time, const solve_type solver, const bool collect_dynamic, sync_dynamic & output_dynamic) {
     output_dynamic.clear();
 
+    prepare_integrator();
+
     const double step = time / (double) steps;
     const double int_step = step / 10.0;
 
@@ -253,9 +444,11 @@ void sync_network::simulate_static(const std::size_t steps, const double time, c
 void sync_network::simulate_dynamic(const double order, const double step, const solve_type solver, const bool collect_dynamic, sync_dynamic & output_dynamic) {
     output_dynamic.clear();
 
+    prepare_integrator();
+
     store_dynamic(0, collect_dynamic, output_dynamic);     /* store initial state */
 
-    double current_order = sync_local_order();
+    double current_order = m_coupling_enabled ? calculate_local_order_flat() : sync_local_order();
 
     double integration_step = step / 10.0;
 
@@ -265,7 +458,7 @@ void sync_network::simulate_dynamic(const double order, const double step, const
         store_dynamic(time_counter, collect_dynamic, output_dynamic);
 
         double previous_order = current_order;
-        current_order = sync_local_order();
+        current_order = m_coupling_enabled ? calculate_local_order_flat() : sync_local_order();
 
         if (std::abs(current_order - previous_order) < 0.000001) {
             // std::cout << "Warning: sync_network::simulate_dynamic - simulation is aborted due to low level of convergence rate (order = " << current_order << ")." << std::endl;
@@ -294,6 +487,11 @@ void sync_network::store_dynamic(const double time, const bool collect_dynamic,
 
 
 void sync_network::calculate_phases(const solve_type solver, const double t, const double step, const double int_step) {
+    if (m_coupling_enabled) {
+        calculate_phases_flat(solver, t, step, int_step);
+        return;
+    }
+
     std::vector<double> next_phases(size(), 0.0);
 
     parallel_for(std::size_t(0), size(), [this, solver, t, step, int_step, &next_phases](const std::size_t p_index) {
@@ -351,6 +549,122 @@ void sync_network::calculate_phase(const solve_type solver,
 }
 
 
+void sync_network::calculate_phases_flat(const solve_type solver, const double t, const double step, const double int_step) {
+    if ( (solver != solve_type::FORWARD_EULER) && (solver != solve_type::RUNGE_KUTTA_4) && (solver != solve_type::RUNGE_KUTTA_FEHLBERG_45) ) {
+        throw std::runtime_error("Unknown type of solver");
+    }
+
+    const std::size_t amount = size();
+
+    parallel_for(std::size_t(0), amount, [this](const std::size_t p_index) {
+        const double phase = m_oscillators[p_index].phase;
+
+        m_sin_phase[p_index] = std::sin(phase);
+        m_cos_phase[p_index] = std::cos(phase);
+    });
+
+    /* sum(w_ij * sin(phase_j - phase_i)) = cos(phase_i) * sum(w_ij * sin(phase_j)) - sin(phase_i) * sum(w_ij * cos(phase_j)) */
+    if (m_flat_coupling.m_all_to_all) {
+        const double sin_total = parallel_sum(amount, m_partial_sums, [this](const std::size_t p_index) { return m_sin_phase[p_index]; });
+        const double cos_total = parallel_sum(amount, m_partial_sums, [this](const std::size_t p_index) { return m_cos_phase[p_index]; });
+
+        for (std::size_t index = 0; index < amount; index++) {
+            m_sin_coupling[index] = sin_total - m_sin_phase[index];
+            m_cos_coupling[index] = cos_total - m_cos_phase[index];
+        }
+    }
+    else {
+        parallel_for(std::size_t(0), amount, [this](const std::size_t p_index) {
+            const std::size_t begin = m_flat_coupling.m_offsets[p_index];
+            const std::size_t end = m_flat_coupling.m_offsets[p_index + 1];
+            const std::size_t * neighbors = m_flat_coupling.m_neighbors.data();
+
+            double sin_sum = 0.0;
+            double cos_sum = 0.0;
+
+            if (m_flat_coupling.m_weights.empty()) {
+                for (std::size_t k = begin; k < end; k++) {
+                    sin_sum += m_sin_phase[neighbors[k]];
+                    cos_sum += m_cos_phase[neighbors[k]];
+                }
+            }
+            else {
+                const double * weights = m_flat_coupling.m_weights.data();
+                for (std::size_t k = begin; k < end; k++) {
+                    sin_sum += weights[k] * m_sin_phase[neighbors[k]];
+                    cos_sum += weights[k] * m_cos_phase[neighbors[k]];
+                }
+            }
+
+            m_sin_coupling[p_index] = sin_sum;
+            m_cos_coupling[p_index] = cos_sum;
+        });
+    }
+
+    const std::size_t number_int_steps = (std::size_t) (step / int_step);
+
+    parallel_for(std::size_t(0), amount, [this, solver, t, step, number_int_steps](const std::size_t p_index) {
+        const double frequency = m_flat_coupling.m_frequency[p_index];
+        const double scale = m_flat_coupling.m_scale[p_index];
+        const double sin_coupling = m_sin_coupling[p_index];
+        const double cos_coupling = m_cos_coupling[p_index];
+
+        auto kuramoto = [frequency, scale, sin_coupling, cos_coupling](const double p_phase) {
+            return frequency + scale * (std::cos(p_phase) * sin_coupling - std::sin(p_phase) * cos_coupling);
+        };
+
+        const double phase = m_oscillators[p_index].phase;
+
+        double result = 0.0;
+        switch(solver) {
+            case solve_type::FORWARD_EULER:
+                result = phase + kuramoto(phase);
+                break;
+            case solve_type::RUNGE_KUTTA_4:
+                result = integrate_runge_kutta_4(kuramoto, phase, t, t + step, number_int_steps);
+                break;
+            default:
+                result = integrate_runge_kutta_fehlberg_45(kuramoto, phase, t, t + step, 0.00001);
+                break;
+        }
+
+        m_oscillators[p_index].phase = phase_normalization(result);
+    });
+}
+
+
+double sync_network::calculate_local_order_flat() {
+    const std::size_t amount = size();
+
+    const double exp_amount = parallel_sum(amount, m_partial_sums, [this, amount](const std::size_t p_index) {
+        const double phase = m_oscillators[p_index].phase;
+
+        double exp_sum = 0.0;
+        if (m_flat_coupling.m_all_to_all) {
+            for (std::size_t k = 0; k < amount; k++) {
+                if (k != p_index) {
+                    exp_sum += std::exp( -std::abs( m_oscillators[k].phase - phase ) );
+                }
+            }
+        }
+        else {
+            for (std::size_t k = m_flat_coupling.m_offsets[p_index]; k < m_flat_coupling.m_offsets[p_index + 1]; k++) {
+                exp_sum += std::exp( -std::abs( m_oscillators[m_flat_coupling.m_neighbors[k]].phase - phase ) );
+            }
+        }
+
+        return exp_sum;
+    });
+
+    double number_neighbors = static_cast<double>(m_flat_coupling.m_offsets.back());
+    if (number_neighbors == 0.0) {
+        number_neighbors = 1.0;
+    }
+
+    return exp_amount / number_neighbors;
+}
+
+
 double sync_network::phase_normalization(const double teta) const {
     double norm_teta = teta;
 
@@ -219,6 +219,12 @@ void syncpr::phase_kuramoto_equation(const double t, const differ_state<double>
 }
 
 
+bool syncpr::create_coupling(sync_coupling & p_coupling) const {
+    (void) p_coupling;
+    return false;   /* pattern terms are not expressed by the Kuramoto coupling, the generic solver is used */
+}
+
+
 void syncpr::validate_pattern(const syncpr_pattern & sample) const {
     if (sample.size() != size()) {
         throw syncpr_invalid_pattern("invalid size of the pattern, it should be the same as network size");
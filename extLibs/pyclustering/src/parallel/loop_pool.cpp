@@ -0,0 +1,191 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include <pyclustering/parallel/loop_pool.hpp>
+
+#include <algorithm>
+
+
+namespace pyclustering {
+
+namespace parallel {
+
+
+const std::size_t loop_pool::CHUNKS_PER_THREAD = 4;
+
+
+loop_pool::loop_pool(const std::size_t p_amount_threads) {
+    start(p_amount_threads);
+}
+
+
+loop_pool::~loop_pool() {
+    stop();
+}
+
+
+loop_pool & loop_pool::get_instance() {
+    static loop_pool pool(std::max<std::size_t>(std::thread::hardware_concurrency(), 1));
+    return pool;
+}
+
+
+void loop_pool::execute(const std::size_t p_amount_chunks, const chunk_proc & p_chunk) {
+    if (p_amount_chunks == 0) {
+        return;
+    }
+
+    if (m_workers.empty() || (p_amount_chunks == 1)) {
+        for (std::size_t index_chunk = 0; index_chunk < p_amount_chunks; index_chunk++) {
+            p_chunk(index_chunk);
+        }
+
+        return;
+    }
+
+    loop_job_ptr job = std::make_shared<loop_job>();
+    job->m_chunk = &p_chunk;
+    job->m_amount = p_amount_chunks;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_jobs.push_back(job);
+    }
+
+    m_job_available.notify_all();
+
+    /* caller executes chunks too, so the loop is finished even if all workers are busy */
+    run_chunks(*job);
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        auto position = std::find(m_jobs.begin(), m_jobs.end(), job);
+        if (position != m_jobs.end()) {
+            m_jobs.erase(position);
+        }
+
+        m_job_done.wait(lock, [&job]() { return job->m_done.load() == job->m_amount; });
+    }
+
+    if (job->m_error) {
+        std::rethrow_exception(job->m_error);
+    }
+}
+
+
+void loop_pool::set_amount_threads(const std::size_t p_amount_threads) {
+    stop();
+    start(p_amount_threads);
+}
+
+
+std::size_t loop_pool::get_amount_threads() const {
+    return m_workers.size() + 1;
+}
+
+
+std::size_t loop_pool::get_default_grain(const std::size_t p_amount_iterations) const {
+    const std::size_t amount_chunks = get_amount_threads() * CHUNKS_PER_THREAD;
+    return std::max<std::size_t>(p_amount_iterations / amount_chunks, 1);
+}
+
+
+void loop_pool::start(const std::size_t p_amount_threads) {
+    m_stop = false;
+
+    for (std::size_t i = 1; i < p_amount_threads; i++) {
+        m_workers.emplace_back(&loop_pool::work, this);
+    }
+}
+
+
+void loop_pool::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+
+    m_job_available.notify_all();
+
+    for (auto & worker : m_workers) {
+        worker.join();
+    }
+
+    m_workers.clear();
+}
+
+
+void loop_pool::work() {
+    while (true) {
+        loop_job_ptr job = nullptr;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_job_available.wait(lock, [this]() { return m_stop || !m_jobs.empty(); });
+
+            if (m_stop) {
+                return;
+            }
+
+            job = m_jobs.front();
+            if (job->m_next.load() >= job->m_amount) {
+                m_jobs.pop_front();     /* all chunks are claimed, job is finished by threads that claimed them */
+                continue;
+            }
+        }
+
+        run_chunks(*job);
+    }
+}
+
+
+void loop_pool::run_chunks(loop_job & p_job) {
+    while (true) {
+        const std::size_t index_chunk = p_job.m_next.fetch_add(1);
+        if (index_chunk >= p_job.m_amount) {
+            return;
+        }
+
+        try {
+            (*p_job.m_chunk)(index_chunk);
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(p_job.m_error_mutex);
+            if (!p_job.m_error) {
+                p_job.m_error = std::current_exception();
+            }
+        }
+
+        /* the last chunk wakes up the thread that runs the loop */
+        if (p_job.m_done.fetch_add(1) + 1 == p_job.m_amount) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_job_done.notify_all();
+        }
+    }
+}
+
+
+}
+
+}
@@ -0,0 +1,249 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include <pyclustering/utils/distance_matrix.hpp>
+
+#include <pyclustering/parallel/parallel.hpp>
+
+#include <cmath>
+#include <limits>
+#include <utility>
+
+
+using namespace pyclustering::parallel;
+using namespace pyclustering::utils::metric::simd;
+
+
+namespace pyclustering {
+
+namespace utils {
+
+namespace metric {
+
+
+/* Tile of 64 x 64 distances keeps 128 points in L2 cache for the typical feature vector sizes */
+static const std::size_t DISTANCE_TILE_SIZE = 64;
+
+
+template <typename TypeValue>
+static distance_kernel<TypeValue> get_distance_kernel(const kernel_set<TypeValue> & p_kernels, const distance_type p_type) {
+    switch(p_type) {
+    case distance_type::MANHATTAN:
+        return p_kernels.manhattan_distance;
+    case distance_type::CHEBYSHEV:
+        return p_kernels.chebyshev_distance;
+    case distance_type::CANBERRA:
+        return p_kernels.canberra_distance;
+    case distance_type::CHI_SQUARE:
+        return p_kernels.chi_square_distance;
+    default:
+        return p_kernels.euclidean_distance_square;
+    }
+}
+
+
+template <typename TypeValue>
+static void compute_euclidean_tile(const points_view<TypeValue> & p_points, const kernel_set<TypeValue> & p_kernels,
+    const std::vector<double> & p_norms, const bool p_square, const distance_tile & p_tile, double * p_values)
+{
+    const auto finish = [p_square](const double p_distance) {
+        /* cancellation can produce small negative values for (nearly) identical points */
+        const double distance = std::max(p_distance, 0.0);
+        return p_square ? distance : std::sqrt(distance);
+    };
+
+    for (std::size_t i = p_tile.m_row_begin; i < p_tile.m_row_end; i++) {
+        const TypeValue * point = p_points.row(i);
+        double * output = p_values + (i - p_tile.m_row_begin) * p_tile.m_stride;
+
+        std::size_t j = p_tile.first_column(i);
+        for (; j + DOT_PRODUCT_BLOCK_SIZE <= p_tile.m_col_end; j += DOT_PRODUCT_BLOCK_SIZE) {
+            const TypeValue * others[DOT_PRODUCT_BLOCK_SIZE] = { p_points.row(j), p_points.row(j + 1), p_points.row(j + 2), p_points.row(j + 3) };
+
+            double products[DOT_PRODUCT_BLOCK_SIZE];
+            p_kernels.dot_product_block(point, others, p_points.cols(), products);
+
+            for (std::size_t k = 0; k < DOT_PRODUCT_BLOCK_SIZE; k++) {
+                output[j + k - p_tile.m_col_begin] = finish(p_norms[i] + p_norms[j + k] - 2.0 * products[k]);
+            }
+        }
+
+        for (; j < p_tile.m_col_end; j++) {
+            output[j - p_tile.m_col_begin] = finish(p_norms[i] + p_norms[j] - 2.0 * p_kernels.dot_product(point, p_points.row(j), p_points.cols()));
+        }
+    }
+}
+
+
+template <typename TypeValue>
+static void compute_metric_tile(const points_view<TypeValue> & p_points, const distance_kernel<TypeValue> p_kernel,
+    const distance_tile & p_tile, double * p_values)
+{
+    for (std::size_t i = p_tile.m_row_begin; i < p_tile.m_row_end; i++) {
+        const TypeValue * point = p_points.row(i);
+        double * output = p_values + (i - p_tile.m_row_begin) * p_tile.m_stride;
+
+        for (std::size_t j = p_tile.first_column(i); j < p_tile.m_col_end; j++) {
+            output[j - p_tile.m_col_begin] = p_kernel(point, p_points.row(j), p_points.cols());
+        }
+    }
+}
+
+
+template <typename TypeValue>
+void for_each_distance_tile(const points_view<TypeValue> & p_points, const distance_type p_type, const distance_tile_handler & p_handler) {
+    const std::size_t amount = p_points.rows();
+    if (amount < 2) {
+        return;
+    }
+
+    const kernel_set<TypeValue> & kernels = get_kernels<TypeValue>();
+    const bool euclidean = (p_type == distance_type::EUCLIDEAN) || (p_type == distance_type::EUCLIDEAN_SQUARE);
+
+    std::vector<double> norms;
+    if (euclidean) {
+        norms.resize(amount);
+        parallel_for(std::size_t(0), amount, [&p_points, &kernels, &norms](const std::size_t p_index) {
+            norms[p_index] = kernels.dot_product(p_points.row(p_index), p_points.row(p_index), p_points.cols());
+        });
+    }
+
+    /* every tile of the upper triangle has the same cost (except diagonal ones), so equal chunks of the list are balanced */
+    const std::size_t blocks = (amount + DISTANCE_TILE_SIZE - 1) / DISTANCE_TILE_SIZE;
+    std::vector<std::pair<std::size_t, std::size_t>> tiles;
+    tiles.reserve(blocks * (blocks + 1) / 2);
+    for (std::size_t row_block = 0; row_block < blocks; row_block++) {
+        for (std::size_t col_block = row_block; col_block < blocks; col_block++) {
+            tiles.emplace_back(row_block, col_block);
+        }
+    }
+
+    const distance_kernel<TypeValue> kernel = get_distance_kernel(kernels, p_type);
+    const bool square = (p_type != distance_type::EUCLIDEAN);
+
+    parallel_for(std::size_t(0), tiles.size(), [&](const std::size_t p_index) {
+        thread_local std::vector<double> values;
+        values.resize(DISTANCE_TILE_SIZE * DISTANCE_TILE_SIZE);
+
+        distance_tile tile;
+        tile.m_row_begin = tiles[p_index].first * DISTANCE_TILE_SIZE;
+        tile.m_row_end = std::min(tile.m_row_begin + DISTANCE_TILE_SIZE, amount);
+        tile.m_col_begin = tiles[p_index].second * DISTANCE_TILE_SIZE;
+        tile.m_col_end = std::min(tile.m_col_begin + DISTANCE_TILE_SIZE, amount);
+        tile.m_values = values.data();
+        tile.m_stride = DISTANCE_TILE_SIZE;
+
+        if (euclidean) {
+            compute_euclidean_tile(p_points, kernels, norms, square, tile, values.data());
+        }
+        else {
+            compute_metric_tile(p_points, kernel, tile, values.data());
+        }
+
+        p_handler(tile);
+    });
+}
+
+
+template void for_each_distance_tile<double>(const points_view<double> &, const distance_type, const distance_tile_handler &);
+
+template void for_each_distance_tile<float>(const points_view<float> &, const distance_type, const distance_tile_handler &);
+
+
+template <typename TypeValue>
+std::size_t find_closest_point(const TypeValue * p_point, const points_view<TypeValue> & p_points, double * p_distance) {
+    const kernel_set<TypeValue> & kernels = get_kernels<TypeValue>();
+
+    std::size_t closest = 0;
+    double closest_distance = std::numeric_limits<double>::max();
+
+    std::size_t index = 0;
+    for (; index + DOT_PRODUCT_BLOCK_SIZE <= p_points.rows(); index += DOT_PRODUCT_BLOCK_SIZE) {
+        const TypeValue * others[DOT_PRODUCT_BLOCK_SIZE] = { p_points.row(index), p_points.row(index + 1), p_points.row(index + 2), p_points.row(index + 3) };
+
+        double distances[DOT_PRODUCT_BLOCK_SIZE];
+        kernels.euclidean_distance_square_block(p_point, others, p_points.cols(), distances);
+
+        for (std::size_t k = 0; k < DOT_PRODUCT_BLOCK_SIZE; k++) {
+            if (distances[k] < closest_distance) {
+                closest_distance = distances[k];
+                closest = index + k;
+            }
+        }
+    }
+
+    for (; index < p_points.rows(); index++) {
+        const double distance = kernels.euclidean_distance_square(p_point, p_points.row(index), p_points.cols());
+        if (distance < closest_distance) {
+            closest_distance = distance;
+            closest = index;
+        }
+    }
+
+    if (p_distance != nullptr) {
+        *p_distance = closest_distance;
+    }
+
+    return closest;
+}
+
+
+template std::size_t find_closest_point<double>(const double *, const points_view<double> &, double *);
+
+template std::size_t find_closest_point<float>(const float *, const points_view<float> &, double *);
+
+
+points_view<double> pack_points(const dataset & p_points, std::vector<double> & p_buffer) {
+    const std::size_t dimension = p_points.empty() ? 0 : p_points.front().size();
+
+    p_buffer.resize(p_points.size() * dimension);
+    for (std::size_t i = 0; i < p_points.size(); i++) {
+        std::copy(p_points[i].begin(), p_points[i].end(), p_buffer.begin() + i * dimension);
+    }
+
+    return points_view<double>(p_buffer.data(), p_points.size(), dimension, dimension);
+}
+
+
+void compute_distance_matrix(const dataset & p_points, const distance_type p_type, dataset & p_matrix) {
+    std::vector<double> buffer;
+    const points_view<double> points = pack_points(p_points, buffer);
+
+    p_matrix = dataset(p_points.size(), point(p_points.size(), 0.0));
+    for_each_distance_tile(points, p_type, [&p_matrix](const distance_tile & p_tile) {
+        for (std::size_t i = p_tile.m_row_begin; i < p_tile.m_row_end; i++) {
+            for (std::size_t j = p_tile.first_column(i); j < p_tile.m_col_end; j++) {
+                const double distance = p_tile(i, j);
+                p_matrix[i][j] = distance;
+                p_matrix[j][i] = distance;
+            }
+        }
+    });
+}
+
+
+}
+
+}
+
+}
@@ -0,0 +1,133 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include "metric_kernels.hpp"
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
+
+namespace pyclustering {
+
+namespace utils {
+
+namespace metric {
+
+namespace simd {
+
+
+#if defined(__AVX2__) && defined(__FMA__)
+
+
+namespace {
+
+
+struct avx2_double {
+    using value_type = double;
+    using reg = __m256d;
+    static constexpr std::size_t width = 4;
+
+    static reg zero() { return _mm256_setzero_pd(); }
+    static reg load(const double * p_data) { return _mm256_loadu_pd(p_data); }
+    static reg add(const reg p_a, const reg p_b) { return _mm256_add_pd(p_a, p_b); }
+    static reg sub(const reg p_a, const reg p_b) { return _mm256_sub_pd(p_a, p_b); }
+    static reg mul_add(const reg p_a, const reg p_b, const reg p_c) { return _mm256_fmadd_pd(p_a, p_b, p_c); }
+    static reg abs(const reg p_a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), p_a); }
+    static reg max(const reg p_a, const reg p_b) { return _mm256_max_pd(p_a, p_b); }
+
+    static reg safe_div(const reg p_a, const reg p_b) {
+        return _mm256_and_pd(_mm256_div_pd(p_a, p_b), _mm256_cmp_pd(p_b, _mm256_setzero_pd(), _CMP_NEQ_UQ));
+    }
+
+    static double reduce_add(const reg p_a) {
+        const __m128d pairs = _mm_add_pd(_mm256_castpd256_pd128(p_a), _mm256_extractf128_pd(p_a, 1));
+        return _mm_cvtsd_f64(_mm_add_sd(pairs, _mm_unpackhi_pd(pairs, pairs)));
+    }
+
+    static double reduce_max(const reg p_a) {
+        const __m128d pairs = _mm_max_pd(_mm256_castpd256_pd128(p_a), _mm256_extractf128_pd(p_a, 1));
+        return _mm_cvtsd_f64(_mm_max_sd(pairs, _mm_unpackhi_pd(pairs, pairs)));
+    }
+};
+
+
+struct avx2_float {
+    using value_type = float;
+    using reg = __m256;
+    static constexpr std::size_t width = 8;
+
+    static reg zero() { return _mm256_setzero_ps(); }
+    static reg load(const float * p_data) { return _mm256_loadu_ps(p_data); }
+    static reg add(const reg p_a, const reg p_b) { return _mm256_add_ps(p_a, p_b); }
+    static reg sub(const reg p_a, const reg p_b) { return _mm256_sub_ps(p_a, p_b); }
+    static reg mul_add(const reg p_a, const reg p_b, const reg p_c) { return _mm256_fmadd_ps(p_a, p_b, p_c); }
+    static reg abs(const reg p_a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), p_a); }
+    static reg max(const reg p_a, const reg p_b) { return _mm256_max_ps(p_a, p_b); }
+
+    static reg safe_div(const reg p_a, const reg p_b) {
+        return _mm256_and_ps(_mm256_div_ps(p_a, p_b), _mm256_cmp_ps(p_b, _mm256_setzero_ps(), _CMP_NEQ_UQ));
+    }
+
+    static double reduce_add(const reg p_a) {
+        __m128 values = _mm_add_ps(_mm256_castps256_ps128(p_a), _mm256_extractf128_ps(p_a, 1));
+        values = _mm_add_ps(values, _mm_movehl_ps(values, values));
+        return _mm_cvtss_f32(_mm_add_ss(values, _mm_shuffle_ps(values, values, 1)));
+    }
+
+    static double reduce_max(const reg p_a) {
+        __m128 values = _mm_max_ps(_mm256_castps256_ps128(p_a), _mm256_extractf128_ps(p_a, 1));
+        values = _mm_max_ps(values, _mm_movehl_ps(values, values));
+        return _mm_cvtss_f32(_mm_max_ss(values, _mm_shuffle_ps(values, values, 1)));
+    }
+};
+
+
+}
+
+
+bool load_avx2_kernels(kernel_set<double> & p_double_kernels, kernel_set<float> & p_float_kernels) {
+    fill_kernel_set<avx2_double>(p_double_kernels, instruction_set::AVX2);
+    fill_kernel_set<avx2_float>(p_float_kernels, instruction_set::AVX2);
+    return true;
+}
+
+
+#else
+
+
+bool load_avx2_kernels(kernel_set<double> &, kernel_set<float> &) {
+    return false;
+}
+
+
+#endif
+
+
+}
+
+}
+
+}
+
+}
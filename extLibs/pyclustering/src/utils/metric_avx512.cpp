@@ -0,0 +1,122 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include "metric_kernels.hpp"
+
+#if defined(__AVX512F__)
+/* GCC reports the undefined registers used inside of the AVX-512 reduction intrinsics as uninitialized */
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#include <immintrin.h>
+#endif
+
+
+namespace pyclustering {
+
+namespace utils {
+
+namespace metric {
+
+namespace simd {
+
+
+#if defined(__AVX512F__)
+
+
+namespace {
+
+
+struct avx512_double {
+    using value_type = double;
+    using reg = __m512d;
+    static constexpr std::size_t width = 8;
+
+    static reg zero() { return _mm512_setzero_pd(); }
+    static reg load(const double * p_data) { return _mm512_loadu_pd(p_data); }
+    static reg add(const reg p_a, const reg p_b) { return _mm512_add_pd(p_a, p_b); }
+    static reg sub(const reg p_a, const reg p_b) { return _mm512_sub_pd(p_a, p_b); }
+    static reg mul_add(const reg p_a, const reg p_b, const reg p_c) { return _mm512_fmadd_pd(p_a, p_b, p_c); }
+    static reg abs(const reg p_a) { return _mm512_abs_pd(p_a); }
+    static reg max(const reg p_a, const reg p_b) { return _mm512_max_pd(p_a, p_b); }
+
+    static reg safe_div(const reg p_a, const reg p_b) {
+        return _mm512_maskz_div_pd(_mm512_cmp_pd_mask(p_b, _mm512_setzero_pd(), _CMP_NEQ_UQ), p_a, p_b);
+    }
+
+    static double reduce_add(const reg p_a) { return _mm512_reduce_add_pd(p_a); }
+    static double reduce_max(const reg p_a) { return _mm512_reduce_max_pd(p_a); }
+};
+
+
+struct avx512_float {
+    using value_type = float;
+    using reg = __m512;
+    static constexpr std::size_t width = 16;
+
+    static reg zero() { return _mm512_setzero_ps(); }
+    static reg load(const float * p_data) { return _mm512_loadu_ps(p_data); }
+    static reg add(const reg p_a, const reg p_b) { return _mm512_add_ps(p_a, p_b); }
+    static reg sub(const reg p_a, const reg p_b) { return _mm512_sub_ps(p_a, p_b); }
+    static reg mul_add(const reg p_a, const reg p_b, const reg p_c) { return _mm512_fmadd_ps(p_a, p_b, p_c); }
+    static reg abs(const reg p_a) { return _mm512_abs_ps(p_a); }
+    static reg max(const reg p_a, const reg p_b) { return _mm512_max_ps(p_a, p_b); }
+
+    static reg safe_div(const reg p_a, const reg p_b) {
+        return _mm512_maskz_div_ps(_mm512_cmp_ps_mask(p_b, _mm512_setzero_ps(), _CMP_NEQ_UQ), p_a, p_b);
+    }
+
+    static double reduce_add(const reg p_a) { return _mm512_reduce_add_ps(p_a); }
+    static double reduce_max(const reg p_a) { return _mm512_reduce_max_ps(p_a); }
+};
+
+
+}
+
+
+bool load_avx512_kernels(kernel_set<double> & p_double_kernels, kernel_set<float> & p_float_kernels) {
+    fill_kernel_set<avx512_double>(p_double_kernels, instruction_set::AVX512);
+    fill_kernel_set<avx512_float>(p_float_kernels, instruction_set::AVX512);
+    return true;
+}
+
+
+#else
+
+
+bool load_avx512_kernels(kernel_set<double> &, kernel_set<float> &) {
+    return false;
+}
+
+
+#endif
+
+
+}
+
+}
+
+}
+
+}
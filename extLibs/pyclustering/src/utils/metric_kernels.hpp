@@ -0,0 +1,344 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#pragma once
+
+
+/*
+ * Generic distance kernels that are instantiated by every instruction set translation unit.
+ *
+ * Translation units are compiled with different target flags, therefore everything here has internal linkage
+ * and standard library templates are not used - otherwise the linker could merge an instantiation that contains
+ * wide instructions into the code that runs on processors without them.
+ *
+ * Vector traits provide: value_type, reg, width, zero, load, add, sub, mul_add (a * b + c), abs, max,
+ * safe_div (0 where divider is 0), reduce_add and reduce_max.
+ */
+
+
+#include <pyclustering/utils/metric_simd.hpp>
+
+
+namespace pyclustering {
+
+namespace utils {
+
+namespace metric {
+
+namespace simd {
+
+
+bool load_sse2_kernels(kernel_set<double> & p_double_kernels, kernel_set<float> & p_float_kernels);
+
+bool load_avx2_kernels(kernel_set<double> & p_double_kernels, kernel_set<float> & p_float_kernels);
+
+bool load_avx512_kernels(kernel_set<double> & p_double_kernels, kernel_set<float> & p_float_kernels);
+
+
+namespace {
+
+
+template <typename TypeValue>
+inline TypeValue scalar_abs(const TypeValue p_value) {
+    return p_value < 0 ? -p_value : p_value;
+}
+
+
+template <typename TypeVector>
+double kernel_euclidean_distance_square(const typename TypeVector::value_type * p_point1, const typename TypeVector::value_type * p_point2, const std::size_t p_size) {
+    constexpr std::size_t width = TypeVector::width;
+
+    typename TypeVector::reg accumulator1 = TypeVector::zero();
+    typename TypeVector::reg accumulator2 = TypeVector::zero();
+
+    std::size_t i = 0;
+    for (; i + 2 * width <= p_size; i += 2 * width) {
+        const auto difference1 = TypeVector::sub(TypeVector::load(p_point1 + i), TypeVector::load(p_point2 + i));
+        const auto difference2 = TypeVector::sub(TypeVector::load(p_point1 + i + width), TypeVector::load(p_point2 + i + width));
+        accumulator1 = TypeVector::mul_add(difference1, difference1, accumulator1);
+        accumulator2 = TypeVector::mul_add(difference2, difference2, accumulator2);
+    }
+
+    for (; i + width <= p_size; i += width) {
+        const auto difference = TypeVector::sub(TypeVector::load(p_point1 + i), TypeVector::load(p_point2 + i));
+        accumulator1 = TypeVector::mul_add(difference, difference, accumulator1);
+    }
+
+    double distance = TypeVector::reduce_add(TypeVector::add(accumulator1, accumulator2));
+    for (; i < p_size; i++) {
+        const double difference = (double) p_point1[i] - (double) p_point2[i];
+        distance += difference * difference;
+    }
+
+    return distance;
+}
+
+
+template <typename TypeVector>
+double kernel_manhattan_distance(const typename TypeVector::value_type * p_point1, const typename TypeVector::value_type * p_point2, const std::size_t p_size) {
+    constexpr std::size_t width = TypeVector::width;
+
+    typename TypeVector::reg accumulator1 = TypeVector::zero();
+    typename TypeVector::reg accumulator2 = TypeVector::zero();
+
+    std::size_t i = 0;
+    for (; i + 2 * width <= p_size; i += 2 * width) {
+        accumulator1 = TypeVector::add(accumulator1, TypeVector::abs(TypeVector::sub(TypeVector::load(p_point1 + i), TypeVector::load(p_point2 + i))));
+        accumulator2 = TypeVector::add(accumulator2, TypeVector::abs(TypeVector::sub(TypeVector::load(p_point1 + i + width), TypeVector::load(p_point2 + i + width))));
+    }
+
+    for (; i + width <= p_size; i += width) {
+        accumulator1 = TypeVector::add(accumulator1, TypeVector::abs(TypeVector::sub(TypeVector::load(p_point1 + i), TypeVector::load(p_point2 + i))));
+    }
+
+    double distance = TypeVector::reduce_add(TypeVector::add(accumulator1, accumulator2));
+    for (; i < p_size; i++) {
+        distance += scalar_abs((double) p_point1[i] - (double) p_point2[i]);
+    }
+
+    return distance;
+}
+
+
+template <typename TypeVector>
+double kernel_chebyshev_distance(const typename TypeVector::value_type * p_point1, const typename TypeVector::value_type * p_point2, const std::size_t p_size) {
+    constexpr std::size_t width = TypeVector::width;
+
+    typename TypeVector::reg accumulator1 = TypeVector::zero();
+    typename TypeVector::reg accumulator2 = TypeVector::zero();
+
+    std::size_t i = 0;
+    for (; i + 2 * width <= p_size; i += 2 * width) {
+        accumulator1 = TypeVector::max(accumulator1, TypeVector::abs(TypeVector::sub(TypeVector::load(p_point1 + i), TypeVector::load(p_point2 + i))));
+        accumulator2 = TypeVector::max(accumulator2, TypeVector::abs(TypeVector::sub(TypeVector::load(p_point1 + i + width), TypeVector::load(p_point2 + i + width))));
+    }
+
+    for (; i + width <= p_size; i += width) {
+        accumulator1 = TypeVector::max(accumulator1, TypeVector::abs(TypeVector::sub(TypeVector::load(p_point1 + i), TypeVector::load(p_point2 + i))));
+    }
+
+    double distance = TypeVector::reduce_max(TypeVector::max(accumulator1, accumulator2));
+    for (; i < p_size; i++) {
+        const double difference = scalar_abs((double) p_point1[i] - (double) p_point2[i]);
+        distance = (difference > distance) ? difference : distance;
+    }
+
+    return distance;
+}
+
+
+template <typename TypeVector>
+double kernel_canberra_distance(const typename TypeVector::value_type * p_point1, const typename TypeVector::value_type * p_point2, const std::size_t p_size) {
+    constexpr std::size_t width = TypeVector::width;
+
+    typename TypeVector::reg accumulator = TypeVector::zero();
+
+    std::size_t i = 0;
+    for (; i + width <= p_size; i += width) {
+        const auto value1 = TypeVector::load(p_point1 + i);
+        const auto value2 = TypeVector::load(p_point2 + i);
+        const auto divider = TypeVector::add(TypeVector::abs(value1), TypeVector::abs(value2));
+        accumulator = TypeVector::add(accumulator, TypeVector::safe_div(TypeVector::abs(TypeVector::sub(value1, value2)), divider));
+    }
+
+    double distance = TypeVector::reduce_add(accumulator);
+    for (; i < p_size; i++) {
+        const double divider = scalar_abs((double) p_point1[i]) + scalar_abs((double) p_point2[i]);
+        if (divider != 0) {
+            distance += scalar_abs((double) p_point1[i] - (double) p_point2[i]) / divider;
+        }
+    }
+
+    return distance;
+}
+
+
+template <typename TypeVector>
+double kernel_chi_square_distance(const typename TypeVector::value_type * p_point1, const typename TypeVector::value_type * p_point2, const std::size_t p_size) {
+    constexpr std::size_t width = TypeVector::width;
+
+    typename TypeVector::reg accumulator = TypeVector::zero();
+
+    std::size_t i = 0;
+    for (; i + width <= p_size; i += width) {
+        const auto value1 = TypeVector::load(p_point1 + i);
+        const auto value2 = TypeVector::load(p_point2 + i);
+        const auto difference = TypeVector::sub(value1, value2);
+        const auto divider = TypeVector::add(TypeVector::abs(value1), TypeVector::abs(value2));
+        accumulator = TypeVector::add(accumulator, TypeVector::safe_div(TypeVector::mul_add(difference, difference, TypeVector::zero()), divider));
+    }
+
+    double distance = TypeVector::reduce_add(accumulator);
+    for (; i < p_size; i++) {
+        const double divider = scalar_abs((double) p_point1[i]) + scalar_abs((double) p_point2[i]);
+        if (divider != 0) {
+            const double difference = (double) p_point1[i] - (double) p_point2[i];
+            distance += difference * difference / divider;
+        }
+    }
+
+    return distance;
+}
+
+
+template <typename TypeVector>
+double kernel_dot_product(const typename TypeVector::value_type * p_point1, const typename TypeVector::value_type * p_point2, const std::size_t p_size) {
+    constexpr std::size_t width = TypeVector::width;
+
+    typename TypeVector::reg accumulator1 = TypeVector::zero();
+    typename TypeVector::reg accumulator2 = TypeVector::zero();
+
+    std::size_t i = 0;
+    for (; i + 2 * width <= p_size; i += 2 * width) {
+        accumulator1 = TypeVector::mul_add(TypeVector::load(p_point1 + i), TypeVector::load(p_point2 + i), accumulator1);
+        accumulator2 = TypeVector::mul_add(TypeVector::load(p_point1 + i + width), TypeVector::load(p_point2 + i + width), accumulator2);
+    }
+
+    for (; i + width <= p_size; i += width) {
+        accumulator1 = TypeVector::mul_add(TypeVector::load(p_point1 + i), TypeVector::load(p_point2 + i), accumulator1);
+    }
+
+    double result = TypeVector::reduce_add(TypeVector::add(accumulator1, accumulator2));
+    for (; i < p_size; i++) {
+        result += (double) p_point1[i] * (double) p_point2[i];
+    }
+
+    return result;
+}
+
+
+/*
+ * Every loaded coordinate of the point is used by four multiplications, this is the micro-kernel
+ * of the blocked (GEMM like) distance matrix computation.
+ */
+template <typename TypeVector>
+void kernel_dot_product_block(const typename TypeVector::value_type * p_point, const typename TypeVector::value_type * const * p_others, const std::size_t p_size, double * p_result) {
+    constexpr std::size_t width = TypeVector::width;
+
+    const typename TypeVector::value_type * other1 = p_others[0];
+    const typename TypeVector::value_type * other2 = p_others[1];
+    const typename TypeVector::value_type * other3 = p_others[2];
+    const typename TypeVector::value_type * other4 = p_others[3];
+
+    typename TypeVector::reg accumulator1 = TypeVector::zero();
+    typename TypeVector::reg accumulator2 = TypeVector::zero();
+    typename TypeVector::reg accumulator3 = TypeVector::zero();
+    typename TypeVector::reg accumulator4 = TypeVector::zero();
+
+    std::size_t i = 0;
+    for (; i + width <= p_size; i += width) {
+        const auto value = TypeVector::load(p_point + i);
+        accumulator1 = TypeVector::mul_add(value, TypeVector::load(other1 + i), accumulator1);
+        accumulator2 = TypeVector::mul_add(value, TypeVector::load(other2 + i), accumulator2);
+        accumulator3 = TypeVector::mul_add(value, TypeVector::load(other3 + i), accumulator3);
+        accumulator4 = TypeVector::mul_add(value, TypeVector::load(other4 + i), accumulator4);
+    }
+
+    p_result[0] = TypeVector::reduce_add(accumulator1);
+    p_result[1] = TypeVector::reduce_add(accumulator2);
+    p_result[2] = TypeVector::reduce_add(accumulator3);
+    p_result[3] = TypeVector::reduce_add(accumulator4);
+
+    for (; i < p_size; i++) {
+        const double value = (double) p_point[i];
+        p_result[0] += value * (double) other1[i];
+        p_result[1] += value * (double) other2[i];
+        p_result[2] += value * (double) other3[i];
+        p_result[3] += value * (double) other4[i];
+    }
+}
+
+
+/*
+ * Exact counterpart of the dot product block: differences are accumulated directly, so there is no cancellation
+ * and the result is equal to the single point kernel up to the summation order.
+ */
+template <typename TypeVector>
+void kernel_euclidean_distance_square_block(const typename TypeVector::value_type * p_point, const typename TypeVector::value_type * const * p_others, const std::size_t p_size, double * p_result) {
+    constexpr std::size_t width = TypeVector::width;
+
+    const typename TypeVector::value_type * other1 = p_others[0];
+    const typename TypeVector::value_type * other2 = p_others[1];
+    const typename TypeVector::value_type * other3 = p_others[2];
+    const typename TypeVector::value_type * other4 = p_others[3];
+
+    typename TypeVector::reg accumulator1 = TypeVector::zero();
+    typename TypeVector::reg accumulator2 = TypeVector::zero();
+    typename TypeVector::reg accumulator3 = TypeVector::zero();
+    typename TypeVector::reg accumulator4 = TypeVector::zero();
+
+    std::size_t i = 0;
+    for (; i + width <= p_size; i += width) {
+        const auto value = TypeVector::load(p_point + i);
+        const auto difference1 = TypeVector::sub(value, TypeVector::load(other1 + i));
+        const auto difference2 = TypeVector::sub(value, TypeVector::load(other2 + i));
+        const auto difference3 = TypeVector::sub(value, TypeVector::load(other3 + i));
+        const auto difference4 = TypeVector::sub(value, TypeVector::load(other4 + i));
+        accumulator1 = TypeVector::mul_add(difference1, difference1, accumulator1);
+        accumulator2 = TypeVector::mul_add(difference2, difference2, accumulator2);
+        accumulator3 = TypeVector::mul_add(difference3, difference3, accumulator3);
+        accumulator4 = TypeVector::mul_add(difference4, difference4, accumulator4);
+    }
+
+    p_result[0] = TypeVector::reduce_add(accumulator1);
+    p_result[1] = TypeVector::reduce_add(accumulator2);
+    p_result[2] = TypeVector::reduce_add(accumulator3);
+    p_result[3] = TypeVector::reduce_add(accumulator4);
+
+    for (; i < p_size; i++) {
+        const double value = (double) p_point[i];
+        const double difference1 = value - (double) other1[i];
+        const double difference2 = value - (double) other2[i];
+        const double difference3 = value - (double) other3[i];
+        const double difference4 = value - (double) other4[i];
+        p_result[0] += difference1 * difference1;
+        p_result[1] += difference2 * difference2;
+        p_result[2] += difference3 * difference3;
+        p_result[3] += difference4 * difference4;
+    }
+}
+
+
+template <typename TypeVector>
+void fill_kernel_set(kernel_set<typename TypeVector::value_type> & p_kernels, const instruction_set p_isa) {
+    p_kernels.isa                         = p_isa;
+    p_kernels.euclidean_distance_square   = kernel_euclidean_distance_square<TypeVector>;
+    p_kernels.manhattan_distance          = kernel_manhattan_distance<TypeVector>;
+    p_kernels.chebyshev_distance          = kernel_chebyshev_distance<TypeVector>;
+    p_kernels.canberra_distance           = kernel_canberra_distance<TypeVector>;
+    p_kernels.chi_square_distance         = kernel_chi_square_distance<TypeVector>;
+    p_kernels.dot_product                 = kernel_dot_product<TypeVector>;
+    p_kernels.dot_product_block           = kernel_dot_product_block<TypeVector>;
+    p_kernels.euclidean_distance_square_block = kernel_euclidean_distance_square_block<TypeVector>;
+}
+
+
+}
+
+}
+
+}
+
+}
+
+}
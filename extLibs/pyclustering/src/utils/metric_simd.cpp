@@ -0,0 +1,164 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include "metric_kernels.hpp"
+
+
+namespace pyclustering {
+
+namespace utils {
+
+namespace metric {
+
+namespace simd {
+
+
+namespace {
+
+
+template <typename TypeValue>
+struct scalar_vector {
+    using value_type = TypeValue;
+    using reg = TypeValue;
+    static constexpr std::size_t width = 1;
+
+    static reg zero() { return 0; }
+    static reg load(const TypeValue * p_data) { return *p_data; }
+    static reg add(const reg p_a, const reg p_b) { return p_a + p_b; }
+    static reg sub(const reg p_a, const reg p_b) { return p_a - p_b; }
+    static reg mul_add(const reg p_a, const reg p_b, const reg p_c) { return p_a * p_b + p_c; }
+    static reg abs(const reg p_a) { return scalar_abs(p_a); }
+    static reg max(const reg p_a, const reg p_b) { return (p_a > p_b) ? p_a : p_b; }
+    static reg safe_div(const reg p_a, const reg p_b) { return (p_b != 0) ? p_a / p_b : 0; }
+    static double reduce_add(const reg p_a) { return p_a; }
+    static double reduce_max(const reg p_a) { return p_a; }
+};
+
+
+constexpr std::size_t INSTRUCTION_SET_AMOUNT = 4;
+
+
+/**
+ *
+ * @brief   Kernels of all instruction sets that are available on the processor.
+ *
+ */
+class kernel_registry {
+public:
+    kernel_set<double>  m_double_kernels[INSTRUCTION_SET_AMOUNT];
+    kernel_set<float>   m_float_kernels[INSTRUCTION_SET_AMOUNT];
+    bool                m_available[INSTRUCTION_SET_AMOUNT] = { false };
+    instruction_set     m_best = instruction_set::SCALAR;
+
+public:
+    kernel_registry() {
+        fill_kernel_set<scalar_vector<double>>(m_double_kernels[0], instruction_set::SCALAR);
+        fill_kernel_set<scalar_vector<float>>(m_float_kernels[0], instruction_set::SCALAR);
+        m_available[0] = true;
+
+        register_kernels(instruction_set::SSE2, load_sse2_kernels);
+        register_kernels(instruction_set::AVX2, load_avx2_kernels);
+        register_kernels(instruction_set::AVX512, load_avx512_kernels);
+    }
+
+private:
+    void register_kernels(const instruction_set p_isa, bool (*p_loader)(kernel_set<double> &, kernel_set<float> &)) {
+        const std::size_t index = static_cast<std::size_t>(p_isa);
+        if (is_supported_by_processor(p_isa) && p_loader(m_double_kernels[index], m_float_kernels[index])) {
+            m_available[index] = true;
+            m_best = p_isa;
+        }
+    }
+
+    static bool is_supported_by_processor(const instruction_set p_isa) {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+        __builtin_cpu_init();
+
+        switch(p_isa) {
+        case instruction_set::SSE2:
+            return __builtin_cpu_supports("sse2");
+        case instruction_set::AVX2:
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        case instruction_set::AVX512:
+            return __builtin_cpu_supports("avx512f");
+        default:
+            return true;
+        }
+#else
+        return p_isa == instruction_set::SCALAR;
+#endif
+    }
+};
+
+
+const kernel_registry & get_registry() {
+    static const kernel_registry registry;
+    return registry;
+}
+
+
+}
+
+
+instruction_set detect_instruction_set() {
+    return get_registry().m_best;
+}
+
+
+const char * instruction_set_name(const instruction_set p_isa) {
+    switch(p_isa) {
+    case instruction_set::SSE2:
+        return "sse2";
+    case instruction_set::AVX2:
+        return "avx2";
+    case instruction_set::AVX512:
+        return "avx512";
+    default:
+        return "scalar";
+    }
+}
+
+
+template <>
+const kernel_set<double> & get_kernels<double>(const instruction_set p_isa) {
+    const kernel_registry & registry = get_registry();
+    const std::size_t index = static_cast<std::size_t>(p_isa);
+    return registry.m_available[index] ? registry.m_double_kernels[index] : registry.m_double_kernels[0];
+}
+
+
+template <>
+const kernel_set<float> & get_kernels<float>(const instruction_set p_isa) {
+    const kernel_registry & registry = get_registry();
+    const std::size_t index = static_cast<std::size_t>(p_isa);
+    return registry.m_available[index] ? registry.m_float_kernels[index] : registry.m_float_kernels[0];
+}
+
+
+}
+
+}
+
+}
+
+}
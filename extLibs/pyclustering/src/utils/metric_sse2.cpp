@@ -0,0 +1,129 @@
+/**
+*
+* @authors Krzysztof Adamkiewicz (kadamkiewicz835@gmail.com)
+* @date 2026
+* @copyright GNU Public License
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include "metric_kernels.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+namespace pyclustering {
+
+namespace utils {
+
+namespace metric {
+
+namespace simd {
+
+
+#if defined(__SSE2__)
+
+
+namespace {
+
+
+struct sse2_double {
+    using value_type = double;
+    using reg = __m128d;
+    static constexpr std::size_t width = 2;
+
+    static reg zero() { return _mm_setzero_pd(); }
+    static reg load(const double * p_data) { return _mm_loadu_pd(p_data); }
+    static reg add(const reg p_a, const reg p_b) { return _mm_add_pd(p_a, p_b); }
+    static reg sub(const reg p_a, const reg p_b) { return _mm_sub_pd(p_a, p_b); }
+    static reg mul_add(const reg p_a, const reg p_b, const reg p_c) { return _mm_add_pd(_mm_mul_pd(p_a, p_b), p_c); }
+    static reg abs(const reg p_a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), p_a); }
+    static reg max(const reg p_a, const reg p_b) { return _mm_max_pd(p_a, p_b); }
+
+    static reg safe_div(const reg p_a, const reg p_b) {
+        return _mm_and_pd(_mm_div_pd(p_a, p_b), _mm_cmpneq_pd(p_b, _mm_setzero_pd()));
+    }
+
+    static double reduce_add(const reg p_a) {
+        return _mm_cvtsd_f64(_mm_add_sd(p_a, _mm_unpackhi_pd(p_a, p_a)));
+    }
+
+    static double reduce_max(const reg p_a) {
+        return _mm_cvtsd_f64(_mm_max_sd(p_a, _mm_unpackhi_pd(p_a, p_a)));
+    }
+};
+
+
+struct sse2_float {
+    using value_type = float;
+    using reg = __m128;
+    static constexpr std::size_t width = 4;
+
+    static reg zero() { return _mm_setzero_ps(); }
+    static reg load(const float * p_data) { return _mm_loadu_ps(p_data); }
+    static reg add(const reg p_a, const reg p_b) { return _mm_add_ps(p_a, p_b); }
+    static reg sub(const reg p_a, const reg p_b) { return _mm_sub_ps(p_a, p_b); }
+    static reg mul_add(const reg p_a, const reg p_b, const reg p_c) { return _mm_add_ps(_mm_mul_ps(p_a, p_b), p_c); }
+    static reg abs(const reg p_a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), p_a); }
+    static reg max(const reg p_a, const reg p_b) { return _mm_max_ps(p_a, p_b); }
+
+    static reg safe_div(const reg p_a, const reg p_b) {
+        return _mm_and_ps(_mm_div_ps(p_a, p_b), _mm_cmpneq_ps(p_b, _mm_setzero_ps()));
+    }
+
+    static double reduce_add(const reg p_a) {
+        const reg pairs = _mm_add_ps(p_a, _mm_movehl_ps(p_a, p_a));
+        return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, 1)));
+    }
+
+    static double reduce_max(const reg p_a) {
+        const reg pairs = _mm_max_ps(p_a, _mm_movehl_ps(p_a, p_a));
+        return _mm_cvtss_f32(_mm_max_ss(pairs, _mm_shuffle_ps(pairs, pairs, 1)));
+    }
+};
+
+
+}
+
+
+bool load_sse2_kernels(kernel_set<double> & p_double_kernels, kernel_set<float> & p_float_kernels) {
+    fill_kernel_set<sse2_double>(p_double_kernels, instruction_set::SSE2);
+    fill_kernel_set<sse2_float>(p_float_kernels, instruction_set::SSE2);
+    return true;
+}
+
+
+#else
+
+
+bool load_sse2_kernels(kernel_set<double> &, kernel_set<float> &) {
+    return false;
+}
+
+
+#endif
+
+
+}
+
+}
+
+}
+
+}
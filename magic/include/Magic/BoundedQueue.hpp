@@ -0,0 +1,120 @@
+/**
+ * @file BoundedQueue.hpp
+ * @brief This header file contains bounded blocking queue used to connect pipeline stages.
+ * @author Krzysztof Adamkiewicz
+ * @date 18/10/2026
+ */
+
+// This file is a part of Cluster - Application for image clustering.
+// Copyright (C) 2020 Krzysztof Adamkiewicz <kadamkiewicz835@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef MAGIC_BOUNDED_QUEUE_HPP_INCLUDED
+#define MAGIC_BOUNDED_QUEUE_HPP_INCLUDED
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+namespace magic
+{
+    /**
+     * @brief Multi producer, multi consumer blocking queue with limited capacity.
+     * Queue is closed automatically when the last registered producer is removed.
+     * After that consumers drain remaining items and then pop() returns false.
+     */
+    template<typename T>
+    class BoundedQueue
+    {
+    public:
+        /**
+         * @param capacity Maximum number of items stored in the queue.
+         * @throw std::runtime_error If capacity is equal to 0.
+         */
+        explicit BoundedQueue(size_t capacity):
+        capacity(capacity)
+        {
+            if(capacity == 0)
+                throw(std::runtime_error("Queue capacity cannot be equal to 0"));
+        }
+
+        /**
+         * @brief Register producer. Must be called before the producer starts pushing items.
+         */
+        void addProducer()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            producers++;
+        }
+
+        /**
+         * @brief Unregister producer. Removing the last producer closes the queue.
+         */
+        void removeProducer()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(producers > 0)
+                producers--;
+
+            if(producers == 0)
+            {
+                closed = true;
+                notEmpty.notify_all();
+            }
+        }
+
+        /**
+         * @brief Push item to the queue. Blocks if queue is full.
+         * @param item Item.
+         */
+        void push(T item)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            notFull.wait(lock, [this]{ return items.size() < capacity; });
+            items.push_back(std::move(item));
+            notEmpty.notify_one();
+        }
+
+        /**
+         * @brief Pop item from the queue. Blocks if queue is empty and not closed.
+         * @param item Output item.
+         * @return False if queue is closed and there are no more items.
+         */
+        bool pop(T& item)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            notEmpty.wait(lock, [this]{ return !items.empty() || closed; });
+            if(items.empty())
+                return false;
+
+            item = std::move(items.front());
+            items.pop_front();
+            notFull.notify_one();
+            return true;
+        }
+
+    private:
+        const size_t capacity; /** @brief Maximum number of items in the queue. */
+        std::deque<T> items; /** @brief Items. */
+        unsigned int producers = 0; /** @brief Number of active producers. */
+        bool closed = false; /** @brief Is queue closed. */
+        std::mutex mutex; /** @brief Queue mutex. */
+        std::condition_variable notEmpty; /** @brief Signaled when item is pushed or queue is closed. */
+        std::condition_variable notFull; /** @brief Signaled when item is popped. */
+    };
+}
+
+#endif
@@ -0,0 +1,67 @@
+/**
+ * @file Agglomerative.hpp
+ * @brief This header file contains agglomerative clustering algorithm class.
+ * @author Krzysztof Adamkiewicz
+ * @date 18/10/2026
+ */
+
+// This file is a part of Cluster - Application for image clustering.
+// Copyright (C) 2020 Krzysztof Adamkiewicz <kadamkiewicz835@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef AGGLOMERATIVE_HPP_INCLUDED
+#define AGGLOMERATIVE_HPP_INCLUDED
+
+#include "ClusteringAlgorithm.hpp"
+
+namespace magic
+{
+    /**
+     * @brief Class implementing agglomerative (hierarchical) clustering algorithm.
+     * Clusters are merged until their distance exceeds the threshold or the required number of clusters is reached,
+     * so with complete link every cluster contains only images closer than the threshold (near duplicates).
+     */
+    class Agglomerative : public ClusteringAlgorithm
+    {
+    public:
+        /**
+         * @brief Distance between clusters.
+         */
+        enum Link
+        {
+            SINGLE_LINK,
+            COMPLETE_LINK,
+            AVERAGE_LINK
+        };
+        
+        Agglomerative(Link link = COMPLETE_LINK, double threshold = 0.05, size_t clusterCount = 1);
+        
+        std::vector<Cluster> cluster(const FeatureMatrix& dataset) const override;
+        
+        void setLink(Link link);
+        Link getLink() const;
+        void setThreshold(double threshold);
+        double getThreshold() const;
+        void setClusterCount(size_t clusterCount);
+        size_t getClusterCount() const;
+        
+    private:
+        Link link; /** @brief Distance between clusters. */
+        double threshold; /** @brief Clusters farther than the threshold are not merged. */
+        size_t clusterCount; /** @brief Minimum number of clusters. */
+    };
+}
+
+#endif
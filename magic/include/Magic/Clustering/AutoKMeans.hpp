@@ -0,0 +1,60 @@
+/**
+ * @file AutoKMeans.hpp
+ * @brief This header file contains k-means clustering algorithm class with automatic cluster count.
+ * @author Krzysztof Adamkiewicz
+ * @date 18/10/2026
+ */
+
+// This file is a part of Cluster - Application for image clustering.
+// Copyright (C) 2020 Krzysztof Adamkiewicz <kadamkiewicz835@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef AUTO_KMEANS_HPP_INCLUDED
+#define AUTO_KMEANS_HPP_INCLUDED
+
+#include "ClusteringAlgorithm.hpp"
+
+namespace magic
+{
+    /**
+     * @brief Class implementing k-means clustering algorithm that chooses the number of clusters.
+     * Cluster counts from the range are clustered in parallel and the clustering with the best mean silhouette score wins.
+     * Counts that were not started before the time budget ran out are skipped.
+     */
+    class AutoKMeans : public ClusteringAlgorithm
+    {
+    public:
+        AutoKMeans(size_t minClusterCount = 2, size_t maxClusterCount = 20, double timeBudget = 60);
+        
+        std::vector<Cluster> cluster(const FeatureMatrix& dataset) const override;
+        
+        size_t getSelectedClusterCount() const;
+        
+        void setMinClusterCount(size_t minClusterCount);
+        size_t getMinClusterCount() const;
+        void setMaxClusterCount(size_t maxClusterCount);
+        size_t getMaxClusterCount() const;
+        void setTimeBudget(double timeBudget);
+        double getTimeBudget() const;
+        
+    private:
+        size_t minClusterCount; /** @brief Minimum number of clusters. */
+        size_t maxClusterCount; /** @brief Maximum number of clusters. */
+        double timeBudget; /** @brief Time in seconds after which no further cluster count is started, 0 means no limit. */
+        mutable size_t selectedClusterCount = 0; /** @brief Number of clusters chosen by the last clustering. */
+    };
+}
+
+#endif
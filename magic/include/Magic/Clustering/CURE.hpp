@@ -0,0 +1,65 @@
+/**
+ * @file CURE.hpp
+ * @brief This header file contains CURE clustering algorithm class.
+ * @author Krzysztof Adamkiewicz
+ * @date 18/10/2026
+ */
+
+// This file is a part of Cluster - Application for image clustering.
+// Copyright (C) 2020 Krzysztof Adamkiewicz <kadamkiewicz835@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef CURE_HPP_INCLUDED
+#define CURE_HPP_INCLUDED
+
+#include "ClusteringAlgorithm.hpp"
+
+namespace magic
+{
+    /**
+     * @brief Class implementing CURE clustering algorithm.
+     * Every cluster is described by several scattered points moved towards its mean, so clusters of non-spherical shapes can be found.
+     * Random sample of images is split into partitions that are clustered independently and then merged,
+     * remaining images are assigned to the cluster with the closest representative point.
+     */
+    class CURE : public ClusteringAlgorithm
+    {
+    public:
+        CURE(size_t clusterCount = 10, size_t representativeCount = 5, double compression = 0.5, size_t sampleSize = 5000, size_t partitionCount = 5);
+        
+        std::vector<Cluster> cluster(const FeatureMatrix& dataset) const override;
+        
+        void setClusterCount(size_t clusterCount);
+        size_t getClusterCount() const;
+        void setRepresentativeCount(size_t representativeCount);
+        size_t getRepresentativeCount() const;
+        void setCompression(double compression);
+        double getCompression() const;
+        void setSampleSize(size_t sampleSize);
+        size_t getSampleSize() const;
+        void setPartitionCount(size_t partitionCount);
+        size_t getPartitionCount() const;
+        
+    private:
+        size_t clusterCount; /** @brief Number of clusters. */
+        size_t representativeCount; /** @brief Number of representative points of the cluster. */
+        double compression; /** @brief Factor of moving representative points towards the mean. */
+        size_t sampleSize; /** @brief Number of images in the random sample, 0 means all images. */
+        size_t partitionCount; /** @brief Number of partitions of the sample. */
+    };
+}
+
+#endif
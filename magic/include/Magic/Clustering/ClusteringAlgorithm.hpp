@@ -27,6 +27,7 @@
 #include <vector>
 #include <memory>
 #include "pyclustering/cluster/cluster_data.hpp"
+#include "pyclustering/utils/distance_matrix.hpp"
 #include "../Types.hpp"
 
 namespace magic
@@ -44,6 +45,13 @@ namespace magic
         {
             DBSCAN_ALGORITHM,
             ROCK_ALGORITHM,
+            AGGLOMERATIVE_ALGORITHM,
+            KMEANS_ALGORITHM,
+            MINIBATCH_KMEANS_ALGORITHM,
+            OPTICS_ALGORITHM,
+            AUTO_KMEANS_ALGORITHM,
+            SOMSC_ALGORITHM,
+            CURE_ALGORITHM,
             NONE
         };
         static std::shared_ptr<ClusteringAlgorithm> build(Type type);
@@ -53,13 +61,19 @@ namespace magic
          * @param dataset Image dataset with computed features.
          * @return Clusters found.
          */
-        virtual std::vector<Cluster> cluster(const FeatureDataset& dataset) const = 0;
+        virtual std::vector<Cluster> cluster(const FeatureMatrix& dataset) const = 0;
+        
+        virtual bool supportsPartialFit() const;
+        virtual void partialFit(const FeatureMatrix& dataset, const std::vector<size_t>& rows);
+        virtual void resetPartialFit();
         
         virtual ~ClusteringAlgorithm();
         
     protected:
-        std::vector<FeatureVector> copyFeatures(const FeatureDataset& dataset) const;
-        std::vector<Cluster> exportClusters(const pyclustering::clst::cluster_data& clusters, const FeatureDataset& dataset) const;
+        pyclustering::dataset copyFeatures(const FeatureMatrix& dataset) const;
+        pyclustering::utils::metric::points_view<FeatureScalar> viewFeatures(const FeatureMatrix& dataset) const;
+        pyclustering::utils::metric::points_view<double> viewFeatures(const FeatureMatrix& dataset, std::vector<double>& buffer) const;
+        std::vector<Cluster> exportClusters(const pyclustering::clst::cluster_data& clusters, const FeatureMatrix& dataset) const;
     };
 }
 
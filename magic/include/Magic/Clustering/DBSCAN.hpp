@@ -34,7 +34,21 @@ namespace magic
     class DBSCAN : public ClusteringAlgorithm
     {
     public:
-        std::vector<Cluster> cluster(const FeatureDataset& dataset) const override;
+        DBSCAN(double eps = 0.05, size_t minPts = 1);
+        
+        std::vector<Cluster> cluster(const FeatureMatrix& dataset) const override;
+        
+        void setEps(double eps);
+        double getEps() const;
+        void setMinPts(size_t minPts);
+        size_t getMinPts() const;
+        void setSearchEffort(size_t searchEffort);
+        size_t getSearchEffort() const;
+        
+    private:
+        double eps; /** @brief Neighborhood radius. */
+        size_t minPts; /** @brief Minimum number of neighbors of the core point. */
+        size_t searchEffort = 0; /** @brief Candidate list size of the approximate neighbor search, 0 for exact search. */
     };
 }
 
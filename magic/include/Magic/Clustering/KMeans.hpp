@@ -0,0 +1,54 @@
+/**
+ * @file KMeans.hpp
+ * @brief This header file contains k-means clustering algorithm class.
+ * @author Krzysztof Adamkiewicz
+ * @date 18/10/2026
+ */
+
+// This file is a part of Cluster - Application for image clustering.
+// Copyright (C) 2020 Krzysztof Adamkiewicz <kadamkiewicz835@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef KMEANS_HPP_INCLUDED
+#define KMEANS_HPP_INCLUDED
+
+#include "ClusteringAlgorithm.hpp"
+
+namespace magic
+{
+    /**
+     * @brief Class implementing k-means clustering algorithm.
+     * Centers are seeded by k-means++ on a sample of the images, points are assigned with the
+     * triangle inequality bounds (Hamerly or Elkan), so large collections can be split into thousands of groups.
+     */
+    class KMeans : public ClusteringAlgorithm
+    {
+    public:
+        KMeans(size_t clusterCount = 10, size_t maxIterations = 100);
+        
+        std::vector<Cluster> cluster(const FeatureMatrix& dataset) const override;
+        
+        void setClusterCount(size_t clusterCount);
+        size_t getClusterCount() const;
+        void setMaxIterations(size_t maxIterations);
+        size_t getMaxIterations() const;
+        
+    private:
+        size_t clusterCount; /** @brief Number of clusters. */
+        size_t maxIterations; /** @brief Maximum number of iterations. */
+    };
+}
+
+#endif
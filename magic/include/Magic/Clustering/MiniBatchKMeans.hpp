@@ -0,0 +1,64 @@
+/**
+ * @file MiniBatchKMeans.hpp
+ * @brief This header file contains mini-batch k-means clustering algorithm class.
+ * @author Krzysztof Adamkiewicz
+ * @date 18/10/2026
+ */
+
+// This file is a part of Cluster - Application for image clustering.
+// Copyright (C) 2020 Krzysztof Adamkiewicz <kadamkiewicz835@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef MINIBATCH_KMEANS_HPP_INCLUDED
+#define MINIBATCH_KMEANS_HPP_INCLUDED
+
+#include "ClusteringAlgorithm.hpp"
+#include "pyclustering/cluster/minibatch_kmeans.hpp"
+
+namespace magic
+{
+    /**
+     * @brief Class implementing mini-batch k-means clustering algorithm.
+     * Centers are updated by small batches of features, so in the streaming pipeline the model is trained
+     * while the features are still being extracted and only the final assignment remains after the extraction.
+     */
+    class MiniBatchKMeans : public ClusteringAlgorithm
+    {
+    public:
+        MiniBatchKMeans(size_t clusterCount = 10, size_t batchSize = 1024, size_t iterationCount = 100);
+        
+        std::vector<Cluster> cluster(const FeatureMatrix& dataset) const override;
+        
+        bool supportsPartialFit() const override;
+        void partialFit(const FeatureMatrix& dataset, const std::vector<size_t>& rows) override;
+        void resetPartialFit() override;
+        
+        void setClusterCount(size_t clusterCount);
+        size_t getClusterCount() const;
+        void setBatchSize(size_t batchSize);
+        size_t getBatchSize() const;
+        void setIterationCount(size_t iterationCount);
+        size_t getIterationCount() const;
+        
+    private:
+        size_t clusterCount; /** @brief Number of clusters. */
+        size_t batchSize; /** @brief Number of features in the batch. */
+        size_t iterationCount; /** @brief Number of batches used when the model was not built by partialFit. */
+        std::unique_ptr<pyclustering::clst::minibatch_kmeans> model; /** @brief Model built by partialFit. */
+        std::vector<double> batch; /** @brief Rows of the current batch copied into a contiguous buffer. */
+    };
+}
+
+#endif
@@ -0,0 +1,65 @@
+/**
+ * @file OPTICS.hpp
+ * @brief This header file contains OPTICS clustering algorithm class.
+ * @author Krzysztof Adamkiewicz
+ * @date 18/10/2026
+ */
+
+// This file is a part of Cluster - Application for image clustering.
+// Copyright (C) 2020 Krzysztof Adamkiewicz <kadamkiewicz835@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef OPTICS_HPP_INCLUDED
+#define OPTICS_HPP_INCLUDED
+
+#include "ClusteringAlgorithm.hpp"
+
+namespace magic
+{
+    /**
+     * @brief Class implementing OPTICS algorithm.
+     * Images are ordered by density, so the reachability plot shows the cluster structure for every radius up to eps.
+     * If the cluster count is set, the radius is chosen from the plot and eps is only the upper limit.
+     */
+    class OPTICS : public ClusteringAlgorithm
+    {
+    public:
+        OPTICS(double eps = 0.5, size_t minPts = 5, size_t clusterCount = 10);
+        
+        std::vector<Cluster> cluster(const FeatureMatrix& dataset) const override;
+        
+        const std::vector<double>& getReachabilityPlot() const;
+        double getRadius() const;
+        
+        void setEps(double eps);
+        double getEps() const;
+        void setMinPts(size_t minPts);
+        size_t getMinPts() const;
+        void setClusterCount(size_t clusterCount);
+        size_t getClusterCount() const;
+        void setSearchEffort(size_t searchEffort);
+        size_t getSearchEffort() const;
+        
+    private:
+        double eps; /** @brief Maximum neighborhood radius. */
+        size_t minPts; /** @brief Minimum number of neighbors of the core point. */
+        size_t clusterCount; /** @brief Number of clusters, 0 if clusters are extracted with eps. */
+        size_t searchEffort = 0; /** @brief Candidate list size of the approximate neighbor search, 0 for exact search. */
+        mutable std::vector<double> reachabilityPlot; /** @brief Reachability distances in cluster ordering from the last clustering. */
+        mutable double radius = 0; /** @brief Radius used to extract clusters in the last clustering. */
+    };
+}
+
+#endif
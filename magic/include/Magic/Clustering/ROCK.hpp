@@ -34,7 +34,7 @@ namespace magic
     class ROCK : public ClusteringAlgorithm
     {
     public:
-        std::vector<Cluster> cluster(const FeatureDataset& dataset) const override;
+        std::vector<Cluster> cluster(const FeatureMatrix& dataset) const override;
     };
 }
 
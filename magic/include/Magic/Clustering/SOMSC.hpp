@@ -0,0 +1,55 @@
+/**
+ * @file SOMSC.hpp
+ * @brief This header file contains SOM clustering algorithm class.
+ * @author Krzysztof Adamkiewicz
+ * @date 18/10/2026
+ */
+
+// This file is a part of Cluster - Application for image clustering.
+// Copyright (C) 2020 Krzysztof Adamkiewicz <kadamkiewicz835@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef SOMSC_HPP_INCLUDED
+#define SOMSC_HPP_INCLUDED
+
+#include "ClusteringAlgorithm.hpp"
+
+namespace magic
+{
+    /**
+     * @brief Class implementing clustering with self-organizing map (SOMSC).
+     * Every neuron of the map is a cluster and neighboring neurons hold similar images.
+     * Map is trained in batch mode, winners of all images are found in parallel and weights are updated once per epoch,
+     * so training cost grows linearly with the number of images.
+     */
+    class SOMSC : public ClusteringAlgorithm
+    {
+    public:
+        SOMSC(size_t clusterCount = 10, size_t epochs = 100);
+        
+        std::vector<Cluster> cluster(const FeatureMatrix& dataset) const override;
+        
+        void setClusterCount(size_t clusterCount);
+        size_t getClusterCount() const;
+        void setEpochs(size_t epochs);
+        size_t getEpochs() const;
+        
+    private:
+        size_t clusterCount; /** @brief Number of neurons of the map. */
+        size_t epochs; /** @brief Maximum number of training epochs. */
+    };
+}
+
+#endif
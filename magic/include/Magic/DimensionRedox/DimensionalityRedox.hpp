@@ -51,9 +51,9 @@ namespace magic
          * @brief Reduce features vectors of the entire dataset.
          * @param dataset Image dataset.
          * @param outputDim Number of dimensions that the output is supposed to have.
-         * @return Reduced feature dataset.
+         * @return Reduced feature matrix.
          */
-        virtual FeatureDataset reduce(const FeatureDataset& dataset, unsigned short outputDim) = 0;
+        virtual FeatureMatrix reduce(const FeatureMatrix& dataset, unsigned short outputDim) = 0;
         
         virtual ~DimReductionAlgorithm();
     };
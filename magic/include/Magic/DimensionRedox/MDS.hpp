@@ -25,22 +25,33 @@
 #define MDS_HPP_INCLUDED
 
 #include <eigen3/Eigen/Core>
+#include <vector>
 #include "DimensionalityRedox.hpp"
 
 namespace magic
 {
     /**
      * @brief Multidimensional scaling (MDS) algorithm.
+     * Small datasets are reduced using classical MDS of the full distance matrix. Larger datasets are reduced
+     * using landmark MDS, which needs only the distances to the landmarks and scales linearly with the dataset size.
      */
     class MDS : public magic::DimReductionAlgorithm
     {
     public:
-        FeatureDataset reduce(const FeatureDataset& dataset, unsigned short outputDim) override;
+        FeatureMatrix reduce(const FeatureMatrix& dataset, unsigned short outputDim) override;
+        
+        void setLandmarkCount(size_t count);
+        size_t getLandmarkCount() const;
+        
+        static constexpr size_t LANDMARK_THRESHOLD = 3000; /** @brief Datasets larger than this are reduced using landmark MDS. */
         
     private:
-        void computeDistanceMatrix(const FeatureDataset& points);
+        void computeDistanceMatrix(const FeatureMatrix& points);
+        FeatureMatrix reduceWithLandmarks(const FeatureMatrix& dataset, unsigned short outputDim);
+        std::vector<size_t> selectLandmarks(const FeatureMatrix& points) const;
         
         Eigen::MatrixXd distanceMatrix; /** @brief Distance matrix. */
+        size_t landmarkCount = 500; /** @brief Number of landmarks used by landmark MDS. */
     };
 }
 
@@ -0,0 +1,90 @@
+/**
+ * @file Executor.hpp
+ * @brief This header file contains work stealing task executor.
+ * @author Krzysztof Adamkiewicz
+ * @date 18/10/2026
+ */
+
+// This file is a part of Cluster - Application for image clustering.
+// Copyright (C) 2020 Krzysztof Adamkiewicz <kadamkiewicz835@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef MAGIC_EXECUTOR_HPP_INCLUDED
+#define MAGIC_EXECUTOR_HPP_INCLUDED
+
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <memory>
+#include <exception>
+
+namespace magic
+{
+    /**
+     * @brief Persistent thread pool with per thread task deques and work stealing.
+     * Every worker executes tasks from the back of its own deque and steals from the front
+     * of the other deques when it runs out of work. Tasks submitted from a worker thread
+     * are pushed to the deque of that worker.
+     */
+    class Executor
+    {
+    public:
+        using Task = std::function<void()>;
+
+        explicit Executor(unsigned int threads);
+        ~Executor();
+
+        Executor(const Executor&) = delete;
+        Executor& operator=(const Executor&) = delete;
+
+        void submit(Task task);
+        void wait();
+        bool isIdle() const;
+        unsigned int getThreadCount() const;
+
+    private:
+        /**
+         * @brief Task deque owned by a single worker.
+         */
+        struct WorkerQueue
+        {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        void work(unsigned int index);
+        bool popTask(unsigned int index, Task& task);
+
+        std::vector<std::unique_ptr<WorkerQueue>> queues; /** @brief Per worker task deques. */
+        std::vector<std::thread> workers; /** @brief Worker threads. */
+
+        std::atomic<size_t> queuedTasks = 0; /** @brief Number of tasks waiting in the deques. */
+        std::atomic<size_t> pendingTasks = 0; /** @brief Number of submitted tasks that are not finished. */
+        std::atomic<unsigned int> nextQueue = 0; /** @brief Deque used for the next task submitted from outside of the pool. */
+        bool stop = false; /** @brief Set when executor is destroyed. */
+
+        std::mutex sleepMutex; /** @brief Mutex guarding worker sleep. */
+        std::condition_variable taskAvailable; /** @brief Signaled when task is submitted. */
+        std::mutex doneMutex; /** @brief Mutex guarding waiting for the tasks. */
+        std::condition_variable tasksDone; /** @brief Signaled when the last pending task is finished. */
+        std::exception_ptr error; /** @brief First exception thrown by a task. */
+    };
+}
+
+#endif
@@ -0,0 +1,80 @@
+/**
+ * @file FeatureCache.hpp
+ * @brief This header file contains persistent feature cache class.
+ * @author Krzysztof Adamkiewicz
+ * @date 18/10/2026
+ */
+
+// This file is a part of Cluster - Application for image clustering.
+// Copyright (C) 2020 Krzysztof Adamkiewicz <kadamkiewicz835@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef MAGIC_FEATURE_CACHE_HPP_INCLUDED
+#define MAGIC_FEATURE_CACHE_HPP_INCLUDED
+
+#include <string>
+#include <unordered_map>
+#include <shared_mutex>
+#include <mutex>
+#include <cstdio>
+#include "Types.hpp"
+
+namespace magic
+{
+    /**
+     * @brief Persistent, append only store of the feature vectors.
+     * Features are keyed by the image path and configuration of the feature extraction.
+     * Cached vector is valid only if size and modification time of the image did not change.
+     * Cache file is memory mapped when opened, new vectors are appended to the end of the file.
+     */
+    class FeatureCache
+    {
+    public:
+        explicit FeatureCache(const std::string& cachePath);
+        ~FeatureCache();
+
+        FeatureCache(const FeatureCache&) = delete;
+        FeatureCache& operator=(const FeatureCache&) = delete;
+
+        bool find(const std::string& imagePath, const std::string& configuration, FeatureScalar* featureVector, size_t length) const;
+        void insert(const std::string& imagePath, const std::string& configuration, const FeatureScalar* featureVector, size_t length);
+        size_t size() const;
+
+    private:
+        /**
+         * @brief Cached feature vector.
+         */
+        struct Entry
+        {
+            uint64_t fileSize;
+            int64_t modificationTime;
+            const FeatureScalar* data; /** @brief Points either to the mapped file or to the storage. */
+            size_t length;
+            FeatureVector storage; /** @brief Storage of the vectors inserted after the file was mapped. */
+        };
+
+        void load();
+        void release();
+
+        std::string cachePath; /** @brief Path to the cache file. */
+        FILE* file = nullptr; /** @brief Cache file opened for appending. */
+        void* mapping = nullptr; /** @brief Memory mapped contents of the cache file. */
+        size_t mappingSize = 0; /** @brief Size of the mapped region. */
+        std::unordered_map<std::string, Entry> entries; /** @brief Cached vectors indexed by path and configuration. */
+        mutable std::shared_mutex mutex; /** @brief Mutex guarding the entries and the file. */
+    };
+}
+
+#endif
@@ -26,6 +26,7 @@
 
 #include <memory>
 #include <atomic>
+#include <cmath>
 #include "../Types.hpp"
 
 namespace magic
@@ -44,14 +45,22 @@ namespace magic
         };
 
         static std::shared_ptr<FeatureExtractor> build(Type type);
-        static void normalize(FeatureDataset& dataset);
+
+        template<typename T>
+        static void normalize(BasicFeatureMatrix<T>& dataset);
+
+        template<typename T>
+        static void normalize(T* featureVector, size_t size);
+
+        FeatureMatrix buildFeatures(const ImageDataset& dataset) const;
 
         /**
-         * @brief Build feature vector for the image dataset.
-         * @param dataset Image dataset.
-         * @return Feature dataset.
+         * @brief Build feature vector for a single image.
+         * Exactly featureVectorSize() values are written. Must be safe to call from multiple threads at once.
+         * @param image Image.
+         * @param featureVector Output feature vector.
          */
-        virtual FeatureDataset buildFeatures(const ImageDataset& dataset) const = 0;
+        virtual void buildFeatureVector(const cv::Mat& image, FeatureScalar* featureVector) const = 0;
 
         void setProgressCounter(std::atomic<size_t>& progressCounter);
         
@@ -61,11 +70,51 @@ namespace magic
          */
         virtual unsigned int featureVectorSize() const = 0;
         
+        /**
+         * @brief Get description of the extractor and its parameters.
+         * Extractors with the same configuration produce the same features.
+         * @return Configuration string.
+         */
+        virtual std::string getConfiguration() const = 0;
+        
         virtual ~FeatureExtractor();
         
     protected:
         mutable std::atomic<size_t>* progressCounter = nullptr; /** @brief Progress counter. */
     };
+
+    /**
+     * @brief Normalize feature vector using eucklidan norm.
+     * Length is accumulated in double precision, so single precision vectors keep full accuracy.
+     * @param featureVector Feature vector.
+     * @param size Length of the feature vector.
+     */
+    template<typename T>
+    void FeatureExtractor::normalize(T* featureVector, size_t size)
+    {
+        double len = 0;
+        for(size_t i=0; i<size; i++)
+            len += static_cast<double>(featureVector[i])*featureVector[i];
+
+        //leave zero vector as it is so we don't normalize to -NAN
+        if(len == 0)
+            return;
+
+        const T scale = static_cast<T>(1.0/std::sqrt(len));
+        for(size_t i=0; i<size; i++)
+            featureVector[i] *= scale;
+    }
+
+    /**
+     * @brief Normalize features using eucklidan norm.
+     * @param dataset Feature matrix.
+     */
+    template<typename T>
+    void FeatureExtractor::normalize(BasicFeatureMatrix<T>& dataset)
+    {
+        for(size_t i=0; i<dataset.rows(); i++)
+            normalize(dataset.row(i), dataset.cols());
+    }
 }
 
 #endif
@@ -35,14 +35,15 @@ namespace magic
     class GlobalHistogram : public FeatureExtractor
     {
     public:
-        FeatureDataset buildFeatures(const ImageDataset& dataset) const override;
+        void buildFeatureVector(const cv::Mat& image, FeatureScalar* featureVector) const override;
         unsigned int featureVectorSize() const override;
+        std::string getConfiguration() const override;
         
         void setBinCount(unsigned int count);
         unsigned int getBinCount() const;
 
     private:
-        unsigned int binCount = 10; /** @brief Number of bins in a histogram. */
+        unsigned int binCount = 256; /** @brief Number of bins in a histogram. */
     };
 }
 #endif
@@ -37,8 +37,9 @@ namespace magic
     public:
         OpenCV_Descriptor();
 
-        FeatureDataset buildFeatures(const ImageDataset& dataset) const override;
+        void buildFeatureVector(const cv::Mat& image, FeatureScalar* featureVector) const override;
         unsigned int featureVectorSize() const override;
+        std::string getConfiguration() const override;
         
         void setKeypointCount(unsigned int count);
         unsigned int getKeypointCount() const;
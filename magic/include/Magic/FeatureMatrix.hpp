@@ -0,0 +1,251 @@
+/**
+ * @file FeatureMatrix.hpp
+ * @brief This header file contains contiguous feature matrix class.
+ * @author Krzysztof Adamkiewicz
+ * @date 18/10/2026
+ */
+
+// This file is a part of Cluster - Application for image clustering.
+// Copyright (C) 2020 Krzysztof Adamkiewicz <kadamkiewicz835@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef MAGIC_FEATURE_MATRIX_HPP_INCLUDED
+#define MAGIC_FEATURE_MATRIX_HPP_INCLUDED
+
+#include <vector>
+#include <string>
+#include <new>
+#include <cstddef>
+
+namespace magic
+{
+    /**
+     * @brief Allocator returning memory aligned to the given boundary.
+     */
+    template<typename T, size_t Alignment>
+    struct AlignedAllocator
+    {
+        using value_type = T;
+
+        template<typename U>
+        struct rebind
+        {
+            using other = AlignedAllocator<U, Alignment>;
+        };
+
+        AlignedAllocator() = default;
+
+        template<typename U>
+        AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+
+        T* allocate(size_t n)
+        {
+            return static_cast<T*>(::operator new(n*sizeof(T), std::align_val_t(Alignment)));
+        }
+
+        void deallocate(T* p, size_t)
+        {
+            ::operator delete(p, std::align_val_t(Alignment));
+        }
+
+        template<typename U>
+        bool operator==(const AlignedAllocator<U, Alignment>&) const { return true; }
+
+        template<typename U>
+        bool operator!=(const AlignedAllocator<U, Alignment>&) const { return false; }
+    };
+
+    /**
+     * @brief Row major n x d matrix of feature vectors with a table of image paths.
+     * Rows are stored in a single buffer. Every row starts at ROW_ALIGNMENT byte boundary
+     * and is padded with zeros, so vectorized kernels can process whole rows without the tail handling.
+     */
+    template<typename T>
+    class BasicFeatureMatrix
+    {
+    public:
+        using Scalar = T;
+
+        static constexpr size_t ROW_ALIGNMENT = 32; /** @brief Alignment of the rows in bytes. */
+
+        BasicFeatureMatrix() = default;
+
+        /**
+         * @param rows Number of feature vectors.
+         * @param cols Length of the feature vector.
+         */
+        BasicFeatureMatrix(size_t rows, size_t cols)
+        {
+            resize(rows, cols);
+        }
+
+        /**
+         * @brief Resize the matrix. All values are set to 0 and paths are cleared.
+         * @param rows Number of feature vectors.
+         * @param cols Length of the feature vector.
+         */
+        void resize(size_t rows, size_t cols)
+        {
+            const size_t rowAlignment = ROW_ALIGNMENT/sizeof(T);
+
+            rowCount = rows;
+            colCount = cols;
+            rowStride = (cols + rowAlignment - 1)/rowAlignment*rowAlignment;
+            values.assign(rowCount*rowStride, T(0));
+            pathTable.assign(rows, std::string());
+        }
+
+        /**
+         * @brief Remove all rows.
+         */
+        void clear()
+        {
+            resize(0, 0);
+        }
+
+        /**
+         * @brief Get number of feature vectors.
+         * @return Number of rows.
+         */
+        size_t rows() const
+        {
+            return rowCount;
+        }
+
+        /**
+         * @brief Get length of the feature vector.
+         * @return Number of columns.
+         */
+        size_t cols() const
+        {
+            return colCount;
+        }
+
+        /**
+         * @brief Get distance between the beginnings of consecutive rows.
+         * @return Row stride in elements.
+         */
+        size_t stride() const
+        {
+            return rowStride;
+        }
+
+        /**
+         * @brief Check if matrix has no rows.
+         * @return True if matrix is empty.
+         */
+        bool empty() const
+        {
+            return rowCount == 0;
+        }
+
+        /**
+         * @brief Get pointer to the beginning of the row.
+         * @param index Index of the row.
+         * @return Pointer to the first element of the row.
+         */
+        T* row(size_t index)
+        {
+            return values.data() + index*rowStride;
+        }
+
+        const T* row(size_t index) const
+        {
+            return values.data() + index*rowStride;
+        }
+
+        /**
+         * @brief Access single element.
+         * @param rowIndex Index of the row.
+         * @param colIndex Index of the column.
+         * @return Reference to the element.
+         */
+        T& operator()(size_t rowIndex, size_t colIndex)
+        {
+            return values[rowIndex*rowStride + colIndex];
+        }
+
+        const T& operator()(size_t rowIndex, size_t colIndex) const
+        {
+            return values[rowIndex*rowStride + colIndex];
+        }
+
+        /**
+         * @brief Get pointer to the matrix buffer.
+         * @return Pointer to the first element of the first row.
+         */
+        T* data()
+        {
+            return values.data();
+        }
+
+        const T* data() const
+        {
+            return values.data();
+        }
+
+        /**
+         * @brief Access path of the image described by the row.
+         * @param index Index of the row.
+         * @return Reference to the path.
+         */
+        std::string& path(size_t index)
+        {
+            return pathTable[index];
+        }
+
+        const std::string& path(size_t index) const
+        {
+            return pathTable[index];
+        }
+
+        /**
+         * @brief Get paths of all rows.
+         * @return Path table.
+         */
+        const std::vector<std::string>& paths() const
+        {
+            return pathTable;
+        }
+
+        /**
+         * @brief Copy the row into a separate vector.
+         * @param index Index of the row.
+         * @return Feature vector.
+         */
+        std::vector<T> rowVector(size_t index) const
+        {
+            return std::vector<T>(row(index), row(index) + colCount);
+        }
+
+    private:
+        size_t rowCount = 0; /** @brief Number of rows. */
+        size_t colCount = 0; /** @brief Number of columns. */
+        size_t rowStride = 0; /** @brief Distance between rows in elements. */
+        std::vector<T, AlignedAllocator<T, ROW_ALIGNMENT>> values; /** @brief Matrix values. */
+        std::vector<std::string> pathTable; /** @brief Path of the image for every row. */
+    };
+
+    /**
+     * @brief Precision of the features used by the pipeline.
+     * Image descriptors are single precision to begin with, so storing them as float halves
+     * the memory traffic of the distance kernels without losing information.
+     */
+    typedef float FeatureScalar;
+
+    typedef BasicFeatureMatrix<FeatureScalar> FeatureMatrix;
+}
+
+#endif
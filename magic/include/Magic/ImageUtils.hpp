@@ -29,7 +29,9 @@
 
 namespace magic
 {
+    bool isFileFormatSupported(const std::string& fileName);
     Image loadImageFromFile(const std::string& filePath);
+    Image loadImageFromFile(const std::string& filePath, unsigned int width, unsigned int height);
     ImageDataset loadImageBatch(const std::vector<std::string>& filePaths);
     ImageDataset loadImageBatch(const std::vector<std::string>& filePaths, std::atomic<size_t>& progressCounter);
 
@@ -25,11 +25,15 @@
 #define PIPELINE_HPP_INCLUDED
 
 #include <atomic>
-#include <mutex>
 #include <thread>
 #include <utility>
 #include <future>
+#include <exception>
+#include <mutex>
 #include "Types.hpp"
+#include "BoundedQueue.hpp"
+#include "Executor.hpp"
+#include "FeatureCache.hpp"
 #include "Clustering/ClusteringAlgorithm.hpp"
 #include "DimensionRedox/DimensionalityRedox.hpp"
 #include "FeatureExtractors/FeatureExtractor.hpp"
@@ -50,13 +54,27 @@ namespace magic
                  FeatureExtractor::Type featureExtractorType);
         
         void setInput(const std::vector<std::string>& paths);
+        void setExecutor(std::shared_ptr<Executor> executor);
+        void setFeatureCache(std::shared_ptr<FeatureCache> cache);
         std::vector<Cluster> getClusters() const;
-        FeatureDataset getReducedFeatures() const;
+        FeatureMatrix getReducedFeatures() const;
         
         void update();
         void startProcessing(unsigned int threads);
         void reset();
         
+        /**
+         * @brief Pipeline execution mode.
+         */
+        enum Mode
+        {
+            BATCH, /** @brief Each stage processes the entire dataset before the next one is started. */
+            STREAMING /** @brief Images flow through all stages at once, connected by bounded queues. */
+        };
+        void setMode(Mode mode);
+        Mode getMode() const;
+        void setReducedDecoding(bool enabled);
+        
         /**
          * @brief Pipeline status.
          */
@@ -86,39 +104,77 @@ namespace magic
         Progress getProgress() const;
 
     private:
-        using ImagePathPool = std::pair<std::mutex, std::vector<std::string>>;
-        using ImagePool = std::pair<std::mutex, ImageDataset>;
-        using FeaturePool = std::pair<std::mutex, FeatureDataset>;
+        using IndexQueue = BoundedQueue<size_t>;
+        
+        /**
+         * @brief Counts the image as processed by the stage when the task ends, also when it throws.
+         * Stage always reaches its total, so update() calls Executor::wait() which rethrows the error.
+         */
+        struct ProgressGuard
+        {
+            std::atomic<size_t>& counter; /** @brief Progress counter of the stage. */
+            
+            ~ProgressGuard()
+            {
+                counter.fetch_add(1, std::memory_order_relaxed);
+            }
+        };
         
         //stages
         void loadImages();
         void preprocessImage();
         void extractFeatures();
+        void loadImage(size_t index);
+        void resizeImage(size_t index);
+        void extractImageFeatures(size_t index);
         void cluster();
         void reduceFeatures();
-        std::vector<std::pair<size_t, size_t>> getChunks(size_t size) const;
+        void startStreaming();
+        void fitStreamedFeatures(IndexQueue& input);
+        void storeStreamingError();
         bool isCurrentStageFinished();
+        size_t getImageCount() const;
+        void findCachedFeatures();
         unsigned int threads = 1; /** @brief Number of threads. */
-        std::vector<std::thread> workerPool; /** @brief All currently running threads. */
+        std::vector<std::thread> workerPool; /** @brief All currently running threads (streaming mode). */
+        std::exception_ptr streamingError; /** @brief First exception thrown by the streaming stages, rethrown when they are joined. */
+        std::mutex streamingErrorMutex; /** @brief Mutex guarding the streaming error. */
+        std::shared_ptr<Executor> executor; /** @brief Executor running the tasks of the batch stages. */
+        Mode mode = BATCH; /** @brief Execution mode. */
+        bool reducedDecoding = true; /** @brief Decode images directly at the preprocessed size, fusing loading and preprocessing. */
+        
+        static constexpr unsigned int PREPROCESSED_IMAGE_SIZE = 300; /** @brief Width and height of the preprocessed images. */
+        static constexpr size_t STREAMING_QUEUE_SIZE = 4; /** @brief Capacity of the streaming queues per thread. */
+        static constexpr size_t PARTIAL_FIT_BATCH_SIZE = 256; /** @brief Number of features passed to the clustering at once (streaming mode). */
 
         //progress counters
         std::atomic<size_t> loadedCounter = 0; /** @brief Counter of the loaded images. */
         std::atomic<size_t> preprocessedCounter = 0; /** @brief Counter of the preprocessed images. */
         std::atomic<size_t> featuredExtractedCounter = 0; /** @brief Counter of the extracted features. */
+        std::atomic<size_t> loadingCursor = 0; /** @brief Index of the next path to load in streaming mode. */
         bool clusteringCompleted = false; /** @brief Is clustering completed. */
         bool dimRedoxCompleted = false; /** @brief Is dimensionality reduction completed. */
         
         //data storage
-        ImagePathPool imagePaths; /** @brief Paths to images ordered in batches. */
-        ImagePool images; /** @brief Images dataset. */
-        FeaturePool imageFeatures; /** @brief Image features. */
-        mutable std::future<FeatureDataset> reducedFeatures; /** @brief Recuded image features. */
+        //images and features are stored in slots allocated before processing starts,
+        //every worker writes only to the slot of the image it processes so no locking is needed
+        std::vector<std::string> imagePaths; /** @brief Paths to images. */
+        std::vector<size_t> imageIndices; /** @brief Index of the path for every image slot. */
+        std::vector<size_t> pendingImages; /** @brief Slots of the images that were not found in the feature cache. */
+        ImageDataset images; /** @brief Images dataset. */
+        FeatureMatrix imageFeatures; /** @brief Image features, one row for every image slot. */
+        mutable std::future<FeatureMatrix> reducedFeatures; /** @brief Recuded image features. */
         mutable std::future<std::vector<Cluster>> clusters; /** @brief Clusters computed. */
+        std::unique_ptr<IndexQueue> loadedQueue; /** @brief Slots of the images waiting for preprocessing (streaming mode). */
+        std::unique_ptr<IndexQueue> preprocessedQueue; /** @brief Slots of the images waiting for feature extraction (streaming mode). */
+        std::unique_ptr<IndexQueue> extractedQueue; /** @brief Slots of the extracted features waiting for the partial fit of the clustering (streaming mode). */
          
         //processors
         std::shared_ptr<ClusteringAlgorithm> clusteringAlgorithm; /** @brief Clustering algorithm. */
         std::shared_ptr<DimReductionAlgorithm> dimensionalityReductionAlgorithm; /** @brief Dimensionality reduction algorithm. */
         std::shared_ptr<FeatureExtractor> featureExtractor; /** @brief Feature extractor. */
+        std::shared_ptr<FeatureCache> featureCache; /** @brief Cache of the extracted features. */
+        std::string featureConfiguration; /** @brief Configuration of the feature extraction used as the cache key. */
         
         //status
         Status status = READY; /** @brief Status of the pipeline. */
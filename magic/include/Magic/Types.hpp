@@ -28,10 +28,11 @@
 #include <memory>
 #include <opencv2/core/core.hpp>
 #include <eigen3/Eigen/Core>
+#include "FeatureMatrix.hpp"
 
 namespace magic
 {
-    typedef std::vector<double> FeatureVector;
+    typedef std::vector<FeatureScalar> FeatureVector;
     
     /**
      * @brief Image structure.
@@ -42,18 +43,8 @@ namespace magic
         cv::Mat image;
     };
     
-    /**
-     * @brief Image feature structure.
-     */
-    struct ImageFeature
-    {
-        std::string path;
-        FeatureVector featureVector;
-    };
-
     typedef std::vector<Image> ImageDataset;
-    typedef std::vector<ImageFeature> FeatureDataset;
-    typedef std::vector<ImageFeature> Cluster;
+    typedef std::vector<std::string> Cluster; /** @brief Paths of the images that belong to the cluster. */
 }
 
 #endif 
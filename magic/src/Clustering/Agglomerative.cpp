@@ -0,0 +1,137 @@
+/**
+ * @file Agglomerative.cpp
+ * @brief This source file contains source code for agglomerative clustering algorithm.
+ * @author Krzysztof Adamkiewicz
+ * @date 18/10/2026
+ */
+
+// This file is a part of Cluster - Application for image clustering.
+// Copyright (C) 2020 Krzysztof Adamkiewicz <kadamkiewicz835@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include "pyclustering/cluster/agglomerative.hpp"
+#include "Clustering/Agglomerative.hpp"
+#include <stdexcept>
+
+using namespace magic;
+
+/**
+ * @param link Distance between clusters.
+ * @param threshold Clusters farther than the threshold are not merged.
+ * @param clusterCount Minimum number of clusters.
+ * @throw std::runtime_error If threshold is not positive or cluster count is equal to 0.
+ */
+Agglomerative::Agglomerative(Link link, double threshold, size_t clusterCount):
+link(link)
+{
+    setThreshold(threshold);
+    setClusterCount(clusterCount);
+}
+
+/**
+ * @brief Perform clustering operation using agglomerative algorithm.
+ * @param dataset Feature matrix.
+ * @return Vector of clusters.
+ */
+std::vector<Cluster> Agglomerative::cluster(const FeatureMatrix& dataset) const
+{
+    pyclustering::dataset features = copyFeatures(dataset);
+    pyclustering::clst::agglomerative_data clusters;
+    
+    pyclustering::clst::type_link type;
+    switch(link)
+    {
+        case SINGLE_LINK:
+            type = pyclustering::clst::type_link::SINGLE_LINK;
+            break;
+            
+        case AVERAGE_LINK:
+            type = pyclustering::clst::type_link::AVERAGE_LINK;
+            break;
+            
+        default:
+            type = pyclustering::clst::type_link::COMPLETE_LINK;
+            break;
+    }
+    
+    //perform clustering
+    pyclustering::clst::agglomerative agglomerative(clusterCount, type, threshold);
+    agglomerative.process(features, clusters);
+    
+    //export clustering results
+    return exportClusters(clusters, dataset);
+}
+
+/**
+ * @brief Set distance between clusters.
+ * @param link Distance between clusters.
+ */
+void Agglomerative::setLink(Link link)
+{
+    this->link = link;
+}
+
+/**
+ * @brief Get distance between clusters.
+ * @return Distance between clusters.
+ */
+Agglomerative::Link Agglomerative::getLink() const
+{
+    return link;
+}
+
+/**
+ * @brief Set distance threshold, clusters farther than the threshold are not merged.
+ * @param threshold Distance threshold.
+ * @throw std::runtime_error If threshold is not positive.
+ */
+void Agglomerative::setThreshold(double threshold)
+{
+    if(threshold <= 0)
+        throw(std::runtime_error("Agglomerative clustering threshold must be positive"));
+    
+    this->threshold = threshold;
+}
+
+/**
+ * @brief Get distance threshold.
+ * @return Distance threshold.
+ */
+double Agglomerative::getThreshold() const
+{
+    return threshold;
+}
+
+/**
+ * @brief Set minimum number of clusters.
+ * @param clusterCount Minimum number of clusters.
+ * @throw std::runtime_error If cluster count is equal to 0.
+ */
+void Agglomerative::setClusterCount(size_t clusterCount)
+{
+    if(clusterCount == 0)
+        throw(std::runtime_error("Number of clusters cannot be equal to 0"));
+    
+    this->clusterCount = clusterCount;
+}
+
+/**
+ * @brief Get minimum number of clusters.
+ * @return Minimum number of clusters.
+ */
+size_t Agglomerative::getClusterCount() const
+{
+    return clusterCount;
+}
@@ -0,0 +1,163 @@
+/**
+ * @file AutoKMeans.cpp
+ * @brief This source file contains source code for k-means clustering algorithm with automatic cluster count.
+ * @author Krzysztof Adamkiewicz
+ * @date 18/10/2026
+ */
+
+// This file is a part of Cluster - Application for image clustering.
+// Copyright (C) 2020 Krzysztof Adamkiewicz <kadamkiewicz835@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include "pyclustering/cluster/silhouette_ksearch.hpp"
+#include "Clustering/AutoKMeans.hpp"
+#include <stdexcept>
+#include <algorithm>
+
+using namespace magic;
+
+/**
+ * @param minClusterCount Minimum number of clusters.
+ * @param maxClusterCount Maximum number of clusters.
+ * @param timeBudget Time in seconds after which no further cluster count is started, 0 means no limit.
+ * @throw std::runtime_error If cluster count is less than 2 or time budget is negative.
+ */
+AutoKMeans::AutoKMeans(size_t minClusterCount, size_t maxClusterCount, double timeBudget)
+{
+    setMinClusterCount(minClusterCount);
+    setMaxClusterCount(maxClusterCount);
+    setTimeBudget(timeBudget);
+}
+
+/**
+ * @brief Perform clustering operation using k-means algorithm with the best cluster count.
+ * @param dataset Feature matrix.
+ * @return Vector of clusters.
+ * @throw std::runtime_error If minimum number of clusters is greater than maximum.
+ */
+std::vector<Cluster> AutoKMeans::cluster(const FeatureMatrix& dataset) const
+{
+    if(minClusterCount > maxClusterCount)
+        throw(std::runtime_error("Minimum number of clusters cannot be greater than maximum"));
+    
+    if(dataset.empty())
+        return std::vector<Cluster>();
+    
+    //silhouette needs more images than clusters
+    const size_t maxCount = std::min(maxClusterCount, dataset.rows() - 1);
+    
+    pyclustering::clst::cluster_data clusters;
+    selectedClusterCount = 0;
+    if(maxCount >= minClusterCount)
+    {
+        //features are converted to double precision once and shared by all cluster counts
+        std::vector<double> buffer;
+        const pyclustering::utils::metric::points_view<double> points = viewFeatures(dataset, buffer);
+        pyclustering::clst::silhouette_ksearch_data result;
+        
+        //perform clustering for every cluster count in parallel
+        pyclustering::clst::silhouette_ksearch ksearch(minClusterCount, maxCount + 1,
+            std::make_shared<pyclustering::clst::kmeans_allocator>(), timeBudget);
+        ksearch.process(points, result);
+        
+        selectedClusterCount = result.get_amount();
+        clusters.clusters() = std::move(result.clusters());
+    }
+    
+    //no cluster count separates the images, all of them form one cluster
+    if(selectedClusterCount == 0)
+    {
+        selectedClusterCount = 1;
+        return std::vector<Cluster>(1, dataset.paths());
+    }
+    
+    //export clustering results
+    return exportClusters(clusters, dataset);
+}
+
+/**
+ * @brief Get number of clusters chosen by the last clustering.
+ * @return Number of clusters, 0 if clustering was not performed.
+ */
+size_t AutoKMeans::getSelectedClusterCount() const
+{
+    return selectedClusterCount;
+}
+
+/**
+ * @brief Set minimum number of clusters.
+ * @param minClusterCount Minimum number of clusters.
+ * @throw std::runtime_error If cluster count is less than 2.
+ */
+void AutoKMeans::setMinClusterCount(size_t minClusterCount)
+{
+    if(minClusterCount < 2)
+        throw(std::runtime_error("Minimum number of clusters must be at least 2"));
+    
+    this->minClusterCount = minClusterCount;
+}
+
+/**
+ * @brief Get minimum number of clusters.
+ * @return Minimum number of clusters.
+ */
+size_t AutoKMeans::getMinClusterCount() const
+{
+    return minClusterCount;
+}
+
+/**
+ * @brief Set maximum number of clusters.
+ * @param maxClusterCount Maximum number of clusters.
+ * @throw std::runtime_error If cluster count is less than 2.
+ */
+void AutoKMeans::setMaxClusterCount(size_t maxClusterCount)
+{
+    if(maxClusterCount < 2)
+        throw(std::runtime_error("Maximum number of clusters must be at least 2"));
+    
+    this->maxClusterCount = maxClusterCount;
+}
+
+/**
+ * @brief Get maximum number of clusters.
+ * @return Maximum number of clusters.
+ */
+size_t AutoKMeans::getMaxClusterCount() const
+{
+    return maxClusterCount;
+}
+
+/**
+ * @brief Set time budget of the search.
+ * @param timeBudget Time in seconds after which no further cluster count is started, 0 means no limit.
+ * @throw std::runtime_error If time budget is negative.
+ */
+void AutoKMeans::setTimeBudget(double timeBudget)
+{
+    if(timeBudget < 0)
+        throw(std::runtime_error("Time budget cannot be negative"));
+    
+    this->timeBudget = timeBudget;
+}
+
+/**
+ * @brief Get time budget of the search.
+ * @return Time budget in seconds.
+ */
+double AutoKMeans::getTimeBudget() const
+{
+    return timeBudget;
+}
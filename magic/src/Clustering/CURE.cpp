@@ -0,0 +1,174 @@
+/**
+ * @file CURE.cpp
+ * @brief This source file contains source code for CURE clustering algorithm.
+ * @author Krzysztof Adamkiewicz
+ * @date 18/10/2026
+ */
+
+// This file is a part of Cluster - Application for image clustering.
+// Copyright (C) 2020 Krzysztof Adamkiewicz <kadamkiewicz835@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "pyclustering/cluster/cure.hpp"
+#include "Clustering/CURE.hpp"
+#include <stdexcept>
+
+using namespace magic;
+
+/**
+ * @param clusterCount Number of clusters.
+ * @param representativeCount Number of representative points of the cluster.
+ * @param compression Factor of moving representative points towards the mean.
+ * @param sampleSize Number of images in the random sample, 0 means all images.
+ * @param partitionCount Number of partitions of the sample.
+ * @throw std::runtime_error If any of the parameters is invalid.
+ */
+CURE::CURE(size_t clusterCount, size_t representativeCount, double compression, size_t sampleSize, size_t partitionCount)
+{
+    setClusterCount(clusterCount);
+    setRepresentativeCount(representativeCount);
+    setCompression(compression);
+    setSampleSize(sampleSize);
+    setPartitionCount(partitionCount);
+}
+
+/**
+ * @brief Perform clustering operation using CURE algorithm.
+ * Feature matrix is clustered in its own precision, only the sample is converted to double precision.
+ * @param dataset Feature matrix.
+ * @return Vector of clusters.
+ */
+std::vector<Cluster> CURE::cluster(const FeatureMatrix& dataset) const
+{
+    if(dataset.empty())
+        return std::vector<Cluster>();
+    
+    const pyclustering::utils::metric::points_view<FeatureScalar> points = viewFeatures(dataset);
+    pyclustering::clst::cure_data clusters;
+    
+    //perform clustering
+    pyclustering::clst::cure cure(clusterCount, representativeCount, compression, sampleSize, partitionCount);
+    cure.process(points, clusters);
+    
+    //export clustering results
+    return exportClusters(clusters, dataset);
+}
+
+/**
+ * @brief Set number of clusters.
+ * @param clusterCount Number of clusters.
+ * @throw std::runtime_error If cluster count is equal to 0.
+ */
+void CURE::setClusterCount(size_t clusterCount)
+{
+    if(clusterCount == 0)
+        throw(std::runtime_error("Number of clusters cannot be equal to 0"));
+    
+    this->clusterCount = clusterCount;
+}
+
+/**
+ * @brief Get number of clusters.
+ * @return Number of clusters.
+ */
+size_t CURE::getClusterCount() const
+{
+    return clusterCount;
+}
+
+/**
+ * @brief Set number of representative points of the cluster.
+ * @param representativeCount Number of representative points.
+ * @throw std::runtime_error If number of representative points is equal to 0.
+ */
+void CURE::setRepresentativeCount(size_t representativeCount)
+{
+    if(representativeCount == 0)
+        throw(std::runtime_error("Number of representative points cannot be equal to 0"));
+    
+    this->representativeCount = representativeCount;
+}
+
+/**
+ * @brief Get number of representative points of the cluster.
+ * @return Number of representative points.
+ */
+size_t CURE::getRepresentativeCount() const
+{
+    return representativeCount;
+}
+
+/**
+ * @brief Set factor of moving representative points towards the mean.
+ * @param compression Compression from range [0, 1].
+ * @throw std::runtime_error If compression is outside of the range [0, 1].
+ */
+void CURE::setCompression(double compression)
+{
+    if(compression < 0 || compression > 1)
+        throw(std::runtime_error("Compression must be in range [0, 1]"));
+    
+    this->compression = compression;
+}
+
+/**
+ * @brief Get factor of moving representative points towards the mean.
+ * @return Compression.
+ */
+double CURE::getCompression() const
+{
+    return compression;
+}
+
+/**
+ * @brief Set number of images in the random sample.
+ * @param sampleSize Sample size, 0 means that all images are clustered directly.
+ */
+void CURE::setSampleSize(size_t sampleSize)
+{
+    this->sampleSize = sampleSize;
+}
+
+/**
+ * @brief Get number of images in the random sample.
+ * @return Sample size.
+ */
+size_t CURE::getSampleSize() const
+{
+    return sampleSize;
+}
+
+/**
+ * @brief Set number of partitions of the sample.
+ * @param partitionCount Number of partitions.
+ * @throw std::runtime_error If number of partitions is equal to 0.
+ */
+void CURE::setPartitionCount(size_t partitionCount)
+{
+    if(partitionCount == 0)
+        throw(std::runtime_error("Number of partitions cannot be equal to 0"));
+    
+    this->partitionCount = partitionCount;
+}
+
+/**
+ * @brief Get number of partitions of the sample.
+ * @return Number of partitions.
+ */
+size_t CURE::getPartitionCount() const
+{
+    return partitionCount;
+}
@@ -23,7 +23,15 @@
 
 #include "Clustering/DBSCAN.hpp"
 #include "Clustering/ROCK.hpp"
+#include "Clustering/Agglomerative.hpp"
+#include "Clustering/KMeans.hpp"
+#include "Clustering/MiniBatchKMeans.hpp"
+#include "Clustering/OPTICS.hpp"
+#include "Clustering/AutoKMeans.hpp"
+#include "Clustering/SOMSC.hpp"
+#include "Clustering/CURE.hpp"
 #include <exception>
+#include <algorithm>
 
 using namespace magic;
 
@@ -47,6 +55,27 @@ std::shared_ptr<ClusteringAlgorithm> ClusteringAlgorithm::build(ClusteringAlgori
 
         case ROCK_ALGORITHM:
             return std::shared_ptr<ClusteringAlgorithm>(new ROCK);
+
+        case AGGLOMERATIVE_ALGORITHM:
+            return std::shared_ptr<ClusteringAlgorithm>(new Agglomerative);
+
+        case KMEANS_ALGORITHM:
+            return std::shared_ptr<ClusteringAlgorithm>(new KMeans);
+
+        case MINIBATCH_KMEANS_ALGORITHM:
+            return std::shared_ptr<ClusteringAlgorithm>(new MiniBatchKMeans);
+
+        case OPTICS_ALGORITHM:
+            return std::shared_ptr<ClusteringAlgorithm>(new OPTICS);
+
+        case AUTO_KMEANS_ALGORITHM:
+            return std::shared_ptr<ClusteringAlgorithm>(new AutoKMeans);
+
+        case SOMSC_ALGORITHM:
+            return std::shared_ptr<ClusteringAlgorithm>(new SOMSC);
+            
+        case CURE_ALGORITHM:
+            return std::shared_ptr<ClusteringAlgorithm>(new CURE);
             
         default:
             break;
@@ -58,20 +87,95 @@ std::shared_ptr<ClusteringAlgorithm> ClusteringAlgorithm::build(ClusteringAlgori
 }
 
 /**
- * @brief Copy features from the images dataset to separate vector.
- * @param dataset Images dataset.
- * @return Vector of feature vectors.
+ * @brief Check if the algorithm can learn from the features while they are still being extracted.
+ * @return True if partialFit is supported.
+ */
+bool ClusteringAlgorithm::supportsPartialFit() const
+{
+    return false;
+}
+
+/**
+ * @brief Update the model with a batch of feature vectors.
+ * Model built by the batches is used by the next call of cluster.
+ * @param dataset Feature matrix.
+ * @param rows Rows of the feature matrix that form the batch.
+ * @throw std::runtime_error If the algorithm does not support partial fit.
+ */
+void ClusteringAlgorithm::partialFit(const FeatureMatrix&, const std::vector<size_t>&)
+{
+    throw(std::runtime_error("Clustering algorithm does not support partial fit"));
+}
+
+/**
+ * @brief Forget the model built by partialFit.
+ */
+void ClusteringAlgorithm::resetPartialFit()
+{
+}
+
+/**
+ * @brief View rows of the double precision matrix in place.
+ * @param dataset Feature matrix.
+ * @return View of the rows.
+ */
+inline pyclustering::utils::metric::points_view<double> viewRows(const BasicFeatureMatrix<double>& dataset, std::vector<double>&)
+{
+    return pyclustering::utils::metric::points_view<double>(dataset.data(), dataset.rows(), dataset.cols(), dataset.stride());
+}
+
+/**
+ * @brief Convert rows of the matrix to double precision.
+ * @param dataset Feature matrix.
+ * @param buffer Storage of the converted rows.
+ * @return View of the converted rows.
  */
-std::vector<FeatureVector> ClusteringAlgorithm::copyFeatures(const FeatureDataset& dataset) const
+template<typename T>
+pyclustering::utils::metric::points_view<double> viewRows(const BasicFeatureMatrix<T>& dataset, std::vector<double>& buffer)
 {
-    std::vector<FeatureVector> features;
+    buffer.resize(dataset.rows()*dataset.cols());
+    for(size_t i=0; i<dataset.rows(); i++)
+        std::copy(dataset.row(i), dataset.row(i) + dataset.cols(), buffer.begin() + i*dataset.cols());
     
-    for(auto it=dataset.begin(); it<dataset.end(); it++)
-        features.push_back((*it).featureVector);
+    return pyclustering::utils::metric::points_view<double>(buffer.data(), dataset.rows(), dataset.cols(), dataset.cols());
+}
+
+/**
+ * @brief Copy rows of the feature matrix to separate double precision vectors.
+ * @param dataset Feature matrix.
+ * @return Vector of feature vectors.
+ */
+pyclustering::dataset ClusteringAlgorithm::copyFeatures(const FeatureMatrix& dataset) const
+{
+    pyclustering::dataset features(dataset.rows());
+    for(size_t i=0; i<dataset.rows(); i++)
+        features[i].assign(dataset.row(i), dataset.row(i) + dataset.cols());
 
     return features;
 }
 
+/**
+ * @brief Get view of the feature matrix in its own precision, rows are not copied.
+ * @param dataset Feature matrix.
+ * @return View of the features.
+ */
+pyclustering::utils::metric::points_view<FeatureScalar> ClusteringAlgorithm::viewFeatures(const FeatureMatrix& dataset) const
+{
+    return pyclustering::utils::metric::points_view<FeatureScalar>(dataset.data(), dataset.rows(), dataset.cols(), dataset.stride());
+}
+
+/**
+ * @brief Get double precision view of the feature matrix for the algorithms that do not support other precisions.
+ * Double precision matrix is viewed in place, otherwise rows are converted to the buffer once.
+ * @param dataset Feature matrix.
+ * @param buffer Storage of the converted rows, must outlive the view.
+ * @return View of the features.
+ */
+pyclustering::utils::metric::points_view<double> ClusteringAlgorithm::viewFeatures(const FeatureMatrix& dataset, std::vector<double>& buffer) const
+{
+    return viewRows(dataset, buffer);
+}
+
 /**
  * @brief Export clusters created by clustering library to the cluster format used by the rest
  * of the project.
@@ -79,15 +183,15 @@ std::vector<FeatureVector> ClusteringAlgorithm::copyFeatures(const FeatureDatase
  * @param dataset Feature dataset.
  * @return Vector of clusters.
  */
-std::vector<Cluster> ClusteringAlgorithm::exportClusters(const pyclustering::clst::cluster_data& clusters, const FeatureDataset& dataset) const
+std::vector<Cluster> ClusteringAlgorithm::exportClusters(const pyclustering::clst::cluster_data& clusters, const FeatureMatrix& dataset) const
 {
-    //clusters data is a vector of vectors of size_t, each size_t is an index in the original image dataset
+    //clusters data is a vector of vectors of size_t, each size_t is a row of the feature matrix
     std::vector<Cluster> output;
     for(auto it=clusters.clusters().begin(); it<clusters.clusters().end(); it++)
     {
         Cluster cluster;
         for(auto it2=(*it).begin(); it2<(*it).end(); it2++)
-            cluster.push_back(dataset[*it2]);
+            cluster.push_back(dataset.path(*it2));
         
         output.push_back(cluster);
     }
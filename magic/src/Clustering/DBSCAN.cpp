@@ -23,23 +23,107 @@
 
 #include "pyclustering/cluster/dbscan.hpp"
 #include "Clustering/DBSCAN.hpp"
+#include <stdexcept>
 
 using namespace magic;
 
+/**
+ * @param eps Neighborhood radius.
+ * @param minPts Minimum number of neighbors of the core point.
+ * @throw std::runtime_error If eps is not positive.
+ */
+DBSCAN::DBSCAN(double eps, size_t minPts)
+{
+    setEps(eps);
+    setMinPts(minPts);
+}
+
 /**
  * @brief Perform clustering operation using DBSCAN algorithm.
  * @param features Points.
  * @return Vector of clusters.
  */
-std::vector<Cluster> DBSCAN::cluster(const FeatureDataset& dataset) const
+std::vector<Cluster> DBSCAN::cluster(const FeatureMatrix& dataset) const
 {
-    std::vector<FeatureVector> features = copyFeatures(dataset);
+    std::vector<double> buffer;
+    const pyclustering::utils::metric::points_view<double> points = viewFeatures(dataset, buffer);
     pyclustering::clst::dbscan_data clusters;
     
-    //perform clustering
-    pyclustering::clst::dbscan dbscan(0.05, 1);
-    dbscan.process(features, clusters);
+    //perform clustering, neighborhoods are computed in parallel
+    if(searchEffort > 0)
+    {
+        pyclustering::container::hnsw_parameters parameters;
+        parameters.m_ef_search = searchEffort;
+        
+        pyclustering::clst::dbscan dbscan(eps, minPts, parameters, true);
+        dbscan.process(points, clusters);
+    }
+    else
+    {
+        pyclustering::clst::dbscan dbscan(eps, minPts, true);
+        dbscan.process(points, clusters);
+    }
     
     //export clustering results
     return exportClusters(clusters, dataset);
 }
+
+/**
+ * @brief Set neighborhood radius.
+ * @param eps Neighborhood radius.
+ * @throw std::runtime_error If eps is not positive.
+ */
+void DBSCAN::setEps(double eps)
+{
+    if(eps <= 0)
+        throw(std::runtime_error("DBSCAN radius must be positive"));
+    
+    this->eps = eps;
+}
+
+/**
+ * @brief Get neighborhood radius.
+ * @return Neighborhood radius.
+ */
+double DBSCAN::getEps() const
+{
+    return eps;
+}
+
+/**
+ * @brief Set minimum number of neighbors of the core point.
+ * @param minPts Minimum number of neighbors.
+ */
+void DBSCAN::setMinPts(size_t minPts)
+{
+    this->minPts = minPts;
+}
+
+/**
+ * @brief Get minimum number of neighbors of the core point.
+ * @return Minimum number of neighbors.
+ */
+size_t DBSCAN::getMinPts() const
+{
+    return minPts;
+}
+
+/**
+ * @brief Set size of the candidate list of the approximate neighbor search.
+ * Approximate search (HNSW index) is much faster than the exact one for long feature vectors,
+ * larger candidate list finds more of the true neighbors at the cost of speed.
+ * @param searchEffort Size of the candidate list, 0 for exact search.
+ */
+void DBSCAN::setSearchEffort(size_t searchEffort)
+{
+    this->searchEffort = searchEffort;
+}
+
+/**
+ * @brief Get size of the candidate list of the approximate neighbor search.
+ * @return Size of the candidate list, 0 if search is exact.
+ */
+size_t DBSCAN::getSearchEffort() const
+{
+    return searchEffort;
+}
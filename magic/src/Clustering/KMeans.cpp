@@ -0,0 +1,125 @@
+/**
+ * @file KMeans.cpp
+ * @brief This source file contains source code for k-means clustering algorithm.
+ * @author Krzysztof Adamkiewicz
+ * @date 18/10/2026
+ */
+
+// This file is a part of Cluster - Application for image clustering.
+// Copyright (C) 2020 Krzysztof Adamkiewicz <kadamkiewicz835@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include "pyclustering/cluster/kmeans.hpp"
+#include "pyclustering/cluster/kmeans_plus_plus.hpp"
+#include "Clustering/KMeans.hpp"
+#include <stdexcept>
+#include <algorithm>
+
+using namespace magic;
+
+/** @brief Number of images per cluster used to seed the centers, k-means++ costs O(n*k) distances. */
+inline const size_t SEEDING_SAMPLE_FACTOR = 16;
+
+/**
+ * @param clusterCount Number of clusters.
+ * @param maxIterations Maximum number of iterations.
+ * @throw std::runtime_error If cluster count or number of iterations is equal to 0.
+ */
+KMeans::KMeans(size_t clusterCount, size_t maxIterations)
+{
+    setClusterCount(clusterCount);
+    setMaxIterations(maxIterations);
+}
+
+/**
+ * @brief Perform clustering operation using k-means algorithm.
+ * Feature matrix is clustered in place in its own precision, seeding sample is copied separately.
+ * @param dataset Feature matrix.
+ * @return Vector of clusters.
+ */
+std::vector<Cluster> KMeans::cluster(const FeatureMatrix& dataset) const
+{
+    if(dataset.empty())
+        return std::vector<Cluster>();
+    
+    const size_t count = std::min(clusterCount, dataset.rows());
+    
+    //seed the centers with evenly spread sample of the images
+    const size_t sampleSize = std::min(dataset.rows(), count*SEEDING_SAMPLE_FACTOR);
+    pyclustering::dataset sample(sampleSize);
+    for(size_t i=0; i<sampleSize; i++)
+    {
+        const FeatureScalar* row = dataset.row(i*dataset.rows()/sampleSize);
+        sample[i].assign(row, row + dataset.cols());
+    }
+    
+    pyclustering::dataset centers;
+    pyclustering::clst::kmeans_plus_plus(count).initialize(sample, centers);
+    
+    //perform clustering
+    const pyclustering::utils::metric::points_view<FeatureScalar> points = viewFeatures(dataset);
+    pyclustering::clst::kmeans_data clusters;
+    pyclustering::clst::kmeans kmeans(centers, pyclustering::clst::kmeans::DEFAULT_TOLERANCE, maxIterations,
+        pyclustering::utils::metric::distance_metric_factory<pyclustering::point>::euclidean_square(),
+        pyclustering::clst::kmeans_assignment::AUTOMATIC);
+    kmeans.process(points, clusters);
+    
+    //export clustering results
+    return exportClusters(clusters, dataset);
+}
+
+/**
+ * @brief Set number of clusters.
+ * @param clusterCount Number of clusters.
+ * @throw std::runtime_error If cluster count is equal to 0.
+ */
+void KMeans::setClusterCount(size_t clusterCount)
+{
+    if(clusterCount == 0)
+        throw(std::runtime_error("Number of clusters cannot be equal to 0"));
+    
+    this->clusterCount = clusterCount;
+}
+
+/**
+ * @brief Get number of clusters.
+ * @return Number of clusters.
+ */
+size_t KMeans::getClusterCount() const
+{
+    return clusterCount;
+}
+
+/**
+ * @brief Set maximum number of iterations.
+ * @param maxIterations Maximum number of iterations.
+ * @throw std::runtime_error If number of iterations is equal to 0.
+ */
+void KMeans::setMaxIterations(size_t maxIterations)
+{
+    if(maxIterations == 0)
+        throw(std::runtime_error("Number of iterations cannot be equal to 0"));
+    
+    this->maxIterations = maxIterations;
+}
+
+/**
+ * @brief Get maximum number of iterations.
+ * @return Maximum number of iterations.
+ */
+size_t KMeans::getMaxIterations() const
+{
+    return maxIterations;
+}
@@ -0,0 +1,170 @@
+/**
+ * @file MiniBatchKMeans.cpp
+ * @brief This source file contains source code for mini-batch k-means clustering algorithm.
+ * @author Krzysztof Adamkiewicz
+ * @date 18/10/2026
+ */
+
+// This file is a part of Cluster - Application for image clustering.
+// Copyright (C) 2020 Krzysztof Adamkiewicz <kadamkiewicz835@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include "Clustering/MiniBatchKMeans.hpp"
+#include <stdexcept>
+#include <algorithm>
+
+using namespace magic;
+
+/**
+ * @param clusterCount Number of clusters.
+ * @param batchSize Number of features in the batch.
+ * @param iterationCount Number of batches used when the model was not built by partialFit.
+ * @throw std::runtime_error If any of the parameters is equal to 0.
+ */
+MiniBatchKMeans::MiniBatchKMeans(size_t clusterCount, size_t batchSize, size_t iterationCount)
+{
+    setClusterCount(clusterCount);
+    setBatchSize(batchSize);
+    setIterationCount(iterationCount);
+}
+
+/**
+ * @brief Perform clustering operation using mini-batch k-means algorithm.
+ * If the model was built by partialFit features are only assigned to the closest centers,
+ * otherwise the model is built from random batches of the dataset first.
+ * @param dataset Feature matrix.
+ * @return Vector of clusters.
+ */
+std::vector<Cluster> MiniBatchKMeans::cluster(const FeatureMatrix& dataset) const
+{
+    if(dataset.empty())
+        return std::vector<Cluster>();
+    
+    const pyclustering::utils::metric::points_view<FeatureScalar> points = viewFeatures(dataset);
+    pyclustering::clst::kmeans_data clusters;
+    
+    if(model && model->is_initialized())
+        model->assign(points, clusters);
+    else
+    {
+        pyclustering::clst::minibatch_kmeans minibatchKMeans(std::min(clusterCount, dataset.rows()), batchSize, iterationCount);
+        minibatchKMeans.process(points, clusters);
+    }
+    
+    //export clustering results
+    return exportClusters(clusters, dataset);
+}
+
+/**
+ * @brief Mini-batch k-means supports partial fit.
+ * @return True.
+ */
+bool MiniBatchKMeans::supportsPartialFit() const
+{
+    return true;
+}
+
+/**
+ * @brief Update centers with a batch of feature vectors.
+ * First batches are only collected until there is enough features to seed the centers.
+ * @param dataset Feature matrix.
+ * @param rows Rows of the feature matrix that form the batch.
+ */
+void MiniBatchKMeans::partialFit(const FeatureMatrix& dataset, const std::vector<size_t>& rows)
+{
+    if(!model)
+        model.reset(new pyclustering::clst::minibatch_kmeans(clusterCount, batchSize, iterationCount));
+    
+    batch.resize(rows.size()*dataset.cols());
+    for(size_t i=0; i<rows.size(); i++)
+        std::copy(dataset.row(rows[i]), dataset.row(rows[i]) + dataset.cols(), batch.begin() + i*dataset.cols());
+    
+    model->partial_fit(pyclustering::utils::metric::points_view<double>(batch.data(), rows.size(), dataset.cols(), dataset.cols()));
+}
+
+/**
+ * @brief Forget the model built by partialFit.
+ */
+void MiniBatchKMeans::resetPartialFit()
+{
+    model.reset();
+    batch.clear();
+}
+
+/**
+ * @brief Set number of clusters.
+ * @param clusterCount Number of clusters.
+ * @throw std::runtime_error If cluster count is equal to 0.
+ */
+void MiniBatchKMeans::setClusterCount(size_t clusterCount)
+{
+    if(clusterCount == 0)
+        throw(std::runtime_error("Number of clusters cannot be equal to 0"));
+    
+    this->clusterCount = clusterCount;
+}
+
+/**
+ * @brief Get number of clusters.
+ * @return Number of clusters.
+ */
+size_t MiniBatchKMeans::getClusterCount() const
+{
+    return clusterCount;
+}
+
+/**
+ * @brief Set number of features in the batch.
+ * @param batchSize Number of features in the batch.
+ * @throw std::runtime_error If batch size is equal to 0.
+ */
+void MiniBatchKMeans::setBatchSize(size_t batchSize)
+{
+    if(batchSize == 0)
+        throw(std::runtime_error("Batch size cannot be equal to 0"));
+    
+    this->batchSize = batchSize;
+}
+
+/**
+ * @brief Get number of features in the batch.
+ * @return Number of features in the batch.
+ */
+size_t MiniBatchKMeans::getBatchSize() const
+{
+    return batchSize;
+}
+
+/**
+ * @brief Set number of batches used when the model was not built by partialFit.
+ * @param iterationCount Number of batches.
+ * @throw std::runtime_error If number of batches is equal to 0.
+ */
+void MiniBatchKMeans::setIterationCount(size_t iterationCount)
+{
+    if(iterationCount == 0)
+        throw(std::runtime_error("Number of iterations cannot be equal to 0"));
+    
+    this->iterationCount = iterationCount;
+}
+
+/**
+ * @brief Get number of batches used when the model was not built by partialFit.
+ * @return Number of batches.
+ */
+size_t MiniBatchKMeans::getIterationCount() const
+{
+    return iterationCount;
+}
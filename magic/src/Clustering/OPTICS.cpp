@@ -0,0 +1,174 @@
+/**
+ * @file OPTICS.cpp
+ * @brief This source file contains source code for OPTICS clustering algorithm.
+ * @author Krzysztof Adamkiewicz
+ * @date 18/10/2026
+ */
+
+// This file is a part of Cluster - Application for image clustering.
+// Copyright (C) 2020 Krzysztof Adamkiewicz <kadamkiewicz835@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include "pyclustering/cluster/optics.hpp"
+#include "Clustering/OPTICS.hpp"
+#include <stdexcept>
+
+using namespace magic;
+
+/**
+ * @param eps Maximum neighborhood radius.
+ * @param minPts Minimum number of neighbors of the core point.
+ * @param clusterCount Number of clusters, 0 to extract clusters with eps.
+ * @throw std::runtime_error If eps is not positive.
+ */
+OPTICS::OPTICS(double eps, size_t minPts, size_t clusterCount)
+{
+    setEps(eps);
+    setMinPts(minPts);
+    setClusterCount(clusterCount);
+}
+
+/**
+ * @brief Perform clustering operation using OPTICS algorithm.
+ * Feature matrix is clustered in place in its own precision, neighborhoods are computed in parallel.
+ * @param dataset Feature matrix.
+ * @return Vector of clusters.
+ */
+std::vector<Cluster> OPTICS::cluster(const FeatureMatrix& dataset) const
+{
+    if(dataset.empty())
+        return std::vector<Cluster>();
+    
+    const pyclustering::utils::metric::points_view<FeatureScalar> points = viewFeatures(dataset);
+    pyclustering::clst::optics_data clusters;
+    
+    //perform clustering
+    if(searchEffort > 0)
+    {
+        pyclustering::container::hnsw_parameters parameters;
+        parameters.m_ef_search = searchEffort;
+        
+        pyclustering::clst::optics optics(eps, minPts, clusterCount, parameters);
+        optics.process(points, clusters);
+    }
+    else
+    {
+        pyclustering::clst::optics optics(eps, minPts, clusterCount);
+        optics.process(points, clusters);
+    }
+    
+    reachabilityPlot = clusters.cluster_ordering();
+    radius = clusters.get_radius();
+    
+    //export clustering results
+    return exportClusters(clusters, dataset);
+}
+
+/**
+ * @brief Get reachability plot of the last clustering.
+ * Valleys of the plot are clusters, height of the peak between them is the radius that separates them.
+ * @return Reachability distances of the clustered images in cluster ordering.
+ */
+const std::vector<double>& OPTICS::getReachabilityPlot() const
+{
+    return reachabilityPlot;
+}
+
+/**
+ * @brief Get radius used to extract clusters in the last clustering.
+ * @return Radius chosen for the cluster count or eps.
+ */
+double OPTICS::getRadius() const
+{
+    return radius;
+}
+
+/**
+ * @brief Set maximum neighborhood radius.
+ * @param eps Maximum neighborhood radius.
+ * @throw std::runtime_error If eps is not positive.
+ */
+void OPTICS::setEps(double eps)
+{
+    if(eps <= 0)
+        throw(std::runtime_error("OPTICS radius must be positive"));
+    
+    this->eps = eps;
+}
+
+/**
+ * @brief Get maximum neighborhood radius.
+ * @return Maximum neighborhood radius.
+ */
+double OPTICS::getEps() const
+{
+    return eps;
+}
+
+/**
+ * @brief Set minimum number of neighbors of the core point.
+ * @param minPts Minimum number of neighbors.
+ */
+void OPTICS::setMinPts(size_t minPts)
+{
+    this->minPts = minPts;
+}
+
+/**
+ * @brief Get minimum number of neighbors of the core point.
+ * @return Minimum number of neighbors.
+ */
+size_t OPTICS::getMinPts() const
+{
+    return minPts;
+}
+
+/**
+ * @brief Set number of clusters.
+ * @param clusterCount Number of clusters, 0 to extract clusters with eps.
+ */
+void OPTICS::setClusterCount(size_t clusterCount)
+{
+    this->clusterCount = clusterCount;
+}
+
+/**
+ * @brief Get number of clusters.
+ * @return Number of clusters, 0 if clusters are extracted with eps.
+ */
+size_t OPTICS::getClusterCount() const
+{
+    return clusterCount;
+}
+
+/**
+ * @brief Set size of the candidate list of the approximate neighbor search.
+ * Approximate search (HNSW index) is much faster than the exact one for long feature vectors,
+ * larger candidate list finds more of the true neighbors at the cost of speed.
+ * @param searchEffort Size of the candidate list, 0 for exact search.
+ */
+void OPTICS::setSearchEffort(size_t searchEffort)
+{
+    this->searchEffort = searchEffort;
+}
+
+/**
+ * @brief Get size of the candidate list of the approximate neighbor search.
+ * @return Size of the candidate list, 0 if search is exact.
+ */
+size_t OPTICS::getSearchEffort() const
+{
+    return searchEffort;
+}
@@ -31,9 +31,9 @@ using namespace magic;
  * @param features Points.
  * @return Vector of clusters.
  */
-std::vector<Cluster> ROCK::cluster(const FeatureDataset& dataset) const
+std::vector<Cluster> ROCK::cluster(const FeatureMatrix& dataset) const
 {
-    std::vector<FeatureVector> features = copyFeatures(dataset);
+    pyclustering::dataset features = copyFeatures(dataset);
     pyclustering::clst::rock_data clusters;
     
     //perform clustering
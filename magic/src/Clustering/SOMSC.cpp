@@ -0,0 +1,109 @@
+/**
+ * @file SOMSC.cpp
+ * @brief This source file contains source code for SOM clustering algorithm.
+ * @author Krzysztof Adamkiewicz
+ * @date 18/10/2026
+ */
+
+// This file is a part of Cluster - Application for image clustering.
+// Copyright (C) 2020 Krzysztof Adamkiewicz <kadamkiewicz835@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include "pyclustering/cluster/somsc.hpp"
+#include "Clustering/SOMSC.hpp"
+#include <stdexcept>
+#include <algorithm>
+
+using namespace magic;
+
+/**
+ * @param clusterCount Number of neurons of the map.
+ * @param epochs Maximum number of training epochs.
+ * @throw std::runtime_error If cluster count or number of epochs is equal to 0.
+ */
+SOMSC::SOMSC(size_t clusterCount, size_t epochs)
+{
+    setClusterCount(clusterCount);
+    setEpochs(epochs);
+}
+
+/**
+ * @brief Perform clustering operation using self-organizing map.
+ * Feature matrix is clustered in place in its own precision, neurons that did not capture any image are skipped.
+ * @param dataset Feature matrix.
+ * @return Vector of clusters.
+ */
+std::vector<Cluster> SOMSC::cluster(const FeatureMatrix& dataset) const
+{
+    if(dataset.empty())
+        return std::vector<Cluster>();
+    
+    const pyclustering::utils::metric::points_view<FeatureScalar> points = viewFeatures(dataset);
+    pyclustering::clst::somsc_data clusters;
+    
+    //perform clustering
+    pyclustering::clst::somsc somsc(clusterCount, epochs, pyclustering::nnet::som_train_type::SOM_BATCH);
+    somsc.process(points, clusters);
+    
+    auto& captured = clusters.clusters();
+    captured.erase(std::remove_if(captured.begin(), captured.end(), [](const pyclustering::clst::cluster& c){ return c.empty(); }), captured.end());
+    
+    //export clustering results
+    return exportClusters(clusters, dataset);
+}
+
+/**
+ * @brief Set number of neurons of the map.
+ * @param clusterCount Number of neurons.
+ * @throw std::runtime_error If cluster count is equal to 0.
+ */
+void SOMSC::setClusterCount(size_t clusterCount)
+{
+    if(clusterCount == 0)
+        throw(std::runtime_error("Number of clusters cannot be equal to 0"));
+    
+    this->clusterCount = clusterCount;
+}
+
+/**
+ * @brief Get number of neurons of the map.
+ * @return Number of neurons.
+ */
+size_t SOMSC::getClusterCount() const
+{
+    return clusterCount;
+}
+
+/**
+ * @brief Set maximum number of training epochs.
+ * @param epochs Maximum number of epochs.
+ * @throw std::runtime_error If number of epochs is equal to 0.
+ */
+void SOMSC::setEpochs(size_t epochs)
+{
+    if(epochs == 0)
+        throw(std::runtime_error("Number of epochs cannot be equal to 0"));
+    
+    this->epochs = epochs;
+}
+
+/**
+ * @brief Get maximum number of training epochs.
+ * @return Maximum number of epochs.
+ */
+size_t SOMSC::getEpochs() const
+{
+    return epochs;
+}
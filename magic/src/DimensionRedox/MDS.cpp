@@ -24,6 +24,11 @@
 #include "DimensionRedox/MDS.hpp"
 #include <eigen3/Eigen/Core>
 #include <mathtoolbox/classical-mds.hpp>
+#include <pyclustering/utils/distance_matrix.hpp>
+#include <pyclustering/parallel/parallel.hpp>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
 
 using namespace magic;
 
@@ -33,56 +38,141 @@ using namespace magic;
  * Matrix is not reallocated when size between calls does not change.
  * @param points Points.
  */
-void MDS::computeDistanceMatrix(const FeatureDataset& points)
+void MDS::computeDistanceMatrix(const FeatureMatrix& points)
 {
     //if size of dimensional matrix is different than point vector lenght we have to build a new one
-    const size_t pointCount = points.size();
+    const size_t pointCount = points.rows();
     const size_t currentMatrixSize = this->distanceMatrix.rows();
     if(currentMatrixSize != pointCount)
         distanceMatrix.resize(pointCount, pointCount);
     
-    //compute dimension matrix
-    for (size_t i = 0; i < pointCount; ++i)
-    {
-        Eigen::VectorXd vect1 = Eigen::Map<Eigen::VectorXd>((double*)points[i].featureVector.data(), points[i].featureVector.size());
-        for (size_t j = i; j < pointCount; ++j)
-        {
-            //TODO Use low level memory access to avoid rebuilding Eigen vectors on each iteration
-            Eigen::VectorXd vect2 = Eigen::Map<Eigen::VectorXd>((double*)points[j].featureVector.data(), points[j].featureVector.size());
-            const double d = (vect1 - vect2).norm();
-            distanceMatrix(i, j) = d;
-            distanceMatrix(j, i) = d;
-        }
-    }
+    //compute dimension matrix with the shared tiled engine, matrix is symmetric so storage order does not matter
+    const pyclustering::utils::metric::points_view<FeatureScalar> view(points.data(), points.rows(), points.cols(), points.stride());
+    pyclustering::utils::metric::compute_distance_matrix(view, pyclustering::utils::metric::distance_type::EUCLIDEAN,
+                                                         distanceMatrix.data(), pointCount);
 }
 
 /**
  * @brief Perform dimensionality reduction using multidimensional scaling.
  * @param dataset Dataset that we want to reduce.
  * @param outputDim Number of dimensions in the output.
- * @return Reduced feature dataset.
+ * @return Reduced feature matrix.
  */
-FeatureDataset MDS::reduce(const FeatureDataset& dataset, unsigned short outputDim)
+FeatureMatrix MDS::reduce(const FeatureMatrix& dataset, unsigned short outputDim)
 {
+    if(dataset.rows() > LANDMARK_THRESHOLD && landmarkCount < dataset.rows())
+        return reduceWithLandmarks(dataset, outputDim);
+    
     computeDistanceMatrix(dataset);
     
-    //perform reduction
-    const Eigen::MatrixXd reduced = mathtoolbox::ComputeClassicalMds(distanceMatrix, outputDim);
+    //perform reduction, distance matrix is used as the working memory
+    const Eigen::MatrixXd reduced = mathtoolbox::ComputeClassicalMdsInPlace(distanceMatrix, outputDim);
     
-    //convert to array of vector
-    FeatureDataset featureDataset;
-    featureDataset.reserve(dataset.size());
+    //convert to feature matrix
+    FeatureMatrix featureDataset(reduced.cols(), reduced.rows());
     for(size_t i=0; i<(size_t)reduced.cols(); i++)
     {
-        //copy contents of the reduces matrix to the  feature vector
-        ImageFeature feature;
-        feature.path = dataset[i].path;
+        //copy contents of the reduces matrix to the row of the feature matrix
+        featureDataset.path(i) = dataset.path(i);
 
         for(size_t r=0; r<(size_t)reduced.rows(); r++)
-            feature.featureVector.push_back(reduced(r, i));
-        
-        featureDataset.push_back(feature);
+            featureDataset(i, r) = reduced(r, i);
     }
     
     return featureDataset;
 }
+
+/**
+ * @brief Perform dimensionality reduction using landmark MDS.
+ * Landmarks are reduced using classical MDS, remaining points are placed by the distances to the landmarks.
+ * @param dataset Dataset that we want to reduce.
+ * @param outputDim Number of dimensions in the output.
+ * @return Reduced feature matrix.
+ */
+FeatureMatrix MDS::reduceWithLandmarks(const FeatureMatrix& dataset, unsigned short outputDim)
+{
+    const std::vector<size_t> landmarks = selectLandmarks(dataset);
+    
+    //copy landmarks to a separate matrix so the distance engine can process them
+    FeatureMatrix landmarkPoints(landmarks.size(), dataset.cols());
+    for(size_t i=0; i<landmarks.size(); i++)
+        std::copy(dataset.row(landmarks[i]), dataset.row(landmarks[i]) + dataset.cols(), landmarkPoints.row(i));
+    
+    Eigen::MatrixXd landmarkDistances(landmarks.size(), landmarks.size());
+    const pyclustering::utils::metric::points_view<FeatureScalar> view(landmarkPoints.data(), landmarkPoints.rows(), landmarkPoints.cols(), landmarkPoints.stride());
+    pyclustering::utils::metric::compute_distance_matrix(view, pyclustering::utils::metric::distance_type::EUCLIDEAN,
+                                                         landmarkDistances.data(), landmarks.size());
+    
+    const mathtoolbox::LandmarkMds landmarkMds(landmarkDistances, outputDim);
+    
+    //place every point using its distances to the landmarks
+    FeatureMatrix featureDataset(dataset.rows(), outputDim);
+    pyclustering::parallel::parallel_for(size_t(0), dataset.rows(), [&](size_t i)
+    {
+        Eigen::VectorXd squaredDistances(landmarks.size());
+        for(size_t l=0; l<landmarks.size(); l++)
+            squaredDistances(l) = pyclustering::utils::metric::simd::euclidean_distance_square(dataset.row(i), landmarkPoints.row(l), dataset.cols());
+        
+        const Eigen::VectorXd reduced = landmarkMds.Embed(squaredDistances);
+        for(size_t r=0; r<outputDim; r++)
+            featureDataset(i, r) = reduced(r);
+        
+        featureDataset.path(i) = dataset.path(i);
+    });
+    
+    return featureDataset;
+}
+
+/**
+ * @brief Select landmarks using MaxMin strategy.
+ * Every next landmark is the point farthest from all landmarks selected so far, so landmarks cover the whole dataset.
+ * @param points Points.
+ * @return Indices of the landmarks.
+ */
+std::vector<size_t> MDS::selectLandmarks(const FeatureMatrix& points) const
+{
+    const size_t count = std::min(landmarkCount, points.rows());
+    
+    std::vector<size_t> landmarks;
+    landmarks.reserve(count);
+    
+    std::vector<double> minDistances(points.rows(), std::numeric_limits<double>::max());
+    size_t next = 0;
+    while(landmarks.size() < count)
+    {
+        landmarks.push_back(next);
+        
+        const FeatureScalar* landmark = points.row(next);
+        pyclustering::parallel::parallel_for(size_t(0), points.rows(), [&](size_t i)
+        {
+            const double distance = pyclustering::utils::metric::simd::euclidean_distance_square(points.row(i), landmark, points.cols());
+            minDistances[i] = std::min(minDistances[i], distance);
+        });
+        
+        next = std::max_element(minDistances.begin(), minDistances.end()) - minDistances.begin();
+    }
+    
+    return landmarks;
+}
+
+/**
+ * @brief Set number of landmarks used for the datasets larger than LANDMARK_THRESHOLD.
+ * @param count Number of landmarks.
+ * @throw std::runtime_error If count is equal to 0.
+ */
+void MDS::setLandmarkCount(size_t count)
+{
+    if(count == 0)
+        throw(std::runtime_error("Number of landmarks cannot be equal to 0"));
+    
+    landmarkCount = count;
+}
+
+/**
+ * @brief Get number of landmarks used for the datasets larger than LANDMARK_THRESHOLD.
+ * @return Number of landmarks.
+ */
+size_t MDS::getLandmarkCount() const
+{
+    return landmarkCount;
+}
@@ -0,0 +1,207 @@
+/**
+ * @file Executor.cpp
+ * @brief This source file contains work stealing task executor.
+ * @author Krzysztof Adamkiewicz
+ * @date 18/10/2026
+ */
+
+// This file is a part of Cluster - Application for image clustering.
+// Copyright (C) 2020 Krzysztof Adamkiewicz <kadamkiewicz835@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include "Executor.hpp"
+#include <stdexcept>
+
+using namespace magic;
+
+/** @brief Executor that owns the current thread (nullptr outside of the workers). */
+static thread_local Executor* currentExecutor = nullptr;
+
+/** @brief Index of the current worker thread. */
+static thread_local unsigned int currentWorker = 0;
+
+/**
+ * @brief Start the executor.
+ * @param threads Number of worker threads.
+ * @throw std::runtime_error If number of threads is equal to 0.
+ */
+Executor::Executor(unsigned int threads)
+{
+    if(threads == 0)
+        throw(std::runtime_error("Number of threads cannot be equal to 0"));
+
+    for(unsigned int i=0; i<threads; i++)
+        queues.emplace_back(new WorkerQueue);
+
+    for(unsigned int i=0; i<threads; i++)
+        workers.push_back(std::thread(&Executor::work, this, i));
+}
+
+/**
+ * @brief Stop the executor. Tasks that are still queued are discarded.
+ */
+Executor::~Executor()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stop = true;
+    }
+    taskAvailable.notify_all();
+
+    for(auto it=workers.begin(); it<workers.end(); it++)
+        (*it).join();
+}
+
+/**
+ * @brief Submit task for execution.
+ * @param task Task.
+ */
+void Executor::submit(Task task)
+{
+    //tasks spawned by the worker stay local, the rest is distributed evenly
+    unsigned int index;
+    if(currentExecutor == this)
+        index = currentWorker;
+    else
+        index = nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+
+    pendingTasks.fetch_add(1);
+
+    //counter is changed under the deque mutex so it never drops below the real number of tasks
+    WorkerQueue& queue = *queues[index];
+    queue.mutex.lock();
+    queue.tasks.push_back(std::move(task));
+    queuedTasks.fetch_add(1);
+    queue.mutex.unlock();
+
+    //sleeping workers check the counter under this mutex, locking it here prevents lost wake ups
+    sleepMutex.lock();
+    sleepMutex.unlock();
+    taskAvailable.notify_one();
+}
+
+/**
+ * @brief Wait until all submitted tasks are finished.
+ * Must not be called from the worker thread.
+ * @throw Rethrows the first exception thrown by any of the tasks.
+ */
+void Executor::wait()
+{
+    std::unique_lock<std::mutex> lock(doneMutex);
+    tasksDone.wait(lock, [this]{ return pendingTasks.load() == 0; });
+
+    if(error)
+    {
+        std::exception_ptr e = error;
+        error = nullptr;
+        std::rethrow_exception(e);
+    }
+}
+
+/**
+ * @brief Check if all submitted tasks are finished.
+ * @return True if there are no queued or running tasks.
+ */
+bool Executor::isIdle() const
+{
+    return pendingTasks.load() == 0;
+}
+
+/**
+ * @brief Get number of the worker threads.
+ * @return Number of worker threads.
+ */
+unsigned int Executor::getThreadCount() const
+{
+    return workers.size();
+}
+
+/**
+ * @brief Take task for the worker.
+ * Own deque is used as a stack (newest task first) so task chains stay on the same thread,
+ * other deques are used as queues (oldest task first) when stealing.
+ * @param index Index of the worker.
+ * @param task Output task.
+ * @return True if task was found.
+ */
+bool Executor::popTask(unsigned int index, Task& task)
+{
+    for(size_t i=0; i<queues.size(); i++)
+    {
+        WorkerQueue& queue = *queues[(index + i) % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if(queue.tasks.empty())
+            continue;
+
+        if(i == 0)
+        {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        }
+        else
+        {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+
+        queuedTasks.fetch_sub(1);
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Worker thread loop.
+ * @param index Index of the worker.
+ */
+void Executor::work(unsigned int index)
+{
+    currentExecutor = this;
+    currentWorker = index;
+
+    Task task;
+    while(true)
+    {
+        if(!popTask(index, task))
+        {
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            taskAvailable.wait(lock, [this]{ return stop || queuedTasks.load() > 0; });
+            if(stop)
+                return;
+
+            continue;
+        }
+
+        try
+        {
+            task();
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(doneMutex);
+            if(!error)
+                error = std::current_exception();
+        }
+        task = nullptr;
+
+        //last finished task wakes up everyone waiting for the executor
+        if(pendingTasks.fetch_sub(1) == 1)
+        {
+            std::lock_guard<std::mutex> lock(doneMutex);
+            tasksDone.notify_all();
+        }
+    }
+}
@@ -0,0 +1,301 @@
+/**
+ * @file FeatureCache.cpp
+ * @brief This source file contains persistent feature cache.
+ * @author Krzysztof Adamkiewicz
+ * @date 18/10/2026
+ */
+
+// This file is a part of Cluster - Application for image clustering.
+// Copyright (C) 2020 Krzysztof Adamkiewicz <kadamkiewicz835@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include "FeatureCache.hpp"
+#include <filesystem>
+#include <stdexcept>
+#include <cstring>
+#include <algorithm>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace magic;
+
+namespace filesys = std::filesystem;
+
+/** @brief Identifier written at the beginning of the cache file, contains format version. */
+inline const char CACHE_FILE_MAGIC[8] = {'M', 'G', 'F', 'C', 'A', 'C', 'H', '1'};
+
+/**
+ * @brief Header of a single record in the cache file.
+ * Header is followed by the image path, configuration, padding to 8 bytes and the feature vector padded to 8 bytes.
+ * Records written before the scalar size was stored have it equal to 0 and contain doubles.
+ */
+struct RecordHeader
+{
+    uint32_t pathLength;
+    uint32_t configurationLength;
+    uint32_t featureLength;
+    uint32_t scalarSize;
+    uint64_t fileSize;
+    int64_t modificationTime;
+};
+
+/**
+ * @brief Round the size up to the multiple of 8 bytes, so feature vectors stay aligned.
+ * @param size Size.
+ * @return Aligned size.
+ */
+inline size_t align8(size_t size)
+{
+    return (size + 7) & ~static_cast<size_t>(7);
+}
+
+/**
+ * @brief Build key of the entry.
+ * @param imagePath Path to the image.
+ * @param configuration Feature extraction configuration.
+ * @return Key.
+ */
+inline std::string makeKey(const std::string& imagePath, const std::string& configuration)
+{
+    return imagePath + '\0' + configuration;
+}
+
+/**
+ * @brief Get size and modification time of the file.
+ * @param path Path to the file.
+ * @param fileSize Output size of the file.
+ * @param modificationTime Output modification time.
+ * @return False if file cannot be accessed.
+ */
+inline bool getFileStamp(const std::string& path, uint64_t& fileSize, int64_t& modificationTime)
+{
+    std::error_code error;
+    fileSize = filesys::file_size(path, error);
+    if(error)
+        return false;
+
+    const filesys::file_time_type time = filesys::last_write_time(path, error);
+    if(error)
+        return false;
+
+    modificationTime = time.time_since_epoch().count();
+    return true;
+}
+
+/**
+ * @brief Open the cache. Cache file is created if it does not exist.
+ * @param cachePath Path to the cache file.
+ * @throw std::runtime_error If cache file cannot be opened or is not a cache file.
+ */
+FeatureCache::FeatureCache(const std::string& cachePath):
+cachePath(cachePath)
+{
+    //destructor is not called when the constructor throws
+    try
+    {
+        load();
+
+        file = fopen(cachePath.c_str(), "ab");
+        if(file == nullptr)
+            throw(std::runtime_error("Cannot open feature cache: " + cachePath));
+
+        //records are written in one piece, so nothing is left in the buffer when writing fails
+        setvbuf(file, nullptr, _IONBF, 0);
+    }
+    catch(...)
+    {
+        release();
+        throw;
+    }
+
+    //new file needs the header
+    fseek(file, 0, SEEK_END);
+    if(ftell(file) == 0)
+        fwrite(CACHE_FILE_MAGIC, sizeof(CACHE_FILE_MAGIC), 1, file);
+}
+
+FeatureCache::~FeatureCache()
+{
+    release();
+}
+
+/**
+ * @brief Close the cache file and unmap its contents.
+ */
+void FeatureCache::release()
+{
+    if(file)
+        fclose(file);
+    file = nullptr;
+
+    if(mapping)
+        munmap(mapping, mappingSize);
+    mapping = nullptr;
+    mappingSize = 0;
+}
+
+/**
+ * @brief Map the cache file and index all valid records.
+ * Records are scanned in order, so the newest record of the image wins.
+ * Truncated record at the end of the file (for example after a crash) is cut off.
+ * @throw std::runtime_error If file is not a cache file.
+ */
+void FeatureCache::load()
+{
+    std::error_code error;
+    const size_t size = filesys::exists(cachePath, error) ? filesys::file_size(cachePath, error) : 0;
+    if(error || size == 0)
+        return;
+
+    if(size < sizeof(CACHE_FILE_MAGIC))
+    {
+        filesys::resize_file(cachePath, 0);
+        return;
+    }
+
+    const int fd = open(cachePath.c_str(), O_RDONLY);
+    if(fd < 0)
+        throw(std::runtime_error("Cannot open feature cache: " + cachePath));
+
+    mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(mapping == MAP_FAILED)
+    {
+        mapping = nullptr;
+        throw(std::runtime_error("Cannot map feature cache: " + cachePath));
+    }
+    mappingSize = size;
+
+    const char* begin = static_cast<const char*>(mapping);
+    if(memcmp(begin, CACHE_FILE_MAGIC, sizeof(CACHE_FILE_MAGIC)) != 0)
+        throw(std::runtime_error("File is not a feature cache: " + cachePath));
+
+    size_t offset = sizeof(CACHE_FILE_MAGIC);
+    while(offset + sizeof(RecordHeader) <= size)
+    {
+        RecordHeader header;
+        memcpy(&header, begin + offset, sizeof(RecordHeader));
+
+        const size_t textOffset = offset + sizeof(RecordHeader);
+        const size_t dataOffset = align8(textOffset + header.pathLength + header.configurationLength);
+        const size_t scalarSize = header.scalarSize == 0 ? sizeof(double) : header.scalarSize;
+        const size_t recordEnd = align8(dataOffset + header.featureLength*scalarSize);
+        if(recordEnd > size)
+            break;
+
+        //records of the other precision are skipped, images are extracted again and appended
+        offset = recordEnd;
+        if(scalarSize != sizeof(FeatureScalar))
+            continue;
+
+        Entry& entry = entries[std::string(begin + textOffset, header.pathLength) + '\0' +
+                               std::string(begin + textOffset + header.pathLength, header.configurationLength)];
+        entry.fileSize = header.fileSize;
+        entry.modificationTime = header.modificationTime;
+        entry.data = reinterpret_cast<const FeatureScalar*>(begin + dataOffset);
+        entry.length = header.featureLength;
+    }
+
+    //entries point only to the records before the cut, so the mapping stays valid
+    if(offset != size)
+        filesys::resize_file(cachePath, offset);
+}
+
+/**
+ * @brief Find cached feature vector of the image.
+ * @param imagePath Path to the image.
+ * @param configuration Feature extraction configuration.
+ * @param featureVector Output feature vector.
+ * @param length Expected length of the feature vector.
+ * @return True if vector of the expected length was found and the image did not change since it was cached.
+ */
+bool FeatureCache::find(const std::string& imagePath, const std::string& configuration, FeatureScalar* featureVector, size_t length) const
+{
+    uint64_t fileSize;
+    int64_t modificationTime;
+    if(!getFileStamp(imagePath, fileSize, modificationTime))
+        return false;
+
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    auto it = entries.find(makeKey(imagePath, configuration));
+    if(it == entries.end())
+        return false;
+
+    const Entry& entry = it->second;
+    if(entry.fileSize != fileSize || entry.modificationTime != modificationTime || entry.length != length)
+        return false;
+
+    std::copy(entry.data, entry.data + length, featureVector);
+    return true;
+}
+
+/**
+ * @brief Insert feature vector of the image into the cache.
+ * @param imagePath Path to the image.
+ * @param configuration Feature extraction configuration.
+ * @param featureVector Feature vector.
+ * @param length Length of the feature vector.
+ * @throw std::runtime_error If cache file cannot be written, partially written record is removed.
+ */
+void FeatureCache::insert(const std::string& imagePath, const std::string& configuration, const FeatureScalar* featureVector, size_t length)
+{
+    RecordHeader header;
+    header.pathLength = imagePath.size();
+    header.configurationLength = configuration.size();
+    header.featureLength = length;
+    header.scalarSize = sizeof(FeatureScalar);
+    if(!getFileStamp(imagePath, header.fileSize, header.modificationTime))
+        return;
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
+
+    //records start at 8 byte boundary, so padding after the text is the same as in the file
+    const size_t textSize = sizeof(RecordHeader) + imagePath.size() + configuration.size();
+    const size_t dataSize = length*sizeof(FeatureScalar);
+    std::vector<char> record(align8(textSize) + align8(dataSize), 0);
+    memcpy(record.data(), &header, sizeof(RecordHeader));
+    memcpy(record.data() + sizeof(RecordHeader), imagePath.data(), imagePath.size());
+    memcpy(record.data() + sizeof(RecordHeader) + imagePath.size(), configuration.data(), configuration.size());
+    memcpy(record.data() + align8(textSize), featureVector, dataSize);
+
+    fseek(file, 0, SEEK_END);
+    const long offset = ftell(file);
+    if(offset < 0 || fwrite(record.data(), 1, record.size(), file) != record.size())
+    {
+        //cut off the torn record, so the records appended later can be read
+        clearerr(file);
+        if(offset >= 0 && ftruncate(fileno(file), offset) == 0)
+            fseek(file, 0, SEEK_END);
+        throw(std::runtime_error("Cannot write feature cache: " + cachePath));
+    }
+
+    Entry& entry = entries[makeKey(imagePath, configuration)];
+    entry.fileSize = header.fileSize;
+    entry.modificationTime = header.modificationTime;
+    entry.storage.assign(featureVector, featureVector + length);
+    entry.data = entry.storage.data();
+    entry.length = entry.storage.size();
+}
+
+/**
+ * @brief Get number of cached vectors.
+ * @return Number of cached vectors.
+ */
+size_t FeatureCache::size() const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return entries.size();
+}
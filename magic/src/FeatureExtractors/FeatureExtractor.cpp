@@ -25,7 +25,6 @@
 #include "FeatureExtractors/GlobalHist.hpp"
 #include "FeatureExtractors/OpenCV_Descriptors.hpp"
 #include <exception>
-#include <cmath>
 
 using namespace magic;
 
@@ -68,33 +67,21 @@ void FeatureExtractor::setProgressCounter(std::atomic<size_t>& progressCounter)
 }
 
 /**
- * @brief Normalize features using eucklidan norm.
- * @param dataset Feature dataset.
+ * @brief Build feature vectors for the image dataset.
+ * @param dataset Image dataset.
+ * @return Feature matrix, one row for every image.
  */
-void FeatureExtractor::normalize(FeatureDataset& dataset)
+FeatureMatrix FeatureExtractor::buildFeatures(const ImageDataset& dataset) const
 {
-    auto vectLen = [](const FeatureVector& vect) -> double
+    FeatureMatrix features(dataset.size(), featureVectorSize());
+    for(size_t i=0; i<dataset.size(); i++)
     {
-        double x = 0;
-        for(auto it=vect.begin(); it<vect.end(); it++)
-            x += pow(*it, 2);
-        
-        //default to 1 so we don't normalize to -NAN
-        if(x == 0)
-            return 1;
-        
-        return sqrt(x);
-    };
-    
-    auto divVect = [](FeatureVector& vect, double val)
-    {
-        for(auto it=vect.begin(); it<vect.end(); it++)
-            (*it) = (*it) / val;
-    };
+        features.path(i) = dataset[i].path;
+        buildFeatureVector(dataset[i].image, features.row(i));
 
-    for(auto it=dataset.begin(); it<dataset.end(); it++)
-    {
-        const double len = vectLen((*it).featureVector);
-        divVect((*it).featureVector, len);
+        if(progressCounter)
+            progressCounter->fetch_add(1, std::memory_order_relaxed);//increment progress counter
     }
+
+    return features;
 }
@@ -60,52 +60,46 @@ unsigned int GlobalHistogram::featureVectorSize() const
 }
 
 /**
- * @brief Compute color histogram features.
- * @param dataset Image dataset for which we want to compute all the features.
- * @return Feature dataset.
+ * @brief Get extractor configuration.
+ * @return Configuration string.
  */
-FeatureDataset GlobalHistogram::buildFeatures(const ImageDataset& dataset) const
+std::string GlobalHistogram::getConfiguration() const
+{
+    return "GlobalHistogram;bins=" + std::to_string(binCount);
+}
+
+/**
+ * @brief Compute color histogram features of the image.
+ * @param image Image for which we want to compute the features.
+ * @param featureVector Output feature vector.
+ */
+void GlobalHistogram::buildFeatureVector(const cv::Mat& image, FeatureScalar* featureVector) const
 {
     cv::Mat hsvImage;
     cv::Mat channels[3];
     cv::Mat hist;
-        
-    FeatureDataset featureDataset;
-    featureDataset.reserve(dataset.size());
-    for(auto it=dataset.begin(); it<dataset.end(); it++)
-    {
-        //convert image to HSV
-        cv::cvtColor((*it).image, hsvImage, cv::COLOR_RGB2HSV);
-        
-        //extract channels
-        cv::split(hsvImage, channels);
-       
-        //compute histogram
-        const float range[] = {0, 256};
-        const float* histRange = {range};
-        const int histSize = 256;
-        const int sourceChannelNum = 1;
-        const int channelDim = 0;
-        const int histogramDimensionality = 1;
-        const bool uniform = true;
-        const bool accumulate = false;
-        cv::calcHist(&channels[0], sourceChannelNum, &channelDim, cv::Mat(), hist, histogramDimensionality, &histSize, &histRange, uniform, accumulate);
-        
-        //normalize
-        cv::normalize(hist, hist, 0, histSize, cv::NORM_MINMAX, -1, cv::Mat());
     
-        //save it into the vector
-        ImageFeature feature;
-        feature.path = (*it).path;
-        feature.featureVector.reserve(hist.rows);
-        for(int y=0; y<hist.rows; y++)
-            feature.featureVector.push_back(hist.at<float>(y));
-        
-        featureDataset.push_back(feature);
-
-        if(progressCounter)
-            progressCounter->fetch_add(1, std::memory_order_relaxed);//increment progress counter
-    }
+    //convert image to HSV
+    cv::cvtColor(image, hsvImage, cv::COLOR_RGB2HSV);
     
-    return featureDataset;
+    //extract channels
+    cv::split(hsvImage, channels);
+   
+    //compute histogram
+    const float range[] = {0, 256};
+    const float* histRange = {range};
+    const int histSize = binCount;
+    const int sourceChannelNum = 1;
+    const int channelDim = 0;
+    const int histogramDimensionality = 1;
+    const bool uniform = true;
+    const bool accumulate = false;
+    cv::calcHist(&channels[0], sourceChannelNum, &channelDim, cv::Mat(), hist, histogramDimensionality, &histSize, &histRange, uniform, accumulate);
+    
+    //normalize
+    cv::normalize(hist, hist, 0, histSize, cv::NORM_MINMAX, -1, cv::Mat());
+
+    //save it into the vector
+    for(int y=0; y<hist.rows; y++)
+        featureVector[y] = hist.at<float>(y);
 }
@@ -65,57 +65,43 @@ unsigned int OpenCV_Descriptor::featureVectorSize() const
 }
 
 /**
- * @brief Compute OpenCV descriptors for the entire dataset.
- * @param dataset Dataset for which we want to compute the features.
- * @return Feature dataset.
+ * @brief Get extractor configuration.
+ * @return Configuration string.
  */
-FeatureDataset OpenCV_Descriptor::buildFeatures(const ImageDataset& dataset) const
+std::string OpenCV_Descriptor::getConfiguration() const
 {
-    FeatureDataset featureDataset;
-    featureDataset.reserve(dataset.size());
+    return "KAZE;keypoints=" + std::to_string(keypointCount);
+}
 
+/**
+ * @brief Compute OpenCV descriptors of the image.
+ * @param image Image for which we want to compute the features.
+ * @param featureVector Output feature vector.
+ */
+void OpenCV_Descriptor::buildFeatureVector(const cv::Mat& image, FeatureScalar* featureVector) const
+{
     std::vector<cv::KeyPoint> keyPoints;
-    FeatureVector featureVector;
     cv::Mat features;
     
-    for(auto it=dataset.begin(); it<dataset.end(); it++)
-    {
-        //extract keypoints
-        kaze->detect((*it).image, keyPoints);
-        
-        //sort keypoints by the response, the higher response, the better the keypoint
-        std::sort(keyPoints.begin(), keyPoints.end(), [](auto& a, auto& b) ->bool { return a.response > b.response; });
-        
-        //truncate the keypoints vector, we will leave max keypointCount vector
-        if(keyPoints.size() > keypointCount)
-            keyPoints.resize(keypointCount);
-        
-        //compute features
-        kaze->compute((*it).image, keyPoints, features);
-
-        //flatten the features matrix 
-        featureVector.assign(features.datastart, features.dataend);
-        
-        //truncate if necessary
-        if(featureVector.size() > featureVectorSize())
-            featureVector.resize(featureVectorSize());
-        
-        //add 0's to the end of the matrix to match the size if necessary
-        if(featureVector.size() < featureVectorSize())
-        {
-            for(size_t i=featureVector.size(); i<featureVectorSize(); i++)
-                featureVector.push_back(0);
-        }
-        
-        ImageFeature feature;
-        feature.path = (*it).path;
-        feature.featureVector = featureVector;
-
-        featureDataset.push_back(feature);
+    //extract keypoints
+    kaze->detect(image, keyPoints);
+    
+    //sort keypoints by the response, the higher response, the better the keypoint
+    std::sort(keyPoints.begin(), keyPoints.end(), [](auto& a, auto& b) ->bool { return a.response > b.response; });
+    
+    //truncate the keypoints vector, we will leave max keypointCount vector
+    if(keyPoints.size() > keypointCount)
+        keyPoints.resize(keypointCount);
+    
+    //compute features
+    kaze->compute(image, keyPoints, features);
 
-        if(progressCounter)
-            progressCounter->fetch_add(1, std::memory_order_relaxed);//increment progress counter
-    }
+    //flatten the features matrix (KAZE descriptors are 32 bit floats), truncate if necessary
+    const size_t size = featureVectorSize();
+    const size_t descriptorSize = std::min<size_t>(features.total(), size);
+    const float* descriptors = features.ptr<float>();
+    std::copy(descriptors, descriptors + descriptorSize, featureVector);
     
-    return featureDataset;
+    //add 0's to the end of the vector to match the size if necessary
+    std::fill(featureVector + descriptorSize, featureVector + size, 0);
 }
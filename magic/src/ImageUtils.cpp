@@ -26,6 +26,7 @@
 #include <opencv2/opencv.hpp>
 #include <opencv2/imgproc/imgproc.hpp>
 #include <algorithm>
+#include <fstream>
 
 using namespace magic;
 
@@ -62,7 +63,7 @@ inline const std::vector<std::string> ALLOWED_FILE_EXTENSIONS =
  * @param fileName Name of the file.
  * @return True if file format is supported.
  */
-inline bool isFileFormatSupported(const std::string& fileName)
+bool magic::isFileFormatSupported(const std::string& fileName)
 {
     std::size_t found = fileName.find_last_of(".");
     if(found == std::string::npos)
@@ -93,6 +94,102 @@ Image magic::loadImageFromFile(const std::string& filePath)
     return {filePath, img};
 }
 
+/**
+ * @brief Read size of the JPEG image from its frame header without decoding the image.
+ * @param filePath Path to the image.
+ * @param width Output width of the image.
+ * @param height Output height of the image.
+ * @return False if file is not a JPEG image or the header cannot be found.
+ */
+inline bool readJpegSize(const std::string& filePath, unsigned int& width, unsigned int& height)
+{
+    std::ifstream file(filePath, std::ios::binary);
+    auto readByte = [&file]() -> int { return file.get(); };
+    auto readWord = [&readByte]() -> unsigned int
+    {
+        const int high = readByte();
+        const int low = readByte();
+        return (static_cast<unsigned int>(high) << 8) | static_cast<unsigned int>(low);
+    };
+    
+    //every JPEG file starts with the SOI marker
+    if(readByte() != 0xFF || readByte() != 0xD8)
+        return false;
+    
+    while(file)
+    {
+        //find the next marker, markers can be preceded by any number of 0xFF fill bytes
+        int marker = readByte();
+        if(marker != 0xFF)
+            return false;
+        while(marker == 0xFF)
+            marker = readByte();
+        
+        //markers without the payload
+        if(marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7))
+            continue;
+        
+        //start of scan, image data follows, so there is no frame header
+        if(marker == 0xDA || marker == EOF)
+            return false;
+        
+        const unsigned int length = readWord();
+        if(length < 2)
+            return false;
+        
+        //SOF0 - SOF15 markers, except DHT (0xC4), JPG (0xC8) and DAC (0xCC)
+        if(marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC)
+        {
+            readByte();//sample precision
+            height = readWord();
+            width = readWord();
+            return file && width > 0 && height > 0;
+        }
+        
+        file.seekg(length - 2, std::ios::cur);
+    }
+    
+    return false;
+}
+
+/**
+ * @brief Load a single image and resize it to the given size.
+ * JPEG images are decoded directly at the largest reduced scale (1/2, 1/4 or 1/8)
+ * that is still not smaller than the requested size, so the full resolution bitmap is never created.
+ * @param filePath Path to the image.
+ * @param width Width of the output image.
+ * @param height Height of the output image.
+ * @return Image object.
+ * @throw std::runtime_error If error occurs dring loading.
+ */
+Image magic::loadImageFromFile(const std::string& filePath, unsigned int width, unsigned int height)
+{
+    int flags = cv::IMREAD_COLOR;
+    
+    unsigned int imageWidth, imageHeight;
+    if(readJpegSize(filePath, imageWidth, imageHeight))
+    {
+        //image can be rotated by the EXIF orientation, so both sides have to be large enough for both target sides
+        const unsigned int imageSide = std::min(imageWidth, imageHeight);
+        const unsigned int targetSide = std::max(width, height);
+        
+        if(imageSide >= 8*targetSide)
+            flags = cv::IMREAD_REDUCED_COLOR_8;
+        else if(imageSide >= 4*targetSide)
+            flags = cv::IMREAD_REDUCED_COLOR_4;
+        else if(imageSide >= 2*targetSide)
+            flags = cv::IMREAD_REDUCED_COLOR_2;
+    }
+    
+    cv::Mat img = cv::imread(filePath, flags);
+    if(img.data == nullptr)
+        throw(std::runtime_error("Cannot load file: " + filePath));
+    
+    cv::resize(img, img, cv::Size(width, height), 0, 0, cv::INTER_LINEAR);
+    
+    return {filePath, img};
+}
+
 /**
  * @brief Load a batch of images.
  * @param filePaths Vector of image paths.
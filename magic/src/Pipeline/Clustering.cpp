@@ -27,11 +27,11 @@ using namespace magic;
 
 void Pipeline::cluster()
 {
-    auto worker = [](const FeatureDataset& featureDataset,
+    auto worker = [](const FeatureMatrix& featureDataset,
                      std::shared_ptr<ClusteringAlgorithm> clusteringAlg) -> std::vector<Cluster>
     {
         return clusteringAlg->cluster(featureDataset);
     };
     
-    clusters = std::async(worker, std::ref(imageFeatures.second), clusteringAlgorithm);
+    clusters = std::async(worker, std::cref(imageFeatures), clusteringAlgorithm);
 }
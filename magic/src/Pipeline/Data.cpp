@@ -36,7 +36,64 @@ void Pipeline::setInput(const std::vector<std::string>& paths)
     if(getStatus() != READY)
         throw(std::runtime_error("Cannot set pipeline input when pipeline status != READY"));
     
-    imagePaths.second = paths;
+    imagePaths = paths;
+}
+
+/**
+ * @brief Set the executor used by the batch stages.
+ * Executor can be shared between pipelines so worker threads are reused between the runs.
+ * If executor is not set or has different number of threads, a new one is created when processing is started.
+ * @param executor Executor.
+ * @throw std::runtime_error If pipeline status is != READY.
+ */
+void Pipeline::setExecutor(std::shared_ptr<Executor> executor)
+{
+    if(getStatus() != READY)
+        throw(std::runtime_error("Cannot set pipeline executor when pipeline status != READY"));
+    
+    this->executor = executor;
+}
+
+/**
+ * @brief Set the feature cache.
+ * Images found in the cache are not loaded and their features are not extracted again.
+ * Newly extracted features are inserted into the cache.
+ * @param cache Feature cache, nullptr disables caching.
+ * @throw std::runtime_error If pipeline status is != READY.
+ */
+void Pipeline::setFeatureCache(std::shared_ptr<FeatureCache> cache)
+{
+    if(getStatus() != READY)
+        throw(std::runtime_error("Cannot set feature cache when pipeline status != READY"));
+    
+    featureCache = cache;
+}
+
+/**
+ * @brief Set the pipeline execution mode.
+ * @param mode Execution mode.
+ * @throw std::runtime_error If pipeline status is != READY.
+ */
+void Pipeline::setMode(Mode mode)
+{
+    if(getStatus() != READY)
+        throw(std::runtime_error("Cannot set pipeline mode when pipeline status != READY"));
+    
+    this->mode = mode;
+}
+
+/**
+ * @brief Enable or disable decoding images directly at the preprocessed size.
+ * When enabled, images are resized while loading and the preprocessing stage has nothing left to do.
+ * @param enabled True to enable reduced decoding.
+ * @throw std::runtime_error If pipeline status is != READY.
+ */
+void Pipeline::setReducedDecoding(bool enabled)
+{
+    if(getStatus() != READY)
+        throw(std::runtime_error("Cannot set reduced decoding when pipeline status != READY"));
+    
+    reducedDecoding = enabled;
 }
 
 /**
@@ -57,39 +114,10 @@ std::vector<Cluster> Pipeline::getClusters() const
  * @return Reduced features.
  * @throw std::runtime_error If pipeline status is != PROCESSING_COMPLETED.
  */
-FeatureDataset Pipeline::getReducedFeatures() const
+FeatureMatrix Pipeline::getReducedFeatures() const
 {
     if(getStatus() != PROCESSING_COMPLETED)
         throw(std::runtime_error("Cannot get reduced features when pipeline status != PROCESSING_COMPLETED"));
 
-    return FeatureDataset(reducedFeatures.get());
-}
-
-/**
- * @brief Generate chunk intervals.
- * @param size Size of the input.
- * @return Vector of chunk ranges.
- * @throw std::runtime_error If size is = 0.
- */
-std::vector<std::pair<size_t, size_t>> Pipeline::getChunks(size_t size) const
-{
-    if(size == 0)
-        throw(std::runtime_error("Size cannot be = 0"));
-    
-    //if size of the input is smaller than number of threads, fall back to 1 thread
-    unsigned int threadCount = threads;
-    if(threads > size)
-        threadCount = 1;
-
-    const size_t batchSize = size/threadCount;
-    std::vector<std::pair<size_t, size_t>> batchIntervals;
-    for(unsigned int i=0; i<threadCount; i++)
-    {
-        if(i == threadCount-1)
-            batchIntervals.push_back(std::make_pair(i*batchSize, size)); //last batch must be a little larger to cover the whole dataset
-        else
-            batchIntervals.push_back(std::make_pair(i*batchSize, (i+1)*batchSize));
-    }
-    
-    return batchIntervals;
+    return FeatureMatrix(reducedFeatures.get());
 }
@@ -25,46 +25,43 @@
 
 using namespace magic;
 
+/**
+ * @brief Initiate feature extraction.
+ * Features of every image are extracted by a separate task so images that take longer
+ * to process do not stall the other threads.
+ */
 void Pipeline::extractFeatures()
 {
-    auto worker = [](std::pair<size_t, size_t>range,
-                               std::atomic<size_t>& progressCounter,
-                               ImagePool& images,
-                               FeaturePool& features,
-                               std::shared_ptr<FeatureExtractor> extractor)
-    {
-        images.first.lock();
-        ImageDataset imageBatch
-        (
-            images.second.begin() + range.first,
-            images.second.begin() + range.second
-        );
-        images.first.unlock();
-        
-        extractor->setProgressCounter(progressCounter);
-        FeatureDataset featuresBatch = extractor->buildFeatures(imageBatch);
-        FeatureExtractor::normalize(featuresBatch);
-        
-        //insert result
-        features.first.lock();
-        features.second.insert(features.second.end(), featuresBatch.begin(), featuresBatch.end());
-        features.first.unlock();
-    };
+    for(auto it=pendingImages.begin(); it<pendingImages.end(); it++)
+        executor->submit(std::bind(&Pipeline::extractImageFeatures, this, *it));
+}
+
+/**
+ * @brief Extract features of the image and store them in the row of the feature matrix with the same index.
+ * Image is not needed after that, so its pixel data is released.
+ * @param index Index of the image slot.
+ */
+void Pipeline::extractImageFeatures(size_t index)
+{
+    ProgressGuard extracted{featuredExtractedCounter};//increment progress counter
     
-    std::vector<std::pair<size_t, size_t>> chunks = getChunks(images.second.size());
-    for(auto it=chunks.begin(); it<chunks.end(); it++)
+    Image& image = images[index];
+    FeatureScalar* featureVector = imageFeatures.row(index);
+
+    featureExtractor->buildFeatureVector(image.image, featureVector);
+    FeatureExtractor::normalize(featureVector, imageFeatures.cols());
+    
+    if(featureCache)
     {
-        workerPool.push_back
-        (
-            std::thread
-            (
-                worker,
-                *it,
-                std::ref(featuredExtractedCounter),
-                std::ref(images),
-                std::ref(imageFeatures),
-                featureExtractor
-            )
-        );
+        //failing to store the features in the cache must not stop the processing
+        try
+        {
+            featureCache->insert(image.path, featureConfiguration, featureVector, imageFeatures.cols());
+        }
+        catch(std::runtime_error&)
+        {
+        }
     }
+    
+    image.image.release();
 }
@@ -27,11 +27,11 @@ using namespace magic;
 
 void Pipeline::reduceFeatures()
 {
-    auto worker = [](FeatureDataset& featureDataset,
-                     std::shared_ptr<DimReductionAlgorithm> reductor) -> FeatureDataset
+    auto worker = [](const FeatureMatrix& featureDataset,
+                     std::shared_ptr<DimReductionAlgorithm> reductor) -> FeatureMatrix
     {
         return reductor->reduce(featureDataset, 2);
     };
     
-    reducedFeatures = std::async(worker, std::ref(imageFeatures.second), dimensionalityReductionAlgorithm);
+    reducedFeatures = std::async(worker, std::cref(imageFeatures), dimensionalityReductionAlgorithm);
 }
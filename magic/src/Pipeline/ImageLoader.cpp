@@ -28,45 +28,29 @@ using namespace magic;
 
 /**
  * @brief Initiate image loading.
+ * Every image is loaded by a separate task.
  */
 void Pipeline::loadImages()
 {
-    auto worker = [](std::pair<size_t, size_t>range,
-                          std::atomic<size_t>& progressCounter,
-                          ImagePathPool& paths,
-                          ImagePool& images)
-    {
-        //generate path bath
-        paths.first.lock();
-        std::vector<std::string> pathBatch
-        (
-            paths.second.begin() + range.first,
-            paths.second.begin() + range.second
-        );
-        paths.first.unlock();
-
-        //perform image loading
-        ImageDataset dataset = loadImageBatch(pathBatch, progressCounter);
+    for(auto it=pendingImages.begin(); it<pendingImages.end(); it++)
+        executor->submit(std::bind(&Pipeline::loadImage, this, *it));
+}
 
-        //insert result
-        images.first.lock();
-        images.second.insert(images.second.end(), dataset.begin(), dataset.end());
-        images.first.unlock();
-    };
+/**
+ * @brief Load image into its slot.
+ * With reduced decoding enabled, image is also preprocessed.
+ * @param index Index of the image slot.
+ */
+void Pipeline::loadImage(size_t index)
+{
+    ProgressGuard loaded{loadedCounter};//increment progress counter
     
-    std::vector<std::pair<size_t, size_t>> chunks = getChunks(imagePaths.second.size());
-    for(auto it=chunks.begin(); it<chunks.end(); it++)
+    const std::string& path = imagePaths[imageIndices[index]];
+    if(reducedDecoding)
     {
-        workerPool.push_back
-        (
-            std::thread
-            (
-                worker,
-                *it,
-                std::ref(loadedCounter),
-                std::ref(imagePaths),
-                std::ref(images)
-            )
-        );
+        ProgressGuard preprocessed{preprocessedCounter};
+        images[index] = loadImageFromFile(path, PREPROCESSED_IMAGE_SIZE, PREPROCESSED_IMAGE_SIZE);
     }
+    else
+        images[index] = loadImageFromFile(path);
 }
@@ -22,47 +22,32 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 
 #include "Pipeline.hpp"
-#include "ImageUtils.hpp"
-#include <algorithm>
+#include <opencv2/imgproc/imgproc.hpp>
 
 using namespace magic;
 
+/**
+ * @brief Initiate image preprocessing.
+ * Every image is preprocessed by a separate task.
+ * With reduced decoding enabled images are already preprocessed by the loader.
+ */
 void Pipeline::preprocessImage()
 {
-    auto worker = [](std::pair<size_t, size_t>range,
-                          std::atomic<size_t>& progressCounter,
-                          ImagePool& images)
-    {
-        //generate path bath
-        images.first.lock();
-        ImageDataset imageBatch
-        (
-            images.second.begin() + range.first,
-            images.second.begin() + range.second
-        );
-        images.first.unlock();
-        
-        //perform image loading
-        resizeDataset(imageBatch, progressCounter, 300, 300);
-        
-        //insert result
-        images.first.lock();
-        std::copy(imageBatch.begin(), imageBatch.end(), images.second.begin() + range.first);
-        images.first.unlock();
-    };
+    if(reducedDecoding)
+        return;
+    
+    for(auto it=pendingImages.begin(); it<pendingImages.end(); it++)
+        executor->submit(std::bind(&Pipeline::resizeImage, this, *it));
+}
+
+/**
+ * @brief Resize image in its slot.
+ * @param index Index of the image slot.
+ */
+void Pipeline::resizeImage(size_t index)
+{
+    ProgressGuard preprocessed{preprocessedCounter};
     
-    std::vector<std::pair<size_t, size_t>> chunks = getChunks(images.second.size());
-    for(auto it=chunks.begin(); it<chunks.end(); it++)
-    {
-        workerPool.push_back
-        (
-            std::thread
-            (
-                worker,
-                *it,
-                std::ref(preprocessedCounter),
-                std::ref(images)
-            )
-        );
-    }
+    Image& image = images[index];
+    cv::resize(image.image, image.image, cv::Size(PREPROCESSED_IMAGE_SIZE, PREPROCESSED_IMAGE_SIZE), cv::INTER_LINEAR);
 }
@@ -22,6 +22,7 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 
 #include "Pipeline.hpp" 
+#include "ImageUtils.hpp"
 #include <exception>
 #include <chrono>
 
@@ -42,12 +43,35 @@ void Pipeline::startProcessing(unsigned int threads)
         throw(std::runtime_error("Number of threads cannot be equal to 0"));
     
     this->threads = threads;
+    if(!executor || executor->getThreadCount() != threads)
+        executor.reset(new Executor(threads));
     
-    if(imagePaths.second.size() == 0)
+    if(imagePaths.size() == 0)
         throw(std::runtime_error("Cannot start processing without any paths loaded!"));
     
+    //allocate slot for every image that can be loaded, files with unsupported format are skipped right away
+    imageIndices.clear();
+    for(size_t i=0; i<imagePaths.size(); i++)
+    {
+        if(isFileFormatSupported(imagePaths[i]))
+            imageIndices.push_back(i);
+    }
+    images.resize(imageIndices.size());
+    imageFeatures.resize(imageIndices.size(), featureExtractor->featureVectorSize());
+    for(size_t i=0; i<imageIndices.size(); i++)
+        imageFeatures.path(i) = imagePaths[imageIndices[i]];
+    loadedCounter = imagePaths.size() - imageIndices.size();
+    
+    findCachedFeatures();
+    
+    //model built by the previous run must not leak into this one
+    clusteringAlgorithm->resetPartialFit();
+    
     status = LOADING_IMAGES;
-    loadImages();//start loading
+    if(mode == STREAMING)
+        startStreaming();//start all stages at once
+    else
+        loadImages();//start loading
 }
 
 /**
@@ -61,6 +85,7 @@ void Pipeline::reset()
 
     threads = 1;
     workerPool.clear();
+    streamingError = nullptr;
 
     loadedCounter = 0;
     preprocessedCounter = 0;
@@ -68,14 +93,15 @@ void Pipeline::reset()
     clusteringCompleted = false;
     dimRedoxCompleted = false;
 
-    imagePaths.first.unlock();
-    imagePaths.second.clear();
-
-    images.first.unlock();
-    images.second.clear();
+    imagePaths.clear();
+    imageIndices.clear();
+    pendingImages.clear();
+    images.clear();
+    imageFeatures.clear();
     
-    imageFeatures.first.unlock();
-    imageFeatures.second.clear();
+    loadedQueue.reset();
+    preprocessedQueue.reset();
+    extractedQueue.reset();
     
     reducedFeatures.get().clear();
     clusters.get().clear();
@@ -93,13 +119,13 @@ bool Pipeline::isCurrentStageFinished()
     switch(status)
     {
         case LOADING_IMAGES:
-            return loadedCounter.load() == imagePaths.second.size();
+            return loadedCounter.load() == imagePaths.size();
 
         case PREPROCESSING_IMAGES:
-            return preprocessedCounter.load() == images.second.size();
+            return preprocessedCounter.load() == getImageCount();
             
         case GENERATING_FEATURES:
-            return featuredExtractedCounter.load() == images.second.size();
+            return featuredExtractedCounter.load() == getImageCount();
             
         case PERFORMING_CLUSTERING:
             asyncStatus = clusters.wait_for(std::chrono::nanoseconds(1));
@@ -125,3 +151,35 @@ bool Pipeline::isCurrentStageFinished()
 
     return false;
 }
+
+/**
+ * @brief Fill feature slots of the images that are present in the feature cache.
+ * Remaining images are scheduled for processing, cached images are counted as processed by all stages.
+ */
+void Pipeline::findCachedFeatures()
+{
+    featureConfiguration = featureExtractor->getConfiguration() +
+                           ";size=" + std::to_string(PREPROCESSED_IMAGE_SIZE) +
+                           ";reducedDecoding=" + std::to_string(reducedDecoding);
+    
+    pendingImages.clear();
+    for(size_t i=0; i<imageIndices.size(); i++)
+    {
+        if(!featureCache || !featureCache->find(imageFeatures.path(i), featureConfiguration, imageFeatures.row(i), imageFeatures.cols()))
+            pendingImages.push_back(i);
+    }
+    
+    const size_t cachedCount = imageIndices.size() - pendingImages.size();
+    loadedCounter += cachedCount;
+    preprocessedCounter = cachedCount;
+    featuredExtractedCounter = cachedCount;
+}
+
+/**
+ * @brief Get number of images that are processed by the pipeline.
+ * @return Number of images.
+ */
+size_t Pipeline::getImageCount() const
+{
+    return imageIndices.size();
+}
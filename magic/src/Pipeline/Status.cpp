@@ -34,15 +34,24 @@ Pipeline::Status Pipeline::getStatus() const
     return status;
 }
 
+/**
+ * @brief Get pipeline execution mode.
+ * @return Execution mode.
+ */
+Pipeline::Mode Pipeline::getMode() const
+{
+    return mode;
+}
+
 /**
  * @brief Get pipeline progress report.
  * @return Pipeline progress report object.
  */
 Pipeline::Progress Pipeline::getProgress() const
 {
-    size_t loadedCounter_size = imagePaths.second.size();
-    size_t preprocessedCounter_size = images.second.size();
-    size_t featuredExtractedCounter_size = images.second.size();
+    size_t loadedCounter_size = imagePaths.size();
+    size_t preprocessedCounter_size = getImageCount();
+    size_t featuredExtractedCounter_size = getImageCount();
 
     //make sure that we will not get division by 0
     if(loadedCounter_size == 0)
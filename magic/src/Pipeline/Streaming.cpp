@@ -0,0 +1,195 @@
+/**
+ * @file Streaming.cpp
+ * @brief This source file contains streaming (stage overlapped) pipeline execution.
+ * @author Krzysztof Adamkiewicz
+ * @date 18/10/2026
+ */
+
+// This file is a part of Cluster - Application for image clustering.
+// Copyright (C) 2020 Krzysztof Adamkiewicz <kadamkiewicz835@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+#include "Pipeline.hpp"
+
+using namespace magic;
+
+/**
+ * @brief Start all stages of the streaming pipeline.
+ * Every stage runs on its own set of threads. Slots of the images are passed between the stages
+ * through bounded queues so loading, preprocessing and feature extraction overlap.
+ * With reduced decoding enabled loaders feed the feature extractors directly.
+ * If the clustering algorithm supports partial fit, extracted features are also passed to the clustering thread.
+ * Image that fails in one of the stages is only counted by the remaining stages, the first error is rethrown by update().
+ */
+void Pipeline::startStreaming()
+{
+    const bool partialFit = clusteringAlgorithm->supportsPartialFit();
+
+    auto loader = [this](IndexQueue& output)
+    {
+        //take images one by one so slow files do not stall the other loaders
+        for(size_t i=loadingCursor.fetch_add(1); i<pendingImages.size(); i=loadingCursor.fetch_add(1))
+        {
+            try
+            {
+                loadImage(pendingImages[i]);
+                output.push(pendingImages[i]);
+            }
+            catch(...)
+            {
+                storeStreamingError();
+                if(!reducedDecoding)
+                    preprocessedCounter++;
+                featuredExtractedCounter++;
+            }
+        }
+
+        output.removeProducer();
+    };
+
+    auto preprocessor = [this](IndexQueue& input, IndexQueue& output)
+    {
+        size_t index;
+        while(input.pop(index))
+        {
+            try
+            {
+                resizeImage(index);
+                output.push(index);
+            }
+            catch(...)
+            {
+                storeStreamingError();
+                featuredExtractedCounter++;
+            }
+        }
+
+        output.removeProducer();
+    };
+
+    auto extractor = [this, partialFit](IndexQueue& input)
+    {
+        size_t index;
+        while(input.pop(index))
+        {
+            try
+            {
+                extractImageFeatures(index);
+                if(partialFit)
+                    extractedQueue->push(index);
+            }
+            catch(...)
+            {
+                storeStreamingError();
+            }
+        }
+
+        if(partialFit)
+            extractedQueue->removeProducer();
+    };
+
+    const size_t queueSize = STREAMING_QUEUE_SIZE*threads;
+    loadedQueue.reset(new IndexQueue(queueSize));
+    preprocessedQueue.reset(new IndexQueue(queueSize));
+    extractedQueue.reset(new IndexQueue(2*PARTIAL_FIT_BATCH_SIZE));
+
+    //producers have to be registered before any of the stages starts, otherwise queue could be closed too early
+    IndexQueue& loaderOutput = reducedDecoding ? *preprocessedQueue : *loadedQueue;
+    for(unsigned int i=0; i<threads; i++)
+    {
+        loaderOutput.addProducer();
+        if(!reducedDecoding)
+            preprocessedQueue->addProducer();
+        if(partialFit)
+            extractedQueue->addProducer();
+    }
+
+    loadingCursor = 0;
+    for(unsigned int i=0; i<threads; i++)
+    {
+        workerPool.push_back(std::thread(loader, std::ref(loaderOutput)));
+        if(!reducedDecoding)
+            workerPool.push_back(std::thread(preprocessor, std::ref(*loadedQueue), std::ref(*preprocessedQueue)));
+        workerPool.push_back(std::thread(extractor, std::ref(*preprocessedQueue)));
+    }
+
+    if(partialFit)
+        workerPool.push_back(std::thread(&Pipeline::fitStreamedFeatures, this, std::ref(*extractedQueue)));
+}
+
+/**
+ * @brief Store the first exception thrown by any of the streaming stages.
+ * Must be called from the catch block.
+ */
+void Pipeline::storeStreamingError()
+{
+    std::lock_guard<std::mutex> lock(streamingErrorMutex);
+    if(!streamingError)
+        streamingError = std::current_exception();
+}
+
+/**
+ * @brief Pass features to the clustering algorithm in batches as soon as they are available.
+ * Cached features are passed first, then the features coming from the extractors.
+ * If the partial fit fails, the queue is still drained so the extractors can finish.
+ * @param input Queue of the slots with extracted features.
+ */
+void Pipeline::fitStreamedFeatures(IndexQueue& input)
+{
+    std::vector<size_t> batch;
+    batch.reserve(PARTIAL_FIT_BATCH_SIZE);
+    bool failed = false;
+
+    auto fit = [this, &batch, &failed]()
+    {
+        try
+        {
+            clusteringAlgorithm->partialFit(imageFeatures, batch);
+        }
+        catch(...)
+        {
+            storeStreamingError();
+            failed = true;
+        }
+        batch.clear();
+    };
+
+    auto add = [&batch, &failed, &fit](size_t index)
+    {
+        if(failed)
+            return;
+        
+        batch.push_back(index);
+        if(batch.size() == PARTIAL_FIT_BATCH_SIZE)
+            fit();
+    };
+
+    //pending images are sorted, every other slot was filled from the cache before the streaming started
+    size_t pending = 0;
+    for(size_t i=0; i<getImageCount(); i++)
+    {
+        if(pending < pendingImages.size() && pendingImages[pending] == i)
+            pending++;
+        else
+            add(i);
+    }
+
+    size_t index;
+    while(input.pop(index))
+        add(index);
+
+    if(!batch.empty())
+        fit();
+}
@@ -27,6 +27,7 @@ using namespace magic;
 
 /**
  * @brief Update pipeline state.
+ * @throw Rethrows the first exception thrown by the tasks or the streaming stages of the finished stage.
  */
 void Pipeline::update()
 {
@@ -37,22 +38,37 @@ void Pipeline::update()
     if(getStatus() == PROCESSING_COMPLETED || getStatus() == READY)
         return;
     
-    //join all threads that are currently running
-    for(auto it=workerPool.begin(); it<workerPool.end(); it++)
-        (*it).join();
-    workerPool.clear();
+    //wait for the tasks that are still storing their results
+    //in streaming mode all stages run together, so threads are joined only after the last one
+    if(mode == BATCH)
+        executor->wait();
+    else if(status == GENERATING_FEATURES)
+    {
+        for(auto it=workerPool.begin(); it<workerPool.end(); it++)
+            (*it).join();
+        workerPool.clear();
+        
+        if(streamingError)
+        {
+            std::exception_ptr e = streamingError;
+            streamingError = nullptr;
+            std::rethrow_exception(e);
+        }
+    }
 
     //start next stage of the processing
     switch(status)
     {
         case LOADING_IMAGES:
             status = PREPROCESSING_IMAGES;
-            preprocessImage();
+            if(mode == BATCH)
+                preprocessImage();
             break;
 
         case PREPROCESSING_IMAGES:
             status = GENERATING_FEATURES;
-            extractFeatures();
+            if(mode == BATCH)
+                extractFeatures();
             break;
 
         case GENERATING_FEATURES: